@@ -38,4 +38,8 @@ int main() {
     logger.log_warning("log_warning log 1");
     logger.log_error("log_error log 1");
     logger.log_critical("log_critical log 1");
+
+    // the arguments of the macros are evaluated only for enabled levels
+    CT_LOG_INFO(logger, "CT_LOG_INFO log {}", 2);
+    CT_LOG_ERROR(logger, "CT_LOG_ERROR log {}", 2);
 }
@@ -0,0 +1,106 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file ex09_file_io_uring.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "cpptoolkit.hpp"
+
+#include <iostream>
+#include <chrono>
+
+#define FILES       8u
+#define RECORDS     200000u
+
+// write and read back FILES files through fstream or a shared io_uring ring
+void benchmark(CtBool p_uring) {
+    CtString record(100, 'x');
+    CtRawData data;
+    CtUInt64 s_bytes = 0;
+    std::unique_ptr<CtIoUring> ring;
+    if (p_uring) {
+        ring = std::make_unique<CtIoUring>();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        std::vector<std::unique_ptr<CtFileOutput>> files;
+        for (CtUInt32 idx = 0; idx < FILES; idx++) {
+            files.push_back(std::make_unique<CtFileOutput>("bench" + ToCtString(idx) + ".txt", CtFileOutput::WriteMode::Truncate));
+            files.back()->setDelimiter("\n", 1);
+            if (p_uring) {
+                files.back()->useIoUring(ring.get());
+            }
+        }
+        data.clone((CtUInt8*)record.c_str(), record.size());
+        for (CtUInt32 rec = 0; rec < RECORDS; rec++) {
+            for (auto& file : files) {
+                file->write(&data);
+            }
+        }
+        for (auto& file : files) {
+            file->flush();
+        }
+    }
+    auto written = std::chrono::steady_clock::now();
+    {
+        std::vector<std::unique_ptr<CtFileInput>> files;
+        for (CtUInt32 idx = 0; idx < FILES; idx++) {
+            files.push_back(std::make_unique<CtFileInput>("bench" + ToCtString(idx) + ".txt"));
+            files.back()->setDelimiter("\n", 1);
+            if (p_uring) {
+                files.back()->useIoUring(ring.get());
+            }
+        }
+        for (auto& file : files) {
+            while (file->read(&data)) {
+                s_bytes += data.size();
+            }
+        }
+    }
+    auto read = std::chrono::steady_clock::now();
+
+    std::cout << (p_uring ? "io_uring" : "fstream ")
+              << " write: " << std::chrono::duration_cast<std::chrono::milliseconds>(written - start).count() << " ms"
+              << " read: " << std::chrono::duration_cast<std::chrono::milliseconds>(read - written).count() << " ms"
+              << " (" << s_bytes << " bytes)" << std::endl;
+
+    for (CtUInt32 idx = 0; idx < FILES; idx++) {
+        std::remove(("bench" + ToCtString(idx) + ".txt").c_str());
+    }
+}
+
+int main() {
+    benchmark(CT_FALSE);
+    if (CtIoUring::isSupported()) {
+        benchmark(CT_TRUE);
+    } else {
+        std::cout << "io_uring is not supported." << std::endl;
+    }
+    return 0;
+}
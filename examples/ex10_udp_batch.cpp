@@ -0,0 +1,91 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file ex10_udp_batch.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "cpptoolkit.hpp"
+
+#include <iostream>
+#include <chrono>
+
+#define INTF        "lo"
+#define PORT        5051
+#define PACKETS     200000u
+#define BATCH       64u
+#define PAYLOAD     64u
+
+// send and receive PACKETS datagrams over loopback, BATCH at a time
+void benchmark(CtBool p_batch) {
+    CtSocketUdp receiver;
+    receiver.setSub(INTF, PORT);
+    CtSocketUdp sender;
+    sender.setPub(PORT, "127.0.0.1");
+
+    std::vector<CtRawData> messages;
+    std::vector<CtRawDataView> views;
+    for (CtUInt32 idx = 0; idx < BATCH; idx++) {
+        messages.emplace_back(PAYLOAD);
+        messages.back().resize(PAYLOAD);
+        views.push_back(messages.back().view());
+    }
+    CtUInt8 buffer[PAYLOAD + 1];
+
+    CtUInt32 received = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (received < PACKETS) {
+        CtUInt32 sent = 0;
+        if (p_batch) {
+            sent = sender.sendBatch(views.data(), BATCH);
+        } else {
+            for (; sent < BATCH; sent++) {
+                sender.send(views[sent]);
+            }
+        }
+        for (CtUInt32 idx = 0; idx < sent;) {
+            if (p_batch) {
+                idx += receiver.receiveBatch(messages.data(), sent - idx);
+            } else {
+                receiver.receive(buffer, PAYLOAD);
+                idx++;
+            }
+        }
+        received += sent;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    CtDouble seconds = std::chrono::duration<CtDouble>(end - start).count();
+    std::cout << (p_batch ? "recvmmsg/sendmmsg" : "recvfrom/sendto  ")
+              << ": " << (CtUInt64)(received / seconds) << " packets/s" << std::endl;
+}
+
+int main() {
+    benchmark(CT_FALSE);
+    benchmark(CT_TRUE);
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file ex12_ipc.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "cpptoolkit.hpp"
+
+#include <iostream>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <poll.h>
+
+#define PORT        5053
+#define PATH        "@cpptoolkit-ex12"
+#define MESSAGES    200000u
+#define ROUNDS      20000u
+#define PAYLOAD     64u
+
+// a one-way channel: send returns CT_FALSE when full, receive waits for the next message
+typedef struct _Channel {
+    std::function<CtBool(const CtRawDataView&)> send;
+    std::function<void(CtRawData*)> receive;
+} Channel;
+
+// sleep until the descriptor is ready instead of spinning
+void waitFd(CtInt32 p_fd, CtInt16 p_events) {
+    struct pollfd fds = {p_fd, p_events, 0};
+    poll(&fds, 1, 10);
+}
+
+Channel udpChannel(CtUInt16 p_port, std::vector<std::shared_ptr<void>>& p_keep) {
+    auto receiver = std::make_shared<CtSocketUdp>();
+    receiver->setReceiveBuffer(4 * 1024 * 1024);
+    receiver->setSub("lo", p_port);
+    auto sender = std::make_shared<CtSocketUdp>();
+    sender->setPub(p_port, "127.0.0.1");
+    p_keep.push_back(receiver);
+    p_keep.push_back(sender);
+    return {
+        [sender](const CtRawDataView& p_data) {
+            if (sender->sendBatch(&p_data, 1) == 1) {
+                return CT_TRUE;
+            }
+            waitFd(sender->getFd(), POLLOUT);
+            return CT_FALSE;
+        },
+        [receiver](CtRawData* p_data) {
+            while (receiver->receiveBatch(p_data, 1) == 0) {
+                waitFd(receiver->getFd(), POLLIN);
+            }
+        }
+    };
+}
+
+Channel unixChannel(const CtString& p_path, std::vector<std::shared_ptr<void>>& p_keep) {
+    auto receiver = std::make_shared<CtSocketUnix>();
+    receiver->setSub(p_path);
+    auto sender = std::make_shared<CtSocketUnix>();
+    sender->setPub(p_path);
+    p_keep.push_back(receiver);
+    p_keep.push_back(sender);
+    return {
+        [sender](const CtRawDataView& p_data) {
+            if (sender->send(p_data) > 0) {
+                return CT_TRUE;
+            }
+            waitFd(sender->getFd(), POLLOUT);
+            return CT_FALSE;
+        },
+        [receiver](CtRawData* p_data) {
+            while (receiver->receive(p_data) == 0) {
+                waitFd(receiver->getFd(), POLLIN);
+            }
+        }
+    };
+}
+
+Channel shmChannel(std::vector<std::shared_ptr<void>>& p_keep) {
+    auto ring = std::make_shared<CtShmRing>("ex12", 1 << 20);
+    p_keep.push_back(ring);
+    return {
+        [ring](const CtRawDataView& p_data) { return ring->write(p_data, -1); },
+        [ring](CtRawData* p_data) { ring->read(p_data, -1); }
+    };
+}
+
+// MESSAGES one-way messages from one thread to another
+void throughput(const CtString& p_name, Channel p_channel) {
+    CtRawData message(PAYLOAD);
+    message.resize(PAYLOAD);
+    auto start = std::chrono::steady_clock::now();
+    std::thread consumer([&]() {
+        CtRawData buffer(PAYLOAD);
+        for (CtUInt32 idx = 0; idx < MESSAGES; idx++) {
+            p_channel.receive(&buffer);
+        }
+    });
+    for (CtUInt32 idx = 0; idx < MESSAGES;) {
+        idx += p_channel.send(message.view()) ? 1 : 0;
+    }
+    consumer.join();
+    auto end = std::chrono::steady_clock::now();
+
+    CtDouble seconds = std::chrono::duration<CtDouble>(end - start).count();
+    std::cout << p_name << " throughput : " << (CtUInt64)(MESSAGES / seconds) << " messages/s" << std::endl;
+}
+
+// ROUNDS round trips between two threads
+void latency(const CtString& p_name, Channel p_ping, Channel p_pong) {
+    CtRawData message(PAYLOAD);
+    message.resize(PAYLOAD);
+    std::thread echo([&]() {
+        CtRawData buffer(PAYLOAD);
+        for (CtUInt32 idx = 0; idx < ROUNDS; idx++) {
+            p_ping.receive(&buffer);
+            while (!p_pong.send(buffer.view()));
+        }
+    });
+    auto start = std::chrono::steady_clock::now();
+    for (CtUInt32 idx = 0; idx < ROUNDS; idx++) {
+        while (!p_ping.send(message.view()));
+        p_pong.receive(&message);
+    }
+    auto end = std::chrono::steady_clock::now();
+    echo.join();
+
+    CtDouble usec = std::chrono::duration<CtDouble, std::micro>(end - start).count() / ROUNDS;
+    std::cout << p_name << " round trip : " << usec << " us" << std::endl;
+}
+
+int main() {
+    std::vector<std::shared_ptr<void>> keep;
+
+    throughput("UDP loopback ", udpChannel(PORT, keep));
+    throughput("Unix datagram", unixChannel(PATH, keep));
+    throughput("Shared memory", shmChannel(keep));
+
+    latency("UDP loopback ", udpChannel(PORT + 1, keep), udpChannel(PORT + 2, keep));
+    latency("Unix datagram", unixChannel(PATH "-ping", keep), unixChannel(PATH "-pong", keep));
+    latency("Shared memory", shmChannel(keep), shmChannel(keep));
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file ex13_logger_async.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "cpptoolkit.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#define MESSAGES    100000u
+#define THREADS     4u
+
+// log MESSAGES lines from each of p_threads threads and print the latency of the log calls
+// the log lines go to stdout and the results to stderr, run as: ex13_logger_async > /dev/null
+void benchmark(CtLogger::Mode p_mode, CtUInt32 p_threads) {
+    CtLogger logger(CtLogger::Level::INFO, "EX13");
+    logger.setMode(p_mode);
+    std::vector<std::vector<CtUInt64>> latencies(p_threads);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (CtUInt32 thread = 0; thread < p_threads; thread++) {
+        threads.emplace_back([&, thread]() {
+            CtString message = "order 000000 filled at price 101.25 quantity 300 venue XNAS thread " + std::to_string(thread);
+            latencies[thread].reserve(MESSAGES);
+            for (CtUInt32 idx = 0; idx < MESSAGES; idx++) {
+                message[6 + idx % 6] = '0' + idx % 10;
+                auto before = std::chrono::steady_clock::now();
+                logger.log_info(message);
+                auto after = std::chrono::steady_clock::now();
+                latencies[thread].push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto logged = std::chrono::steady_clock::now();
+    CtLogBackend::instance().flush();
+    auto written = std::chrono::steady_clock::now();
+
+    std::vector<CtUInt64> all;
+    for (const auto& thread : latencies) {
+        all.insert(all.end(), thread.begin(), thread.end());
+    }
+    std::sort(all.begin(), all.end());
+    std::cerr << (p_mode == CtLogger::Mode::Sync ? "sync " : "async") << " threads " << p_threads
+              << " median " << all[all.size() / 2] << " ns"
+              << ", p99 " << all[all.size() * 99 / 100] << " ns"
+              << ", p99.9 " << all[all.size() * 999 / 1000] << " ns"
+              << ", max " << all.back() << " ns"
+              << ", callers done in " << std::chrono::duration_cast<std::chrono::milliseconds>(logged - start).count() << " ms"
+              << ", written in " << std::chrono::duration_cast<std::chrono::milliseconds>(written - start).count() << " ms" << std::endl;
+}
+
+int main() {
+    // queues large enough to hold a burst of all messages of a thread
+    CtLogBackend::instance().setQueueSize(16 * 1024 * 1024);
+    CtLogBackend::instance().setOverflow(CtLogBackend::Overflow::Block);
+
+    benchmark(CtLogger::Mode::Sync, 1);
+    benchmark(CtLogger::Mode::Async, 1);
+    benchmark(CtLogger::Mode::Sync, THREADS);
+    benchmark(CtLogger::Mode::Async, THREADS);
+    std::cerr << "dropped " << CtLogBackend::instance().getDropped() << std::endl;
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file ex14_logger_binary.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "cpptoolkit.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#define MESSAGES    200000u
+#define LOG_FILE    "ex14.ctlog"
+
+// log MESSAGES fills and print the latency of the log calls
+// p_binary selects the binary output, otherwise the text is written to stdout
+void benchmark(const CtString& p_name, CtBool p_preformat, CtBool p_binary) {
+    CtLogger logger(CtLogger::Level::INFO, "EX14");
+    if (p_binary) {
+        logger.setBinaryOutput(LOG_FILE);
+    } else {
+        logger.setMode(CtLogger::Mode::Async);
+    }
+    std::vector<CtUInt64> latencies;
+    latencies.reserve(MESSAGES);
+
+    auto start = std::chrono::steady_clock::now();
+    for (CtUInt32 idx = 0; idx < MESSAGES; idx++) {
+        CtUInt64 order = 1000000 + idx;
+        CtDouble price = 101.25 + (idx % 100) / 100.0;
+        CtUInt32 quantity = 100 * (1 + idx % 7);
+        auto before = std::chrono::steady_clock::now();
+        if (p_preformat) {
+            logger.log_info("order " + std::to_string(order) + " filled at " + std::to_string(price) + " quantity " + std::to_string(quantity) + " venue XNAS");
+        } else {
+            logger.log_info("order {} filled at {:.2} quantity {} venue {}", order, price, quantity, "XNAS");
+        }
+        auto after = std::chrono::steady_clock::now();
+        latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+    }
+    CtLogBackend::instance().flush();
+    auto written = std::chrono::steady_clock::now();
+
+    std::sort(latencies.begin(), latencies.end());
+    std::cerr << p_name << " median " << latencies[latencies.size() / 2] << " ns"
+              << ", p99 " << latencies[latencies.size() * 99 / 100] << " ns"
+              << ", written in " << std::chrono::duration_cast<std::chrono::milliseconds>(written - start).count() << " ms" << std::endl;
+}
+
+// print the records of a binary log file
+CtUInt32 decode(const CtString& p_fileName, CtUInt32 p_max) {
+    CtLogBinaryReader reader(p_fileName);
+    CtString line;
+    CtUInt32 count = 0;
+    while (reader.read(&line)) {
+        if (count < p_max) {
+            std::cout << line << '\n';
+        }
+        count++;
+    }
+    return count;
+}
+
+// without arguments: benchmark and decode the first records of the binary log
+// with a file argument: decode the whole binary log, e.g. ex14_logger_binary ex14.ctlog > ex14.log
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        decode(argv[1], UINT32_MAX);
+        return 0;
+    }
+    CtLogBackend::instance().setQueueSize(32 * 1024 * 1024);
+    CtLogBackend::instance().setOverflow(CtLogBackend::Overflow::Block);
+
+    benchmark("text,   formatted by caller ", CT_TRUE, CT_FALSE);
+    benchmark("text,   formatted by backend", CT_FALSE, CT_FALSE);
+    benchmark("binary, never formatted     ", CT_FALSE, CT_TRUE);
+
+    auto start = std::chrono::steady_clock::now();
+    CtUInt32 records = decode(LOG_FILE, 3);
+    auto end = std::chrono::steady_clock::now();
+    std::cerr << "decoded " << records << " records in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+    return 0;
+}
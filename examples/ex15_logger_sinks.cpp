@@ -0,0 +1,83 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file ex15_logger_sinks.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "cpptoolkit.hpp"
+
+#include <chrono>
+#include <iostream>
+
+#define MESSAGES    200000u
+#define LOG_FILE    "ex15.log"
+#define UDP_PORT    5514
+
+// log MESSAGES lines through the given sinks and print how long the backend needed to write them
+void benchmark(const CtString& p_name, const std::vector<std::shared_ptr<CtLogSink>>& p_sinks) {
+    CtLogger logger(CtLogger::Level::DEBUG, "EX15");
+    logger.setMode(CtLogger::Mode::Async);
+    for (const auto& sink : p_sinks) {
+        logger.addSink(sink);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (CtUInt32 idx = 0; idx < MESSAGES; idx++) {
+        if (idx % 100 == 0) {
+            logger.log_warning("order {} rejected, price {:.2} outside band", idx, 101.25 + idx % 7);
+        } else {
+            logger.log_debug("order {} filled at {:.2} quantity {}", idx, 101.25 + idx % 7, 100 * (1 + idx % 5));
+        }
+    }
+    CtLogBackend::instance().flush();
+    auto end = std::chrono::steady_clock::now();
+    std::cout << p_name << ": " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+}
+
+int main() {
+    CtLogBackend::instance().setQueueSize(32 * 1024 * 1024);
+    CtLogBackend::instance().setOverflow(CtLogBackend::Overflow::Block);
+
+    // everything in a rotating file, warnings to a syslog collector, the recent detail in memory
+    auto file = std::make_shared<CtLogFileSink>(LOG_FILE, CtLogger::Level::DEBUG);
+    file->setMaxSize(8 * 1024 * 1024);
+    file->setMaxFiles(3);
+    auto syslog = std::make_shared<CtLogUdpSink>(CtNetAddress("127.0.0.1", UDP_PORT), CtLogger::Level::WARNING);
+    auto ring = std::make_shared<CtLogMemorySink>(64 * 1024);
+    CtLogMemorySink::installCrashHandler();
+
+    // the line is formatted once however many sinks receive it
+    benchmark("file sink                ", { file });
+    benchmark("file, syslog, memory sink", { file, syslog, ring });
+
+    // a critical line dumps the recent history kept in memory to stderr
+    CtLogger logger(CtLogger::Level::DEBUG, "EX15");
+    logger.addSink(ring);
+    ring->setLevel(CtLogger::Level::DEBUG);
+    logger.log_debug("connection state {}", "degraded");
+    logger.log_critical("connection lost");
+    return 0;
+}
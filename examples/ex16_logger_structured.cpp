@@ -0,0 +1,63 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file ex16_logger_structured.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "cpptoolkit.hpp"
+
+#include <string>
+
+#define REQUESTS    4u
+
+int main() {
+    CtLogger json(CtLogger::Level::DEBUG, "EX16");
+    json.setMode(CtLogger::Mode::Async);
+    json.setEncoding(CtLogger::Encoding::Json);
+
+    CtLogger logfmt(CtLogger::Level::DEBUG, "EX16");
+    logfmt.setEncoding(CtLogger::Encoding::Logfmt);
+
+    // named arguments become fields of the record, unnamed ones only appear in the message
+    json.log_info("order {order} filled at {price:.2}, attempt {}", 42, 101.25, 1);
+    logfmt.log_info("order {order} filled at {price:.2}, attempt {}", 42, 101.25, 1);
+
+    // each task runs with the request id it serves in its log context
+    CtWorkerPool pool(2);
+    for (CtUInt32 idx = 0; idx < REQUESTS; idx++) {
+        CtLogContext context;
+        context.add("request_id", "req-" + std::to_string(idx));
+        CtTask task;
+        task.setTaskFunc([&json, idx]() {
+            json.log_debug("handling request {step}", "parse");
+            json.log_info("request {latency_us} us", 50 + idx * 10);
+        });
+        pool.addTask(task, context);
+    }
+    pool.join();
+    return 0;
+}
@@ -35,6 +35,9 @@ SOFTWARE.
 #include "core/definitions.hpp"
 #include "core/CtTypes.hpp"
 #include "core/CtHelpers.hpp"
+#include "core/CtRingBuffer.hpp"
+#include "core/CtRawDataPool.hpp"
+#include "core/CtSharedData.hpp"
 #include "core/CtExceptions.hpp"
 
 #endif //INCLUDE_CORE_HPP_
\ No newline at end of file
@@ -146,11 +146,17 @@ namespace CtSocketHelpers {
      * @brief Get address of a specific interface.
      * 
      * @ref FR-001-002-102
+     * @ref FR-001-002-104
+     * 
+     * @details
+     * IPv6 link-local addresses are returned with the %interface suffix, so that they can be
+     * parsed by CtNetAddress.
      * 
      * @param p_ifName The name of the interface.
+     * @param p_family AF_INET for the IPv4 address, AF_INET6 for the IPv6 address.
      * @return CtString The address of the interface.
      */
-    EXPORTED_API CtString interfaceToAddress(const CtString& p_ifName);
+    EXPORTED_API CtString interfaceToAddress(const CtString& p_ifName, CtInt32 p_family = AF_INET);
 
     /**
      * @brief Convert address to uin32_t
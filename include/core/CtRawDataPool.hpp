@@ -0,0 +1,157 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtRawDataPool.hpp
+ * @brief Header file for the buffer pool of CtRawData.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTRAWDATAPOOL_HPP_
+#define INCLUDE_CTRAWDATAPOOL_HPP_
+
+#include "core/definitions.hpp"
+#include "core/CtTypes.hpp"
+#include "core/CtRingBuffer.hpp"
+
+#include <memory>
+
+/**
+ * @brief Default number of free buffers kept per size class.
+ * 
+ */
+#define CT_POOL_CACHED          256u
+
+/**
+ * @brief Smallest size class is 2^CT_POOL_MIN_SHIFT bytes.
+ * 
+ */
+#define CT_POOL_MIN_SHIFT       6u
+
+/**
+ * @brief Largest size class is 2^CT_POOL_MAX_SHIFT bytes. Larger buffers are not pooled.
+ * 
+ */
+#define CT_POOL_MAX_SHIFT       20u
+
+/**
+ * @brief A thread-safe pool of byte buffers grouped in power of two size classes.
+ * 
+ * @ref FR-001-005-001
+ * 
+ * @details
+ * Every size class keeps its free buffers in a lock-free CtRingBuffer, so acquiring and
+ * releasing a buffer is allocation-free once the pool is warm. A request is served from
+ * the smallest class that fits and the returned capacity is the size of that class.
+ * Buffers that do not fit in a full free list, or that are larger than the largest class,
+ * are returned to the heap. Buffers must be released to the pool they were acquired from
+ * and the pool must outlive them.
+ * 
+ * @code {.cpp}
+ * CtRawDataPool pool;
+ * {
+ *     CtRawData data(1500, &pool);    // buffer of 2048 bytes allocated by the pool
+ * }                                   // buffer is returned to the pool
+ * CtRawData data(1200, &pool);        // the same buffer is reused
+ * @endcode
+ * 
+ */
+class CtRawDataPool {
+public:
+    /**
+     * @brief Constructor for CtRawDataPool.
+     * 
+     * @ref FR-001-005-002
+     * 
+     * @param p_maxCached The maximum number of free buffers kept per size class.
+     */
+    EXPORTED_API explicit CtRawDataPool(CtUInt32 p_maxCached = CT_POOL_CACHED);
+
+    /**
+     * @brief Destructor for CtRawDataPool. All cached buffers are freed.
+     * 
+     * @ref FR-001-005-002
+     * 
+     */
+    EXPORTED_API ~CtRawDataPool();
+
+    CtRawDataPool(const CtRawDataPool&) = delete;
+    CtRawDataPool& operator=(const CtRawDataPool&) = delete;
+
+    /**
+     * @brief Get a buffer of at least p_size bytes.
+     * 
+     * @ref FR-001-005-003
+     * 
+     * @param p_size The minimum size of the buffer.
+     * @param p_capacity Where the actual size of the buffer is stored.
+     * @return CtUInt8* Pointer to the buffer.
+     */
+    EXPORTED_API CtUInt8* acquire(CtUInt32 p_size, CtUInt32& p_capacity);
+
+    /**
+     * @brief Give a buffer back to the pool.
+     * 
+     * @ref FR-001-005-004
+     * 
+     * @param p_buffer The buffer returned by acquire().
+     * @param p_capacity The capacity returned by acquire().
+     */
+    EXPORTED_API void release(CtUInt8* p_buffer, CtUInt32 p_capacity);
+
+    /**
+     * @brief The number of buffers allocated from the heap by the pool.
+     * 
+     * @ref FR-001-005-005
+     * 
+     * @return CtUInt64 The number of heap allocations.
+     */
+    EXPORTED_API CtUInt64 getAllocations();
+
+    /**
+     * @brief Process wide pool. It is never destroyed so it can be used by static objects as well.
+     * 
+     * @ref FR-001-005-006
+     * 
+     * @return CtRawDataPool& The global pool.
+     */
+    EXPORTED_API static CtRawDataPool& global();
+
+private:
+    /**
+     * @brief Get the size class of a buffer size.
+     * 
+     * @param p_size The buffer size.
+     * @return CtUInt32 The size class index. It is equal to the number of classes if the size is not pooled.
+     */
+    static CtUInt32 sizeClass(CtUInt32 p_size);
+
+private:
+    static constexpr CtUInt32 m_classes = CT_POOL_MAX_SHIFT - CT_POOL_MIN_SHIFT + 1;    /*!< Number of size classes. */
+    std::unique_ptr<CtRingBuffer<CtUInt8*>> m_free[m_classes];                          /*!< Free buffers of each size class. */
+    CtAtomic<CtUInt64> m_allocations;                                                   /*!< Heap allocations performed. */
+};
+
+#endif //INCLUDE_CTRAWDATAPOOL_HPP_
@@ -0,0 +1,263 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtRingBuffer.hpp
+ * @brief Header file for the lock-free bounded ring buffer.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTRINGBUFFER_HPP_
+#define INCLUDE_CTRINGBUFFER_HPP_
+
+#include "core/definitions.hpp"
+#include "core/CtTypes.hpp"
+
+#include <memory>
+
+/**
+ * @brief Cache line size used to keep producer and consumer counters apart.
+ * 
+ */
+#define CT_CACHE_LINE_SIZE  64u
+
+/**
+ * @brief A lock-free bounded multi-producer multi-consumer ring buffer.
+ * 
+ * @ref FR-001-004-001
+ * 
+ * @details
+ * The ring has a fixed number of slots that are allocated once during construction.
+ * The capacity is rounded up to the next power of two. Every slot carries a sequence
+ * number that tells producers and consumers whether the slot is free or filled, so
+ * neither side takes a lock. A full ring rejects new items and an empty ring returns
+ * nothing, leaving it to the caller to decide whether to retry, block or drop.
+ * 
+ * @code {.cpp}
+ * CtRingBuffer<CtUInt32> ring(1024);
+ * ring.tryPush(10);
+ * CtUInt32 value;
+ * if (ring.tryPop(value)) {
+ *     // value == 10
+ * }
+ * @endcode
+ * 
+ * @tparam T The type of the stored items. It must be default constructible and movable.
+ */
+template <typename T>
+class CtRingBuffer {
+public:
+    /**
+     * @brief Constructor for CtRingBuffer.
+     * 
+     * @ref FR-001-004-002
+     * 
+     * @param p_capacity The minimum number of slots. It is rounded up to the next power of two.
+     */
+    EXPORTED_API explicit CtRingBuffer(CtUInt32 p_capacity);
+
+    /**
+     * @brief Destructor for CtRingBuffer.
+     * 
+     * @ref FR-001-004-002
+     */
+    EXPORTED_API ~CtRingBuffer() = default;
+
+    CtRingBuffer(const CtRingBuffer&) = delete;
+    CtRingBuffer& operator=(const CtRingBuffer&) = delete;
+
+    /**
+     * @brief Try to push an item to the ring.
+     * 
+     * @ref FR-001-004-003
+     * 
+     * @param p_item The item to be moved into the ring.
+     * @return CtBool CT_TRUE if the item was stored, CT_FALSE if the ring is full.
+     */
+    EXPORTED_API CtBool tryPush(T&& p_item);
+
+    /**
+     * @brief Try to push a copy of an item to the ring.
+     * 
+     * @ref FR-001-004-003
+     * 
+     * @param p_item The item to be copied into the ring.
+     * @return CtBool CT_TRUE if the item was stored, CT_FALSE if the ring is full.
+     */
+    EXPORTED_API CtBool tryPush(const T& p_item);
+
+    /**
+     * @brief Try to pop the oldest item of the ring.
+     * 
+     * @ref FR-001-004-004
+     * 
+     * @param p_item Where the popped item is moved to.
+     * @return CtBool CT_TRUE if an item was popped, CT_FALSE if the ring is empty.
+     */
+    EXPORTED_API CtBool tryPop(T& p_item);
+
+    /**
+     * @brief The number of slots of the ring.
+     * 
+     * @ref FR-001-004-005
+     * 
+     * @return CtUInt32 The capacity of the ring.
+     */
+    EXPORTED_API CtUInt32 capacity() const;
+
+    /**
+     * @brief The number of items currently stored in the ring.
+     *      The value is a snapshot and may already be stale when concurrent access takes place.
+     * 
+     * @ref FR-001-004-005
+     * 
+     * @return CtUInt32 The number of stored items.
+     */
+    EXPORTED_API CtUInt32 size() const;
+
+    /**
+     * @brief Check if the ring is empty.
+     *      The value is a snapshot and may already be stale when concurrent access takes place.
+     * 
+     * @ref FR-001-004-005
+     * 
+     * @return CtBool CT_TRUE if the ring is empty, CT_FALSE otherwise.
+     */
+    EXPORTED_API CtBool empty() const;
+
+private:
+    /**
+     * @brief Push helper shared by the copy and the move version of tryPush().
+     * 
+     * @param p_item The item to be forwarded into the ring.
+     * @return CtBool CT_TRUE if the item was stored, CT_FALSE if the ring is full.
+     */
+    template <typename U>
+    CtBool push(U&& p_item);
+
+private:
+    /**
+     * @brief A ring slot that holds the item and its sequence number.
+     * 
+     */
+    typedef struct _CtRingCell {
+        CtAtomic<CtUInt64> sequence;
+        T data;
+    } CtRingCell;
+
+    std::unique_ptr<CtRingCell[]> m_cells;                          /*!< The ring slots. */
+    CtUInt64 m_mask;                                                /*!< Index mask (capacity - 1). */
+    alignas(CT_CACHE_LINE_SIZE) CtAtomic<CtUInt64> m_enqueuePos;    /*!< Next position to be written by producers. */
+    alignas(CT_CACHE_LINE_SIZE) CtAtomic<CtUInt64> m_dequeuePos;    /*!< Next position to be read by consumers. */
+};
+
+template <typename T>
+CtRingBuffer<T>::CtRingBuffer(CtUInt32 p_capacity) : m_enqueuePos(0), m_dequeuePos(0) {
+    CtUInt64 s_capacity = 2;
+    while (s_capacity < p_capacity) {
+        s_capacity <<= 1;
+    }
+    m_mask = s_capacity - 1;
+    m_cells = std::make_unique<CtRingCell[]>(s_capacity);
+    for (CtUInt64 idx = 0; idx < s_capacity; idx++) {
+        m_cells[idx].sequence.store(idx, std::memory_order_relaxed);
+    }
+};
+
+template <typename T>
+CtBool CtRingBuffer<T>::tryPush(T&& p_item) {
+    return push(std::move(p_item));
+};
+
+template <typename T>
+CtBool CtRingBuffer<T>::tryPush(const T& p_item) {
+    return push(p_item);
+};
+
+template <typename T>
+template <typename U>
+CtBool CtRingBuffer<T>::push(U&& p_item) {
+    CtRingCell* s_cell;
+    CtUInt64 s_pos = m_enqueuePos.load(std::memory_order_relaxed);
+    while (CT_TRUE) {
+        s_cell = &m_cells[s_pos & m_mask];
+        CtUInt64 s_seq = s_cell->sequence.load(std::memory_order_acquire);
+        CtInt64 s_diff = (CtInt64)s_seq - (CtInt64)s_pos;
+        if (s_diff == 0) {
+            if (m_enqueuePos.compare_exchange_weak(s_pos, s_pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (s_diff < 0) {
+            return CT_FALSE;
+        } else {
+            s_pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    s_cell->data = std::forward<U>(p_item);
+    s_cell->sequence.store(s_pos + 1, std::memory_order_release);
+    return CT_TRUE;
+};
+
+template <typename T>
+CtBool CtRingBuffer<T>::tryPop(T& p_item) {
+    CtRingCell* s_cell;
+    CtUInt64 s_pos = m_dequeuePos.load(std::memory_order_relaxed);
+    while (CT_TRUE) {
+        s_cell = &m_cells[s_pos & m_mask];
+        CtUInt64 s_seq = s_cell->sequence.load(std::memory_order_acquire);
+        CtInt64 s_diff = (CtInt64)s_seq - (CtInt64)(s_pos + 1);
+        if (s_diff == 0) {
+            if (m_dequeuePos.compare_exchange_weak(s_pos, s_pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (s_diff < 0) {
+            return CT_FALSE;
+        } else {
+            s_pos = m_dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+    p_item = std::move(s_cell->data);
+    s_cell->sequence.store(s_pos + m_mask + 1, std::memory_order_release);
+    return CT_TRUE;
+};
+
+template <typename T>
+CtUInt32 CtRingBuffer<T>::capacity() const {
+    return (CtUInt32)(m_mask + 1);
+};
+
+template <typename T>
+CtUInt32 CtRingBuffer<T>::size() const {
+    CtUInt64 s_enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+    CtUInt64 s_dequeuePos = m_dequeuePos.load(std::memory_order_acquire);
+    return (s_enqueuePos > s_dequeuePos) ? (CtUInt32)(s_enqueuePos - s_dequeuePos) : 0;
+};
+
+template <typename T>
+CtBool CtRingBuffer<T>::empty() const {
+    return size() == 0;
+};
+
+#endif //INCLUDE_CTRINGBUFFER_HPP_
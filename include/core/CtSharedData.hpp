@@ -0,0 +1,224 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtSharedData.hpp
+ * @brief Header file for the reference counted immutable buffer.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTSHAREDDATA_HPP_
+#define INCLUDE_CTSHAREDDATA_HPP_
+
+#include "core/definitions.hpp"
+#include "core/CtTypes.hpp"
+
+/**
+ * @brief An immutable, atomically reference counted buffer made of one or more segments.
+ * 
+ * @ref FR-001-006-001
+ * 
+ * @details
+ * Copying a CtSharedData only increments a reference counter, so one buffer can be handed to
+ * many consumers and threads without copying the bytes. The bytes are freed, or returned to
+ * their CtRawDataPool, when the last copy is destroyed. A CtRawData can be moved into a
+ * CtSharedData so that a received buffer is shared without any copy at all.
+ * 
+ * Buffers can be chained with append(), which links the segments of both buffers into a new
+ * CtSharedData without copying bytes. Every segment can be accessed as a CtRawDataView.
+ * 
+ * @code {.cpp}
+ * CtRawData data;
+ * socket.receive(&data);
+ * CtSharedData shared(std::move(data));   // no copy
+ * fileOutput.write(shared);               // the async writer keeps a reference
+ * CtSharedData copy = shared;             // no copy
+ * CtSharedData message = header.append(shared);
+ * @endcode
+ */
+class CtSharedData {
+public:
+    /**
+     * @brief Constructs an empty CtSharedData.
+     * 
+     * @ref FR-001-006-002
+     * 
+     */
+    EXPORTED_API CtSharedData();
+
+    /**
+     * @brief Constructs a CtSharedData taking over the buffer of a CtRawData without copying.
+     *      p_data is left empty with zero maximum size.
+     * 
+     * @ref FR-001-006-002
+     * 
+     * @param p_data The CtRawData object to move from.
+     */
+    EXPORTED_API explicit CtSharedData(CtRawData&& p_data);
+
+    /**
+     * @brief Constructs a CtSharedData by copying bytes once.
+     * 
+     * @ref FR-001-006-002
+     * 
+     * @param p_data The view of the bytes to be copied.
+     */
+    EXPORTED_API explicit CtSharedData(const CtRawDataView& p_data);
+
+    /**
+     * @brief Copy constructor. Only the reference counter is incremented.
+     * 
+     * @ref FR-001-006-003
+     * 
+     * @param p_data The CtSharedData to share.
+     */
+    EXPORTED_API CtSharedData(const CtSharedData& p_data);
+
+    /**
+     * @brief Move constructor. p_data is left empty.
+     * 
+     * @ref FR-001-006-003
+     * 
+     * @param p_data The CtSharedData to move from.
+     */
+    EXPORTED_API CtSharedData(CtSharedData&& p_data) noexcept;
+
+    /**
+     * @brief Destructor. The bytes are freed when the last reference is destroyed.
+     * 
+     * @ref FR-001-006-004
+     * 
+     */
+    EXPORTED_API ~CtSharedData();
+
+    /**
+     * @brief Copy assignment operator. Only the reference counter is incremented.
+     * 
+     * @ref FR-001-006-003
+     * 
+     * @param other The CtSharedData to share.
+     * @return CtSharedData& Reference to the current object.
+     */
+    EXPORTED_API CtSharedData& operator=(const CtSharedData& other);
+
+    /**
+     * @brief Move assignment operator. other is left empty.
+     * 
+     * @ref FR-001-006-003
+     * 
+     * @param other The CtSharedData to move from.
+     * @return CtSharedData& Reference to the current object.
+     */
+    EXPORTED_API CtSharedData& operator=(CtSharedData&& other) noexcept;
+
+    /**
+     * @brief The total number of bytes of all segments.
+     * 
+     * @ref FR-001-006-005
+     * 
+     * @return CtUInt32 The number of bytes.
+     */
+    EXPORTED_API CtUInt32 size() const;
+
+    /**
+     * @brief Check if there are no bytes.
+     * 
+     * @ref FR-001-006-005
+     * 
+     * @return CtBool CT_TRUE if empty.
+     */
+    EXPORTED_API CtBool empty() const;
+
+    /**
+     * @brief The number of segments.
+     * 
+     * @ref FR-001-006-005
+     * 
+     * @return CtUInt32 The number of segments.
+     */
+    EXPORTED_API CtUInt32 segments() const;
+
+    /**
+     * @brief Get a view of a segment.
+     *      If the index is out of range an exception will be thrown - CtOutOfRangeError()
+     * 
+     * @ref FR-001-006-005
+     * 
+     * @param p_idx The segment index.
+     * @return CtRawDataView The view of the segment.
+     */
+    EXPORTED_API CtRawDataView segment(CtUInt32 p_idx) const;
+
+    /**
+     * @brief The number of CtSharedData objects that share these bytes.
+     * 
+     * @ref FR-001-006-003
+     * 
+     * @return CtUInt32 The reference count. Zero if empty.
+     */
+    EXPORTED_API CtUInt32 useCount() const;
+
+    /**
+     * @brief Create a CtSharedData with the segments of this object followed by the segments of p_data.
+     *      No bytes are copied and both objects stay unchanged.
+     * 
+     * @ref FR-001-006-006
+     * 
+     * @param p_data The data to be appended.
+     * @return CtSharedData The chained data.
+     */
+    EXPORTED_API CtSharedData append(const CtSharedData& p_data) const;
+
+    /**
+     * @brief Copy all segments to a CtRawData.
+     *      If the data do not fit an exception will be thrown - CtOutOfRangeError()
+     * 
+     * @ref FR-001-006-007
+     * 
+     * @param p_data Where the bytes are copied.
+     */
+    EXPORTED_API void copyTo(CtRawData* p_data) const;
+
+private:
+    struct CtSharedChain;
+
+    /**
+     * @brief Constructs a CtSharedData from a chain that is already referenced.
+     * 
+     * @param p_chain The chain.
+     */
+    explicit CtSharedData(CtSharedChain* p_chain);
+
+    /**
+     * @brief Drop the reference to the chain.
+     * 
+     */
+    void release();
+
+private:
+    CtSharedChain* m_chain;                     /*!< The shared chain of segments or nullptr if empty. */
+};
+
+#endif //INCLUDE_CTSHAREDDATA_HPP_
@@ -41,6 +41,9 @@ SOFTWARE.
 #include <queue>
 #include <atomic>
 #include <map>
+#include <span>
+#include <netinet/in.h>
+#include <sys/socket.h>
 
 /**
  * @brief Typedefs for basic types.
@@ -79,19 +82,157 @@ SOFTWARE.
 #define CT_TRUE         1u
 #define CT_FALSE        0u
 
+class CtRawDataPool;
+class CtRawDataView;
+
+/**
+ * @brief Enum selecting the IP version of a socket.
+ * 
+ * @ref FR-001-003-029
+ * 
+ */
+enum class CtNetFamily {
+    Ipv4,       /**< IPv4 only, AF_INET. */
+    Ipv6,       /**< IPv6 only, AF_INET6 with IPV6_V6ONLY. */
+    DualStack   /**< IPv6 socket that also serves IPv4 peers through IPv4-mapped addresses. */
+};
+
 /**
- * @brief Struct describing a network address.
+ * @class CtNetAddress
+ * @brief Class describing a network address.
  * 
  * @ref FR-001-003-001
+ * @ref FR-001-003-028
  * 
  * @details
- * The network address is described by the IP address and the port number.
+ * The network address is described by the IP address and the port number. It is stored in binary
+ * form as the socket address itself, so sockets receive sender addresses directly into it and
+ * send to it without any conversion. The address is formatted as text only when getAddress() is
+ * called. IPv4 and IPv6 addresses are supported.
+ * 
+ * @code {.cpp}
+ * CtNetAddress address("::1", 5000);
+ * socket.setPub(address);
+ * CtNetAddress sender;
+ * socket.receive(&message, &sender);
+ * std::cout << sender.getAddress() << ":" << sender.getPort() << std::endl;
+ * @endcode
  * 
  */
-typedef struct _CtNetAddress {
-    CtString addr;
-    CtUInt16 port;
-} CtNetAddress;
+class CtNetAddress {
+public:
+    /**
+     * @brief Constructs an unspecified address.
+     * 
+     * @ref FR-001-003-028
+     * 
+     */
+    EXPORTED_API CtNetAddress();
+
+    /**
+     * @brief Constructs an address from its text form and a port.
+     *      If the address cannot be parsed an exception will be thrown - CtTypeParseError()
+     * 
+     * @ref FR-001-003-028
+     * 
+     * @details
+     * IPv4 addresses are given in dotted form and IPv6 addresses in colon form, optionally followed
+     * by %interface for link-local addresses.
+     * 
+     * @param p_addr The IP address.
+     * @param p_port The port number.
+     */
+    EXPORTED_API CtNetAddress(const CtString& p_addr, CtUInt16 p_port);
+
+    /**
+     * @brief The address family, AF_INET, AF_INET6 or AF_UNSPEC.
+     * 
+     * @ref FR-001-003-028
+     * 
+     * @return CtInt32 The address family.
+     */
+    EXPORTED_API CtInt32 getFamily() const;
+
+    /**
+     * @brief The IP address in text form.
+     * 
+     * @ref FR-001-003-028
+     * 
+     * @return CtString The IP address, empty if unspecified.
+     */
+    EXPORTED_API CtString getAddress() const;
+
+    /**
+     * @brief The port number.
+     * 
+     * @ref FR-001-003-028
+     * 
+     * @return CtUInt16 The port number in host byte order.
+     */
+    EXPORTED_API CtUInt16 getPort() const;
+
+    /**
+     * @brief Set the port number.
+     * 
+     * @ref FR-001-003-028
+     * 
+     * @param p_port The port number in host byte order.
+     */
+    EXPORTED_API void setPort(CtUInt16 p_port);
+
+    /**
+     * @brief Convert an IPv4 address to the IPv4-mapped IPv6 address used by dual-stack sockets.
+     * 
+     * @ref FR-001-003-029
+     * 
+     * @return CtNetAddress The mapped address, or a copy if the address is not IPv4.
+     */
+    EXPORTED_API CtNetAddress toIpv6() const;
+
+    /**
+     * @brief The socket address, to be passed to socket calls.
+     * 
+     * @ref FR-001-003-028
+     * 
+     * @return const struct sockaddr* The socket address.
+     */
+    EXPORTED_API const struct sockaddr* getSockAddr() const;
+
+    /**
+     * @brief The socket address to be filled by socket calls. It can hold sizeof(sockaddr_in6) bytes.
+     * 
+     * @ref FR-001-003-028
+     * 
+     * @return struct sockaddr* The socket address.
+     */
+    EXPORTED_API struct sockaddr* getSockAddr();
+
+    /**
+     * @brief The length of the socket address according to its family.
+     * 
+     * @ref FR-001-003-028
+     * 
+     * @return socklen_t The length in bytes.
+     */
+    EXPORTED_API socklen_t getSockLength() const;
+
+    /**
+     * @brief Compare the family, IP address and port of two addresses, and the scope of IPv6 addresses.
+     * 
+     * @ref FR-001-003-028
+     * 
+     * @param p_other The address to compare to.
+     * @return CtBool CT_TRUE if the addresses are equal.
+     */
+    EXPORTED_API CtBool operator==(const CtNetAddress& p_other) const;
+
+private:
+    union {
+        struct sockaddr base;
+        struct sockaddr_in v4;
+        struct sockaddr_in6 v6;
+    } m_address;                                /*!< The socket address. */
+};
 
 /**
  * @brief Struct describing raw data buffer.
@@ -104,6 +245,8 @@ typedef struct _CtNetAddress {
  * The buffer has a prespecified size that can be filled with bytes. It can monitor the 
  * size of the buffer that it is currently used and it ensures that the buffer will not 
  * overflow. If an overflow occurs an exception will be thrown - CtOutOfRangeError().
+ * A growable buffer doubles its maximum size instead of throwing. The memory can be taken
+ * from a CtRawDataPool so that buffers are reused instead of being allocated every time.
  * 
  * @code {.cpp}
  * CtRawData data;
@@ -130,6 +273,17 @@ public:
      */
     EXPORTED_API explicit CtRawData(CtUInt32 p_size = CT_BUFFER_SIZE);
 
+    /**
+     * @brief CtRawData constructor that takes its memory from a pool.
+     *      The memory is returned to the pool on destruction.
+     * 
+     * @ref FR-001-003-020
+     * 
+     * @param p_size The size of the buffer.
+     * @param p_pool The pool to be used. If nullptr the memory is allocated from the heap.
+     */
+    EXPORTED_API CtRawData(CtUInt32 p_size, CtRawDataPool* p_pool);
+
     /**
      * @brief CtRawData copy constructor.
      * 
@@ -138,8 +292,19 @@ public:
      * @ref FR-001-003-007
      * 
      * @param p_data Another CtRawData object that it is used to init the currently created.
+     *      The new object uses the same pool and is growable if p_data is growable.
+     */
+    EXPORTED_API CtRawData(const CtRawData& p_data);
+
+    /**
+     * @brief CtRawData move constructor. The buffer is taken over without copying
+     *      and p_data is left empty with zero maximum size.
+     * 
+     * @ref FR-001-003-024
+     * 
+     * @param p_data The CtRawData object to move from.
      */
-    EXPORTED_API CtRawData(CtRawData& p_data);
+    EXPORTED_API CtRawData(CtRawData&& p_data) noexcept;
 
     /**
      * @brief Destructor.
@@ -206,7 +371,7 @@ public:
      * 
      * @return CtUInt32 The actual size of the buffer.
      */
-    EXPORTED_API CtUInt32 size();
+    EXPORTED_API CtUInt32 size() const;
 
     /**
      * @brief The max size of the buffer.
@@ -216,7 +381,7 @@ public:
      * 
      * @return CtUInt32 The max size of the buffer.
      */
-    EXPORTED_API CtUInt32 maxSize();
+    EXPORTED_API CtUInt32 maxSize() const;
 
     /**
      * @brief This method returns a pointer to the buffer data.
@@ -227,6 +392,25 @@ public:
      */
     EXPORTED_API CtUInt8* get();
 
+    /**
+     * @brief This method returns a read-only pointer to the buffer data.
+     * 
+     * @ref FR-001-003-014
+     * 
+     * @return const CtUInt8* Pointer to the buffer data. 
+     */
+    EXPORTED_API const CtUInt8* get() const;
+
+    /**
+     * @brief This method returns a non-owning view of the actual data.
+     *      The view is valid as long as the buffer is not modified or destroyed.
+     * 
+     * @ref FR-001-003-025
+     * 
+     * @return CtRawDataView The view of the data.
+     */
+    EXPORTED_API CtRawDataView view() const;
+
     /**
      * @brief This method fills the buffer with the data given in the parameters.
      *   This method overwrites the buffer and the actual size. The maximum size of the buffer is preserved.
@@ -253,7 +437,7 @@ public:
      * @param p_data A CtRawData object to be cloned.
      * @return void
      */
-    EXPORTED_API void clone(CtRawData& p_data);
+    EXPORTED_API void clone(const CtRawData& p_data);
 
     /**
      * @brief This method resets the buffer to 0 size. The allocated memory is not freed.
@@ -275,12 +459,201 @@ public:
      * 
      * @return CtRawData& Reference to the current CtRawData object.
      */
-    EXPORTED_API CtRawData& operator=(CtRawData& other);
+    EXPORTED_API CtRawData& operator=(const CtRawData& other);
+
+    /**
+     * @brief Move assignment operator for CtRawData.
+     * The buffer of other is taken over without copying and other is left empty with zero maximum size.
+     * 
+     * @ref FR-001-003-024
+     * 
+     * @param other The CtRawData object to move from.
+     * 
+     * @return CtRawData& Reference to the current CtRawData object.
+     */
+    EXPORTED_API CtRawData& operator=(CtRawData&& other) noexcept;
+
+    /**
+     * @brief Enable or disable automatic growth. A growable buffer doubles its maximum size
+     *      when it is full instead of throwing CtOutOfRangeError().
+     * 
+     * @ref FR-001-003-021
+     * 
+     * @param p_growable CT_TRUE to enable growth.
+     */
+    EXPORTED_API void setGrowable(CtBool p_growable);
+
+    /**
+     * @brief Check if the buffer grows automatically.
+     * 
+     * @ref FR-001-003-021
+     * 
+     * @return CtBool CT_TRUE if the buffer is growable.
+     */
+    EXPORTED_API CtBool isGrowable() const;
+
+    /**
+     * @brief Raise the maximum size of the buffer. The data are preserved.
+     *      Nothing happens if the maximum size is already large enough.
+     * 
+     * @ref FR-001-003-022
+     * 
+     * @param p_size The new maximum size.
+     */
+    EXPORTED_API void reserve(CtUInt32 p_size);
+
+    /**
+     * @brief Set the actual size of the buffer, e.g. after the buffer was filled through get().
+     *      If the size is greater than the maximum size the buffer grows if it is growable,
+     *      otherwise an exception will be thrown - CtOutOfRangeError()
+     * 
+     * @ref FR-001-003-023
+     * @ref FR-001-003-019
+     * 
+     * @param p_size The new actual size.
+     */
+    EXPORTED_API void resize(CtUInt32 p_size);
+
+private:
+    friend class CtSharedData;
+
+    /**
+     * @brief Make sure that the buffer can hold p_size bytes. It grows geometrically
+     *      if the buffer is growable, otherwise CtOutOfRangeError() is thrown.
+     * 
+     * @param p_size The number of bytes needed.
+     */
+    void ensure(CtUInt32 p_size);
+
+    /**
+     * @brief Move the data to a new buffer of at least p_capacity bytes.
+     * 
+     * @param p_capacity The minimum capacity of the new buffer.
+     */
+    void reallocate(CtUInt32 p_capacity);
+
+    /**
+     * @brief Free the buffer or give it back to the pool.
+     * 
+     */
+    void release();
 
 private:
     CtUInt8* m_data;                            /*!< The buffer data. */
     CtUInt32 m_size;                            /*!< The actual size of the buffer. */
-    const CtUInt32 m_maxSize;                   /*!< The maximum size of the buffer. */
+    CtUInt32 m_maxSize;                         /*!< The maximum size of the buffer. */
+    CtUInt32 m_capacity;                        /*!< The allocated size of the buffer. */
+    CtRawDataPool* m_pool;                      /*!< The pool of the buffer or nullptr. */
+    CtBool m_growable;                          /*!< The buffer grows instead of throwing. */
+};
+
+/**
+ * @brief A non-owning view of a contiguous range of bytes.
+ * 
+ * @ref FR-001-003-026
+ * 
+ * @details
+ * The view holds a pointer and a length, so it is cheap to pass by value. It does not manage
+ * the lifetime of the bytes, which must outlive the view. A view can be created from a CtRawData,
+ * a raw buffer or a std::span and can be narrowed with subview() without copying.
+ * 
+ * @code {.cpp}
+ * CtRawData data;
+ * data.clone((const CtUInt8*)"header:payload", 14);
+ * CtRawDataView payload = data.view().subview(7);   // "payload"
+ * std::span<const CtUInt8> bytes = payload.span();
+ * @endcode
+ */
+class CtRawDataView {
+public:
+    /**
+     * @brief Constructs an empty view.
+     * 
+     * @ref FR-001-003-026
+     * 
+     */
+    EXPORTED_API CtRawDataView();
+
+    /**
+     * @brief Constructs a view of a raw buffer.
+     * 
+     * @ref FR-001-003-026
+     * 
+     * @param p_data Pointer to the bytes.
+     * @param p_size The number of bytes.
+     */
+    EXPORTED_API CtRawDataView(const CtUInt8* p_data, CtUInt32 p_size);
+
+    /**
+     * @brief Constructs a view of the actual data of a CtRawData.
+     * 
+     * @ref FR-001-003-026
+     * 
+     * @param p_data The CtRawData object.
+     */
+    EXPORTED_API explicit CtRawDataView(const CtRawData& p_data);
+
+    /**
+     * @brief Constructs a view of a std::span.
+     * 
+     * @ref FR-001-003-027
+     * 
+     * @param p_span The span of bytes.
+     */
+    EXPORTED_API explicit CtRawDataView(std::span<const CtUInt8> p_span);
+
+    /**
+     * @brief This method returns a pointer to the viewed bytes.
+     * 
+     * @ref FR-001-003-026
+     * 
+     * @return const CtUInt8* Pointer to the bytes.
+     */
+    EXPORTED_API const CtUInt8* get() const;
+
+    /**
+     * @brief The number of viewed bytes.
+     * 
+     * @ref FR-001-003-026
+     * 
+     * @return CtUInt32 The number of bytes.
+     */
+    EXPORTED_API CtUInt32 size() const;
+
+    /**
+     * @brief Check if the view is empty.
+     * 
+     * @ref FR-001-003-026
+     * 
+     * @return CtBool CT_TRUE if the view has no bytes.
+     */
+    EXPORTED_API CtBool empty() const;
+
+    /**
+     * @brief This method returns a view of a subrange without copying.
+     *      If the range exceeds the view an exception will be thrown - CtOutOfRangeError()
+     * 
+     * @ref FR-001-003-026
+     * @ref FR-001-003-019
+     * 
+     * @param p_offset The offset of the first byte.
+     * @param p_size The number of bytes. By default all bytes up to the end of the view.
+     * @return CtRawDataView The view of the subrange.
+     */
+    EXPORTED_API CtRawDataView subview(CtUInt32 p_offset, CtUInt32 p_size = UINT32_MAX) const;
+
+    /**
+     * @brief This method returns the view as a std::span.
+     * 
+     * @ref FR-001-003-027
+     * 
+     * @return std::span<const CtUInt8> The span of bytes.
+     */
+    EXPORTED_API std::span<const CtUInt8> span() const;
+
+private:
+    const CtUInt8* m_data;                      /*!< The viewed bytes. */
+    CtUInt32 m_size;                            /*!< The number of viewed bytes. */
 };
 
 #endif //INCLUDE_CTTYPES_HPP_
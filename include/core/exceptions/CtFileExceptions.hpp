@@ -70,4 +70,16 @@ public:
     explicit CtFileParseError(const CtString& msg): CtException(msg) {};
 };
 
+/**
+ * @brief This exception is thrown when an io_uring instance cannot be created or used.
+ * 
+ * @ref FR-001-001-020
+ * @ref FR-001-001-002
+ * @ref FR-001-001-003
+ */
+class CtIoUringError : public CtException {
+public:
+    explicit CtIoUringError(const CtString& msg): CtException(msg) {};
+};
+
 #endif //INCLUDE_CTFILEEXCEPTIONS_HPP_
\ No newline at end of file
@@ -94,4 +94,28 @@ public:
     explicit CtSocketWriteError(const CtString& msg): CtException(msg) {};
 };
 
+/**
+ * @brief This exception is thrown when an epoll reactor cannot be created or a descriptor cannot be registered.
+ * 
+ * @ref FR-001-001-021
+ * @ref FR-001-001-002
+ * @ref FR-001-001-003
+ */
+class CtReactorError : public CtException {
+public:
+    explicit CtReactorError(const CtString& msg): CtException(msg) {};
+};
+
+/**
+ * @brief This exception is thrown when a shared memory channel cannot be created, attached or used.
+ * 
+ * @ref FR-001-001-022
+ * @ref FR-001-001-002
+ * @ref FR-001-001-003
+ */
+class CtIpcError : public CtException {
+public:
+    explicit CtIpcError(const CtString& msg): CtException(msg) {};
+};
+
 #endif //INCLUDE_CTNETWORKEXCEPTIONS_HPP_
@@ -44,12 +44,18 @@ SOFTWARE.
  */
 #include "io/CtFileInput.hpp"
 #include "io/CtFileOutput.hpp"
+#include "io/CtIoUring.hpp"
 
 /**
  * Include objects related to networking
  * 
  */
 #include "networking/CtSocketUdp.hpp"
+#include "networking/CtReactor.hpp"
+#include "networking/CtSocketUdpSharded.hpp"
+#include "networking/CtSocketTcp.hpp"
+#include "networking/CtSocketUnix.hpp"
+#include "networking/CtShmRing.hpp"
 
 /**
  * Include objects related to threading
@@ -73,7 +79,16 @@ SOFTWARE.
  * 
  */
 #include "utils/CtConfig.hpp"
+#include "utils/CtConfigParser.hpp"
+#include "utils/CtConfigSnapshot.hpp"
+#include "utils/CtConfigValue.hpp"
+#include "utils/CtLogBackend.hpp"
+#include "utils/CtLogBinary.hpp"
+#include "utils/CtLogContext.hpp"
+#include "utils/CtLogFormat.hpp"
 #include "utils/CtLogger.hpp"
+#include "utils/CtLogSink.hpp"
+#include "utils/CtLogTimestamp.hpp"
 #include "utils/CtObject.hpp"
 
 #endif //INCLUDE_CPPTOOLKIT_HPP_
\ No newline at end of file
@@ -33,6 +33,7 @@ SOFTWARE.
 #define INCLUDE_CTFILEINPUT_HPP_
 
 #include "core.hpp"
+#include "io/CtIoUring.hpp"
 
 #include <fstream>
 #include <sstream>
@@ -43,6 +44,7 @@ SOFTWARE.
  * 
  * @details
  * This class provides an interface for reading data from a file. The data can be read in batches or one by one.
+ * If io_uring is enabled the file is read in blocks and the next block is read ahead while the current one is parsed.
  * 
  * @code {.cpp}
  * // create a file input object
@@ -101,10 +103,92 @@ public:
      */
     EXPORTED_API CtBool read(CtRawData* p_data);
 
+    /**
+     * @brief This method reads the next batch of data and returns a view of it.
+     * 
+     * @ref FR-002-001-013
+     * 
+     * @details
+     * The batch is not limited by a buffer size. In io_uring mode a batch that lies inside the
+     * current block is returned without copying, otherwise it is collected in an internal buffer.
+     * The view is valid until the next read or the destruction of the object.
+     * 
+     * @param p_view Where to store the view of the data read.
+     * @return CtBool Returns True on success or False on EOF.
+     */
+    EXPORTED_API CtBool read(CtRawDataView* p_view);
+
+    /**
+     * @brief Read through io_uring instead of the file stream.
+     * 
+     * @ref FR-002-001-012
+     * 
+     * @details
+     * The file is read in blocks of CT_IO_URING_BLOCK_SIZE bytes and the next block is always
+     * requested before the current one is parsed. Reading continues from the current position.
+     * If io_uring is not supported by the kernel the file stream keeps being used and CT_FALSE
+     * is returned.
+     * 
+     * @param p_ring The ring to be used. If nullptr a private ring is created.
+     * @return CtBool CT_TRUE if io_uring is used, CT_FALSE otherwise.
+     */
+    EXPORTED_API CtBool useIoUring(CtIoUring* p_ring = nullptr);
+
+private:
+    /**
+     * @struct CtFileInputBlock
+     * @brief Represents a block of data read through io_uring.
+     * 
+     */
+    typedef struct _CtFileInputBlock {
+        std::unique_ptr<CtUInt8[]> buffer;
+        CtUInt32 size;
+        CtBool busy;
+        CtIoUringRequest request;
+    } CtFileInputBlock;
+
+    /**
+     * @brief Get the next character of the file.
+     * 
+     * @param p_char Where to store the character.
+     * @return CtBool CT_FALSE on EOF.
+     */
+    CtBool nextChar(CtChar& p_char);
+
+    /**
+     * @brief Move the read position back.
+     * 
+     * @param p_count The number of characters.
+     */
+    void rewind(CtUInt32 p_count);
+
+    /**
+     * @brief Switch to the block that is read ahead and request the next one.
+     * 
+     * @return CtBool CT_FALSE on EOF.
+     */
+    CtBool nextBlock();
+
+    /**
+     * @brief Request the next block of the file.
+     * 
+     * @param p_block The block to read into.
+     */
+    void requestBlock(CtFileInputBlock& p_block);
+
 private:
     std::ifstream m_file;           /**< File stream. */
     CtChar* m_delim;                /**< Batch read delimiter. */
     CtUInt8 m_delim_size;           /**< Delimeter size. */
+    CtIoUring* m_ring;              /**< The ring used for reading or nullptr. */
+    std::unique_ptr<CtIoUring> m_ownRing; /**< Private ring if no ring is shared. */
+    CtInt32 m_fd;                   /**< File descriptor opened with the stream, used with io_uring. */
+    CtUInt64 m_offset;              /**< File offset of the next block. */
+    CtFileInputBlock m_blocks[2];   /**< The current block and the block read ahead. */
+    CtUInt8 m_block;                /**< Index of the current block. */
+    CtInt32 m_pos;                  /**< Read position in the current block. */
+    CtBool m_eof;                   /**< End of file is reached. */
+    CtRawData m_record;             /**< Growable buffer of read() with a view. */
 };
 
 #endif //INCLUDE_CTFILEINPUT_HPP_
\ No newline at end of file
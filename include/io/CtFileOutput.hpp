@@ -34,25 +34,44 @@ SOFTWARE.
 
 #include "core.hpp"
 
+#include "threading/CtThread.hpp"
+#include "io/CtIoUring.hpp"
+
 #include <fstream>
 #include <sstream>
 #include <cstring>
 #include <memory>
+#include <condition_variable>
+
+/**
+ * @brief Default number of queued writes in async mode.
+ * 
+ */
+#define CT_FILE_ASYNC_CAPACITY  1024u
 
 /**
  * @brief CtFileOutput class for writing data to file.
  * 
  * @details
  * This class provides an interface for writing data to a file. The data can be written in batches or one by one.
+ * In async mode write() only copies the data to a bounded lock-free queue and a background thread drains
+ * the queue to the file in batches, so the calling thread never waits for disk I/O.
+ * If io_uring is enabled the data is collected in blocks that are submitted to the kernel without
+ * waiting for each write, and many files can share one CtIoUring.
  * 
  * @code {.cpp}
  * // create a file output object
  * CtFileOutput fileOutput("output.txt");
  * fileOutput.write("Hello, World!");
+ * // move disk I/O to a background thread
+ * fileOutput.setAsync(4096, CtFileOutput::OverflowPolicy::Block);
+ * fileOutput.write("Hello, World!");
+ * // wait until everything is written and synced to disk
+ * fileOutput.flush();
  * @endcode
  * 
  */
-class CtFileOutput {
+class CtFileOutput : private CtThread {
 public:
     /**
      * @brief Enum representing write mode.
@@ -61,6 +80,14 @@ public:
      */
     enum class WriteMode { Append, Truncate };
 
+    /**
+     * @brief Enum representing the behaviour of async mode when the write queue is full.
+     *      Block waits for the background thread to free a slot, Drop discards the data.
+     * 
+     * @ref FR-002-002-013
+     */
+    enum class OverflowPolicy { Block, Drop };
+
     /**
      * @brief Constructs the CtFileOutput object.
      * 
@@ -107,6 +134,27 @@ public:
      */
     EXPORTED_API void write(CtRawData* p_data);
 
+    /**
+     * @brief This method writes a view of bytes to file followed by the delimiter.
+     *
+     * @ref FR-002-002-017
+     * 
+     * @param p_data The data to be written.
+     * @return void
+     */
+    EXPORTED_API void write(const CtRawDataView& p_data);
+
+    /**
+     * @brief This method writes a shared buffer to file followed by the delimiter.
+     *      In async mode only a reference is queued, the bytes are not copied.
+     *
+     * @ref FR-002-002-018
+     * 
+     * @param p_data The data to be written.
+     * @return void
+     */
+    EXPORTED_API void write(const CtSharedData& p_data);
+
     /**
      * @brief This method writes to file.
      *
@@ -121,10 +169,210 @@ public:
      */
     EXPORTED_API void writePart(CtRawData* p_data);
 
+    /**
+     * @brief This method writes a view of bytes to file. No delimiter is written.
+     *
+     * @ref FR-002-002-017
+     * 
+     * @param p_data The data to be written.
+     * @return void
+     */
+    EXPORTED_API void writePart(const CtRawDataView& p_data);
+
+    /**
+     * @brief This method writes a shared buffer to file. No delimiter is written.
+     *      In async mode only a reference is queued, the bytes are not copied.
+     *
+     * @ref FR-002-002-018
+     * 
+     * @param p_data The data to be written.
+     * @return void
+     */
+    EXPORTED_API void writePart(const CtSharedData& p_data);
+
+    /**
+     * @brief Enable async mode.
+     * 
+     * @ref FR-002-002-011
+     * @ref FR-002-002-012
+     * @ref FR-002-002-013
+     * 
+     * @details
+     * After this call write() and writePart() copy the data to a bounded queue and return.
+     * A background thread drains the queue to the file in batches.
+     * CtFileWriteError is thrown if async mode is already enabled.
+     * 
+     * @param p_capacity The maximum number of queued writes.
+     * @param p_policy The behaviour of write() when the queue is full.
+     * @return void
+     */
+    EXPORTED_API void setAsync(CtUInt32 p_capacity = CT_FILE_ASYNC_CAPACITY, OverflowPolicy p_policy = OverflowPolicy::Block);
+
+    /**
+     * @brief Wait for all queued writes to reach the file and sync the file to disk.
+     * 
+     * @ref FR-002-002-014
+     * @ref FR-002-002-015
+     * 
+     * @details
+     * CtFileWriteError is thrown if a write failed or the file cannot be synced.
+     * 
+     * @return void
+     */
+    EXPORTED_API void flush();
+
+    /**
+     * @brief Get the number of writes dropped in async mode because the queue was full.
+     * 
+     * @ref FR-002-002-013
+     * 
+     * @return CtUInt64 The number of dropped writes.
+     */
+    EXPORTED_API CtUInt64 getDroppedWrites();
+
+    /**
+     * @brief Write through io_uring instead of the file stream.
+     * 
+     * @ref FR-002-002-016
+     * 
+     * @details
+     * The data is collected in blocks of CT_IO_URING_BLOCK_SIZE bytes and every full block is
+     * submitted without waiting for its completion. If io_uring is not supported by the kernel
+     * the file stream keeps being used and CT_FALSE is returned. A shared ring must only be used
+     * by the thread that writes, which is the background thread in async mode.
+     * 
+     * @param p_ring The ring to be used. If nullptr a private ring is created.
+     * @return CtBool CT_TRUE if io_uring is used, CT_FALSE otherwise.
+     */
+    EXPORTED_API CtBool useIoUring(CtIoUring* p_ring = nullptr);
+
+private:
+    /**
+     * @struct CtFileOutputEntry
+     * @brief Represents a queued write of async mode. The data are either copied to a buffer
+     *      of the global CtRawDataPool or referenced by a CtSharedData.
+     * 
+     */
+    typedef struct _CtFileOutputEntry {
+        CtUInt8* data;
+        CtUInt32 size;
+        CtUInt32 capacity;
+        CtSharedData shared;
+        CtBool delimited;
+    } CtFileOutputEntry;
+
+    /**
+     * @struct CtFileOutputBlock
+     * @brief Represents a block of data written through io_uring.
+     * 
+     */
+    typedef struct _CtFileOutputBlock {
+        std::unique_ptr<CtUInt8[]> buffer;
+        CtUInt32 size;
+        CtUInt64 offset;
+        CtBool busy;
+        CtIoUringRequest request;
+    } CtFileOutputBlock;
+
+    /**
+     * @brief Write bytes either to the file stream or to the current io_uring block.
+     * 
+     * @param p_data The data to be written.
+     * @param p_size The number of bytes.
+     */
+    void writeRaw(const CtUInt8* p_data, CtUInt32 p_size);
+
+    /**
+     * @brief Submit the current io_uring block and move to the next one.
+     * 
+     */
+    void submitBlock();
+
+    /**
+     * @brief Wait until an io_uring block is completely written.
+     *      Short writes are resubmitted. CtFileWriteError is thrown on failure.
+     * 
+     * @param p_block The block to wait for.
+     */
+    void waitBlock(CtFileOutputBlock& p_block);
+
+    /**
+     * @brief Write data and optionally the delimiter to the file stream.
+     * 
+     * @param p_data The data to be written.
+     * @param p_size The number of bytes.
+     * @param p_delimited Append the delimiter after the data.
+     */
+    void writeData(const CtUInt8* p_data, CtUInt32 p_size, CtBool p_delimited);
+
+    /**
+     * @brief Copy data to a pooled buffer of the async queue applying the overflow policy.
+     * 
+     * @param p_data The data to be queued.
+     * @param p_delimited Append the delimiter after the data.
+     */
+    void enqueue(const CtRawDataView& p_data, CtBool p_delimited);
+
+    /**
+     * @brief Queue a reference to shared data applying the overflow policy.
+     * 
+     * @param p_data The data to be queued.
+     * @param p_delimited Append the delimiter after the data.
+     */
+    void enqueue(const CtSharedData& p_data, CtBool p_delimited);
+
+    /**
+     * @brief Push an entry to the async queue applying the overflow policy.
+     * 
+     * @param p_entry The entry to be queued.
+     * @return CtBool CT_FALSE if the entry was dropped.
+     */
+    CtBool push(CtFileOutputEntry& p_entry);
+
+    /**
+     * @brief Write all segments of shared data and optionally the delimiter.
+     * 
+     * @param p_data The data to be written.
+     * @param p_delimited Append the delimiter after the data.
+     */
+    void writeShared(const CtSharedData& p_data, CtBool p_delimited);
+
+    /**
+     * @brief Write a batch of queued entries to the file.
+     * 
+     * @return CtUInt32 The number of entries written.
+     */
+    CtUInt32 drain();
+
+    /**
+     * @brief Background thread loop of async mode.
+     * 
+     * @ref FR-002-002-012
+     */
+    void loop() override;
+
 private:
-    std::ofstream m_file;               /**< File stream. */
-    std::unique_ptr<char[]> m_delim;    /**< Batch write delimiter. */
-    CtUInt8 m_delim_size;               /**< Delimeter size. */
+    std::ofstream m_file;                                       /**< File stream. */
+    CtString m_fileName;                                        /**< File name. */
+    std::unique_ptr<char[]> m_delim;                            /**< Batch write delimiter. */
+    CtUInt8 m_delim_size;                                       /**< Delimeter size. */
+    CtMutex m_mtx_file;                                         /**< Mutex for the file stream. */
+    std::unique_ptr<CtRingBuffer<CtFileOutputEntry>> m_queue;   /**< Write queue of async mode. */
+    OverflowPolicy m_policy;                                    /**< Overflow policy of async mode. */
+    CtAtomic<CtUInt64> m_pending;                               /**< Queued writes that have not reached the file. */
+    CtAtomic<CtUInt64> m_dropped;                               /**< Writes dropped because the queue was full. */
+    CtAtomic<CtBool> m_idle;                                    /**< The background thread waits for new data. */
+    CtAtomic<CtBool> m_failed;                                  /**< A background write failed. */
+    CtMutex m_mtx_idle;                                         /**< Mutex for idle waiting. */
+    std::condition_variable m_cv_idle;                          /**< Wakes up the background thread. */
+    CtMutex m_mtx_flushed;                                      /**< Mutex for waiting until the queued writes are written. */
+    std::condition_variable m_cv_flushed;                       /**< Notified when no queued write is pending. */
+    CtIoUring* m_ring;                                          /**< The ring used for writing or nullptr. */
+    std::unique_ptr<CtIoUring> m_ownRing;                       /**< Private ring if no ring is shared. */
+    CtInt32 m_fd;                                               /**< Descriptor of the file, synced by flush() and written with io_uring. */
+    CtUInt64 m_offset;                                          /**< File offset of the current io_uring block. */
+    CtVector<CtFileOutputBlock> m_blocks;                       /**< Blocks used with io_uring. */
+    CtUInt32 m_block;                                           /**< Index of the current io_uring block. */
 };
 
 
@@ -0,0 +1,222 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtIoUring.hpp
+ * @brief CtIoUring class header file.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTIOURING_HPP_
+#define INCLUDE_CTIOURING_HPP_
+
+#include "core.hpp"
+
+#include <sys/uio.h>
+
+/**
+ * @brief Default number of submission queue entries.
+ * 
+ */
+#define CT_IO_URING_ENTRIES     64u
+
+/**
+ * @brief Size of the blocks used by CtFileInput and CtFileOutput when io_uring is enabled.
+ * 
+ */
+#define CT_IO_URING_BLOCK_SIZE  65536u
+
+/**
+ * @brief Struct describing a read or write request submitted to a CtIoUring.
+ * 
+ * @ref FR-002-003-003
+ * 
+ * @details
+ * The request must stay valid until it is completed. Upon completion done is set
+ * and result holds the number of bytes transferred or a negative errno value.
+ * 
+ */
+typedef struct _CtIoUringRequest {
+    struct iovec iov;
+    CtInt32 result;
+    CtBool done;
+} CtIoUringRequest;
+
+/**
+ * @class CtIoUring
+ * @brief A minimal io_uring wrapper built on raw system calls.
+ * 
+ * @ref FR-002-003-001
+ * 
+ * @details
+ * The ring batches read and write requests of one or more files and submits them to the kernel
+ * with a single system call. Completions are matched back to their CtIoUringRequest. Waiting on
+ * a request reaps every available completion, so a single ring can be shared by many CtFileInput
+ * and CtFileOutput objects that are used from the same thread. A ring must not be used by more
+ * than one thread concurrently. isSupported() probes the kernel at runtime so callers can fall
+ * back to regular file streams.
+ * 
+ * @code {.cpp}
+ * if (CtIoUring::isSupported()) {
+ *     CtIoUring ring;
+ *     CtFileOutput file1("out1.txt");
+ *     CtFileOutput file2("out2.txt");
+ *     file1.useIoUring(&ring);
+ *     file2.useIoUring(&ring);
+ * }
+ * @endcode
+ * 
+ */
+class CtIoUring {
+public:
+    /**
+     * @brief Constructor for CtIoUring.
+     *      CtIoUringError is thrown if the ring cannot be created.
+     * 
+     * @ref FR-002-003-002
+     * 
+     * @param p_entries The number of submission queue entries.
+     */
+    EXPORTED_API explicit CtIoUring(CtUInt32 p_entries = CT_IO_URING_ENTRIES);
+
+    /**
+     * @brief Destructor for CtIoUring.
+     * 
+     * @ref FR-002-003-002
+     * 
+     */
+    EXPORTED_API ~CtIoUring();
+
+    CtIoUring(const CtIoUring&) = delete;
+    CtIoUring& operator=(const CtIoUring&) = delete;
+
+    /**
+     * @brief Check if io_uring is available in the running kernel.
+     * 
+     * @ref FR-002-003-006
+     * 
+     * @return CtBool CT_TRUE if io_uring can be used, CT_FALSE otherwise.
+     */
+    EXPORTED_API static CtBool isSupported();
+
+    /**
+     * @brief Queue a read request. The request is sent to the kernel by the next submit() or wait().
+     * 
+     * @ref FR-002-003-003
+     * 
+     * @param p_fd The file descriptor to read from.
+     * @param p_buffer The buffer to store the data.
+     * @param p_size The number of bytes to read.
+     * @param p_offset The file offset to read from.
+     * @param p_request The request that tracks the completion.
+     */
+    EXPORTED_API void prepareRead(CtInt32 p_fd, CtUInt8* p_buffer, CtUInt32 p_size, CtUInt64 p_offset, CtIoUringRequest* p_request);
+
+    /**
+     * @brief Queue a write request. The request is sent to the kernel by the next submit() or wait().
+     * 
+     * @ref FR-002-003-003
+     * 
+     * @param p_fd The file descriptor to write to.
+     * @param p_buffer The data to be written.
+     * @param p_size The number of bytes to write.
+     * @param p_offset The file offset to write to.
+     * @param p_request The request that tracks the completion.
+     */
+    EXPORTED_API void prepareWrite(CtInt32 p_fd, const CtUInt8* p_buffer, CtUInt32 p_size, CtUInt64 p_offset, CtIoUringRequest* p_request);
+
+    /**
+     * @brief Submit all queued requests with a single system call.
+     * 
+     * @ref FR-002-003-004
+     * 
+     */
+    EXPORTED_API void submit();
+
+    /**
+     * @brief Wait until a request is completed. Completions of other requests are recorded as well.
+     * 
+     * @ref FR-002-003-005
+     * 
+     * @param p_request The request to wait for.
+     */
+    EXPORTED_API void wait(CtIoUringRequest* p_request);
+
+    /**
+     * @brief Record all available completions without waiting.
+     * 
+     * @ref FR-002-003-005
+     * 
+     * @return CtUInt32 The number of completions recorded.
+     */
+    EXPORTED_API CtUInt32 poll();
+
+    /**
+     * @brief The number of requests that have been queued but not completed yet.
+     * 
+     * @ref FR-002-003-005
+     * 
+     * @return CtUInt32 The number of requests in flight.
+     */
+    EXPORTED_API CtUInt32 inFlight();
+
+private:
+    /**
+     * @brief Get the next free submission queue entry, submitting or waiting if the ring is full.
+     * 
+     * @return void* Pointer to the submission queue entry.
+     */
+    void* nextEntry();
+
+    /**
+     * @brief Enter the kernel to submit queued requests and optionally wait for completions.
+     * 
+     * @param p_minComplete The minimum number of completions to wait for.
+     */
+    void enter(CtUInt32 p_minComplete);
+
+private:
+    CtInt32 m_fd;                       /*!< The io_uring file descriptor. */
+    CtUInt32 m_entries;                 /*!< The number of submission queue entries. */
+    CtUInt32 m_toSubmit;                /*!< Queued requests not submitted yet. */
+    CtUInt32 m_inFlight;                /*!< Queued or submitted requests not completed yet. */
+    void* m_sqRing;                     /*!< Mapped submission queue ring. */
+    void* m_cqRing;                     /*!< Mapped completion queue ring. */
+    void* m_sqes;                       /*!< Mapped submission queue entries. */
+    size_t m_sqRingSize;                /*!< Size of the submission queue mapping. */
+    size_t m_cqRingSize;                /*!< Size of the completion queue mapping. */
+    size_t m_sqesSize;                  /*!< Size of the submission queue entries mapping. */
+    CtUInt32* m_sqHead;                 /*!< Submission queue head. */
+    CtUInt32* m_sqTail;                 /*!< Submission queue tail. */
+    CtUInt32 m_sqLocalTail;             /*!< Submission queue tail including entries not published yet. */
+    CtUInt32* m_sqMask;                 /*!< Submission queue index mask. */
+    CtUInt32* m_sqArray;                /*!< Submission queue index array. */
+    CtUInt32* m_cqHead;                 /*!< Completion queue head. */
+    CtUInt32* m_cqTail;                 /*!< Completion queue tail. */
+    CtUInt32* m_cqMask;                 /*!< Completion queue index mask. */
+    void* m_cqes;                       /*!< Completion queue entries. */
+};
+
+#endif //INCLUDE_CTIOURING_HPP_
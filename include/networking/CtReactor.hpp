@@ -0,0 +1,276 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtReactor.hpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTREACTOR_HPP_
+#define INCLUDE_CTREACTOR_HPP_
+
+#include "core.hpp"
+#include "networking/CtSocketUdp.hpp"
+#include "threading/CtThread.hpp"
+#include "threading/CtWorkerPool.hpp"
+
+#include <functional>
+#include <memory>
+#include <sys/epoll.h>
+
+/**
+ * @brief Maximum number of events handled by a single epoll_wait call.
+ * 
+ */
+#define CT_REACTOR_EVENTS       64u
+
+/**
+ * @brief Timeout of epoll_wait in milliseconds when the reactor runs its own thread.
+ * 
+ */
+#define CT_REACTOR_TIMEOUT      100
+
+/**
+ * @brief Callback of CtReactor. It gets the ready file descriptor and the epoll events.
+ * 
+ */
+typedef std::function<void(CtInt32, CtUInt32)> CtReactorCallback;
+
+/**
+ * @brief Error callback of CtReactor. It gets the file descriptor of the failed callback, or -1 if
+ * waiting failed, and the message of the exception.
+ * 
+ */
+typedef std::function<void(CtInt32, const CtString&)> CtReactorErrorCallback;
+
+/**
+ * @class CtReactor
+ * @brief An event loop that waits for many file descriptors with epoll and dispatches callbacks.
+ * 
+ * @ref FR-006-002-001
+ * 
+ * @details
+ * File descriptors and CtSocketUdp objects are registered with a callback that is called when
+ * they become ready. The reactor is driven either by its own thread (runReactor()) or by calling
+ * poll() from one or more threads. Callbacks run on the polling thread, or on a CtWorkerPool if
+ * one is given. With a pool every descriptor is registered as one-shot and is re-armed after its
+ * callback returns, so a descriptor is never handled by two workers at the same time. Exceptions
+ * thrown by callbacks, and failures of epoll_wait on the reactor thread, are caught and passed to the
+ * error callback (see setErrorCallback()); the reactor keeps dispatching.
+ * 
+ * In edge-triggered mode a callback is called only when new data arrive, so it must read until
+ * the descriptor has no more data, e.g. by calling CtSocketUdp::receiveBatch() until it returns 0.
+ * 
+ * @code {.cpp}
+ * CtWorkerPool pool(4);
+ * CtReactor reactor(CtReactor::Trigger::Edge, &pool);
+ * CtSocketUdp sockets[500];
+ * for (CtUInt32 idx = 0; idx < 500; idx++) {
+ *     sockets[idx].setSub("lo", 5000 + idx);
+ *     reactor.add(sockets[idx], [&sockets, idx](CtInt32 fd, CtUInt32 events) {
+ *         CtRawData messages[16];
+ *         while (sockets[idx].receiveBatch(messages, 16) > 0) {
+ *             // process messages
+ *         }
+ *     });
+ * }
+ * reactor.runReactor();
+ * @endcode
+ * 
+ */
+class CtReactor : private CtThread {
+public:
+    /**
+     * @brief Enum representing how readiness is reported.
+     * 
+     */
+    enum class Trigger {
+        Level,  /**< The callback is called as long as the descriptor is ready. */
+        Edge    /**< The callback is called when the descriptor becomes ready. */
+    };
+
+    /**
+     * @brief Constructor for CtReactor.
+     *      CtReactorError is thrown if the epoll instance cannot be created.
+     * 
+     * @ref FR-006-002-002
+     * 
+     * @param p_trigger Level or edge triggered readiness.
+     * @param p_pool The worker pool that executes the callbacks. If nullptr callbacks run on the polling thread.
+     */
+    EXPORTED_API explicit CtReactor(Trigger p_trigger = Trigger::Level, CtWorkerPool* p_pool = nullptr);
+
+    /**
+     * @brief Destructor for CtReactor. It stops the reactor thread and waits for running callbacks.
+     * 
+     * @ref FR-006-002-002
+     * 
+     */
+    EXPORTED_API ~CtReactor();
+
+    /**
+     * @brief Register a file descriptor.
+     *      CtReactorError is thrown if the descriptor cannot be registered.
+     * 
+     * @ref FR-006-002-003
+     * 
+     * @param p_fd The file descriptor.
+     * @param p_events The epoll events to wait for, e.g. EPOLLIN or EPOLLOUT.
+     * @param p_callback The function called when the descriptor is ready.
+     */
+    EXPORTED_API void add(CtInt32 p_fd, CtUInt32 p_events, const CtReactorCallback& p_callback);
+
+    /**
+     * @brief Register a socket for reading.
+     *      CtReactorError is thrown if the socket cannot be registered.
+     * 
+     * @ref FR-006-002-003
+     * 
+     * @param p_socket The socket.
+     * @param p_callback The function called when data can be read.
+     */
+    EXPORTED_API void add(CtSocketUdp& p_socket, const CtReactorCallback& p_callback);
+
+    /**
+     * @brief Unregister a file descriptor. A callback that already runs is not interrupted.
+     * 
+     * @ref FR-006-002-004
+     * 
+     * @param p_fd The file descriptor.
+     */
+    EXPORTED_API void remove(CtInt32 p_fd);
+
+    /**
+     * @brief Unregister a socket. A callback that already runs is not interrupted.
+     * 
+     * @ref FR-006-002-004
+     * 
+     * @param p_socket The socket.
+     */
+    EXPORTED_API void remove(CtSocketUdp& p_socket);
+
+    /**
+     * @brief The number of registered descriptors.
+     * 
+     * @ref FR-006-002-004
+     * 
+     * @return CtUInt32 The number of registered descriptors.
+     */
+    EXPORTED_API CtUInt32 size();
+
+    /**
+     * @brief Set the function called with the exceptions of callbacks and of the reactor thread.
+     *      It runs on the thread of the failure and must not throw.
+     * 
+     * @ref FR-006-002-007
+     * 
+     * @param p_callback The error callback, nullptr to ignore errors.
+     */
+    EXPORTED_API void setErrorCallback(const CtReactorErrorCallback& p_callback);
+
+    /**
+     * @brief Wait for ready descriptors once and dispatch their callbacks.
+     * 
+     * @ref FR-006-002-005
+     * 
+     * @param p_timeout Timeout in milliseconds, -1 blocks until a descriptor is ready.
+     *      CtReactorError is thrown if waiting fails.
+     * @return CtUInt32 The number of dispatched callbacks.
+     */
+    EXPORTED_API CtUInt32 poll(CtInt32 p_timeout);
+
+    /**
+     * @brief Run the reactor on its own thread.
+     * 
+     * @ref FR-006-002-006
+     * 
+     */
+    EXPORTED_API void runReactor();
+
+    /**
+     * @brief Stop the reactor thread.
+     * 
+     * @ref FR-006-002-006
+     * 
+     */
+    EXPORTED_API void stopReactor();
+
+private:
+    /**
+     * @struct CtReactorHandler
+     * @brief A registered descriptor.
+     * 
+     */
+    typedef struct _CtReactorHandler {
+        CtInt32 fd;
+        CtUInt32 events;
+        CtReactorCallback callback;
+    } CtReactorHandler;
+
+    /**
+     * @brief Run a callback and re-arm its descriptor if it is registered as one-shot.
+     * 
+     * @param p_handler The handler of the descriptor.
+     * @param p_events The ready events.
+     */
+    void dispatch(const std::shared_ptr<CtReactorHandler>& p_handler, CtUInt32 p_events);
+
+    /**
+     * @brief Pass an error to the error callback.
+     * 
+     * @ref FR-006-002-007
+     * 
+     * @param p_fd The file descriptor of the failed callback or -1.
+     * @param p_message The error message.
+     */
+    void reportError(CtInt32 p_fd, const CtString& p_message);
+
+    /**
+     * @brief The epoll events used for a registration.
+     * 
+     * @param p_events The requested events.
+     * @return CtUInt32 The requested events with the trigger flags.
+     */
+    CtUInt32 epollEvents(CtUInt32 p_events);
+
+    /**
+     * @brief Reactor thread loop.
+     * 
+     * @ref FR-006-002-006
+     */
+    void loop() override;
+
+private:
+    CtInt32 m_epfd;                                                 /*!< The epoll file descriptor. */
+    Trigger m_trigger;                                              /*!< Level or edge triggered readiness. */
+    CtWorkerPool* m_pool;                                           /*!< Pool that executes the callbacks or nullptr. */
+    CtMap<CtInt32, std::shared_ptr<CtReactorHandler>> m_handlers;   /*!< Registered descriptors. */
+    CtMutex m_mtx_handlers;                                         /*!< Mutex for the registered descriptors. */
+    CtAtomic<CtUInt32> m_inFlight;                                  /*!< Callbacks queued to the pool. */
+    CtReactorErrorCallback m_errorCallback;                         /*!< Called with the errors, guarded by m_mtx_handlers. */
+};
+
+#endif //INCLUDE_CTREACTOR_HPP_
@@ -0,0 +1,201 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtShmRing.hpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTSHMRING_HPP_
+#define INCLUDE_CTSHMRING_HPP_
+
+#include "core.hpp"
+
+#include <atomic>
+
+/**
+ * @class CtShmRing
+ * @brief A single producer single consumer message ring in shared memory.
+ * 
+ * @ref FR-006-006-001
+ * 
+ * @details
+ * The ring lives in an anonymous memory file (memfd) that is mapped by both processes. The creator
+ * passes getFd() to the other process, e.g. with CtSocketUnix::sendFd() or by fork(), which attaches
+ * with the descriptor constructor. Messages are copied once into the ring and once out of it; no
+ * system call is made while the reader keeps up. A side that has to wait sleeps on a futex in the
+ * shared memory and is woken by the other side only when it is actually sleeping.
+ * 
+ * Exactly one thread may write and one thread may read.
+ * 
+ * @code {.cpp}
+ * // process A
+ * CtShmRing ring("prices", 1 << 20);
+ * unixSocket.sendFd(ring.getFd());
+ * ring.write(message.view(), -1);
+ * 
+ * // process B
+ * CtShmRing ring(unixSocket.receiveFd());
+ * CtRawData message;
+ * ring.read(&message, -1);
+ * @endcode
+ * 
+ */
+class CtShmRing {
+public:
+    /**
+     * @brief Create a new ring.
+     *      CtIpcError is thrown if the shared memory cannot be created.
+     * 
+     * @ref FR-006-006-001
+     * 
+     * @param p_name The name of the memory file, shown in /proc/PID/fd.
+     * @param p_capacity The number of data bytes of the ring, rounded up to a power of two.
+     */
+    EXPORTED_API CtShmRing(const CtString& p_name, CtUInt32 p_capacity);
+
+    /**
+     * @brief Attach to a ring created by another process. The descriptor is owned by the object.
+     *      CtIpcError is thrown if the descriptor does not describe a ring.
+     * 
+     * @ref FR-006-006-001
+     * 
+     * @param p_fd The descriptor of the shared memory of the ring.
+     */
+    EXPORTED_API explicit CtShmRing(CtInt32 p_fd);
+
+    /**
+     * @brief Destructor for CtShmRing. The memory is released when all processes detached.
+     * 
+     * @ref FR-006-006-001
+     * 
+     */
+    EXPORTED_API ~CtShmRing();
+
+    CtShmRing(const CtShmRing&) = delete;
+    CtShmRing& operator=(const CtShmRing&) = delete;
+
+    /**
+     * @brief Get the descriptor of the shared memory, to pass it to another process.
+     * 
+     * @ref FR-006-006-001
+     * 
+     * @return CtInt32 The descriptor.
+     */
+    EXPORTED_API CtInt32 getFd();
+
+    /**
+     * @brief Get the number of data bytes of the ring.
+     * 
+     * @ref FR-006-006-001
+     * 
+     * @return CtUInt32 The capacity.
+     */
+    EXPORTED_API CtUInt32 capacity();
+
+    /**
+     * @brief Write a message to the ring.
+     *      CtIpcError is thrown if the message can never fit in the ring.
+     * 
+     * @ref FR-006-006-002
+     * @ref FR-006-006-003
+     * 
+     * @param p_data The message.
+     * @param p_timeout Time in milliseconds to wait for space; 0 does not wait, -1 waits indefinitely.
+     * @return CtBool CT_TRUE if written, CT_FALSE if there was no space.
+     */
+    EXPORTED_API CtBool write(const CtRawDataView& p_data, CtInt32 p_timeout = 0);
+
+    /**
+     * @brief Read the next message from the ring in the buffer of p_message.
+     *      CtIpcError is thrown if the message is larger than maxSize() of a buffer that is not
+     *      growable, in which case the message is dropped, or if the ring was corrupted by the writer.
+     * 
+     * @ref FR-006-006-002
+     * @ref FR-006-006-003
+     * 
+     * @param p_message The buffer to store the message.
+     * @param p_timeout Time in milliseconds to wait for a message; 0 does not wait, -1 waits indefinitely.
+     * @return CtBool CT_TRUE if a message was read, CT_FALSE if there was none.
+     */
+    EXPORTED_API CtBool read(CtRawData* p_message, CtInt32 p_timeout = 0);
+
+private:
+    /**
+     * @brief Struct describing the header placed at the start of the shared memory.
+     * 
+     * @details
+     * Positions grow forever and are masked with the capacity. Each index is owned by one side
+     * and sits in its own cache line. The futex words are bumped when a sleeping side is woken.
+     * 
+     */
+    typedef struct _CtShmHeader {
+        CtUInt64 magic;                             /**< Marks an initialized ring. */
+        CtUInt32 capacity;                          /**< The number of data bytes. */
+        alignas(64) std::atomic<CtUInt64> head;     /**< Write position, owned by the writer. */
+        std::atomic<CtUInt32> readerWaiting;        /**< 1 while the reader sleeps. */
+        std::atomic<CtUInt32> dataSignal;           /**< Futex word the reader sleeps on. */
+        alignas(64) std::atomic<CtUInt64> tail;     /**< Read position, owned by the reader. */
+        std::atomic<CtUInt32> writerWaiting;        /**< 1 while the writer sleeps. */
+        std::atomic<CtUInt32> spaceSignal;          /**< Futex word the writer sleeps on. */
+    } CtShmHeader;
+
+    /**
+     * @brief Map the shared memory of m_fd.
+     * 
+     * @param p_size The size of the shared memory.
+     */
+    void map(CtUInt64 p_size);
+
+    /**
+     * @brief Sleep until the other side signals or the timeout expires.
+     * 
+     * @param p_waiting The waiting flag of this side.
+     * @param p_signal The futex word of this side.
+     * @param p_ready Returns CT_TRUE when the wait is over.
+     * @param p_timeout Time in milliseconds; -1 waits indefinitely.
+     * @return CtBool The last result of p_ready.
+     */
+    template <typename Ready>
+    CtBool wait(std::atomic<CtUInt32>& p_waiting, std::atomic<CtUInt32>& p_signal, Ready p_ready, CtInt32 p_timeout);
+
+    /**
+     * @brief Wake the other side if it sleeps.
+     * 
+     * @param p_waiting The waiting flag of the other side.
+     * @param p_signal The futex word of the other side.
+     */
+    static void wake(std::atomic<CtUInt32>& p_waiting, std::atomic<CtUInt32>& p_signal);
+
+private:
+    CtInt32 m_fd;                           /**< The memfd descriptor. */
+    CtUInt64 m_size;                        /**< The size of the mapping. */
+    CtShmHeader* m_header;                  /**< The header in shared memory. */
+    CtUInt8* m_data;                        /**< The data bytes in shared memory. */
+    CtUInt32 m_mask;                        /**< capacity - 1. */
+};
+
+#endif //INCLUDE_CTSHMRING_HPP_
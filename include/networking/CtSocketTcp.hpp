@@ -0,0 +1,399 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtSocketTcp.hpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTSOCKETTCP_HPP_
+#define INCLUDE_CTSOCKETTCP_HPP_
+
+#include "core.hpp"
+
+#include <cstring>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <sys/socket.h>
+
+/**
+ * @class CtSocketTcp
+ * @brief A class representing a TCP socket wrapper.
+ * 
+ * @ref FR-006-004-001
+ * 
+ * @details
+ * The same class is used for clients, listeners and accepted connections. A listener is created
+ * with listen() and hands out connections with accept(). A client is created with connect().
+ * CtSocketHelpers::socketTimeout is used as timeout for pollRead() and pollWrite().
+ * 
+ * In non-blocking mode send and receive methods return zero instead of waiting. Data are never
+ * copied to intermediate buffers: they are read in the buffer of a CtRawData, gathered from views
+ * with one system call, or pinned and sent by the network stack with MSG_ZEROCOPY.
+ * 
+ * Example server:
+ * @code {.cpp}
+ * CtSocketTcp server;
+ * server.listen("lo", 1234);
+ * CtSocketTcp client;
+ * server.accept(&client);
+ * CtRawData message;
+ * while (client.receive(&message) > 0) {
+ *      // process message
+ * }
+ * @endcode
+ * 
+ * Example client:
+ * @code {.cpp}
+ * CtSocketTcp socket;
+ * socket.connect(1234, "127.0.0.1");
+ * CtRawData header, body;
+ * CtRawDataView parts[2] = {header.view(), body.view()};
+ * socket.sendGather(parts, 2);
+ * @endcode
+ * 
+ */
+class CtSocketTcp {
+public:
+    /**
+     * @brief Constructor for CtSocketTcp.
+     *      CtSocketError is thrown if the socket cannot be created.
+     * 
+     * @ref FR-006-004-001
+     * 
+     * @param p_family The IP version of the socket.
+     */
+    EXPORTED_API explicit CtSocketTcp(CtNetFamily p_family = CtNetFamily::Ipv4);
+
+    /**
+     * @brief Destructor for CtSocketTcp. The connection is closed.
+     * 
+     * @ref FR-006-004-001
+     * 
+     */
+    EXPORTED_API ~CtSocketTcp();
+
+    /**
+     * @brief Enable or disable non-blocking mode.
+     *      CtSocketError is thrown if the mode cannot be changed.
+     * 
+     * @ref FR-006-004-002
+     * 
+     * @param p_enable CT_TRUE for non-blocking mode.
+     */
+    EXPORTED_API void setNonBlocking(CtBool p_enable);
+
+    /**
+     * @brief Disable the Nagle algorithm so that small writes are sent immediately.
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-004-004
+     * 
+     * @param p_enable CT_TRUE to enable TCP_NODELAY.
+     */
+    EXPORTED_API void setNoDelay(CtBool p_enable);
+
+    /**
+     * @brief Hold partial segments until the cork is removed, so that several writes leave as full segments.
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-004-004
+     * 
+     * @param p_enable CT_TRUE to set TCP_CORK, CT_FALSE to remove it and flush the pending data.
+     */
+    EXPORTED_API void setCork(CtBool p_enable);
+
+    /**
+     * @brief Allow sendZeroCopy() on this socket.
+     *      CtSocketError is thrown if the kernel does not support SO_ZEROCOPY.
+     * 
+     * @ref FR-006-004-005
+     * 
+     * @param p_enable CT_TRUE to enable SO_ZEROCOPY.
+     */
+    EXPORTED_API void setZeroCopy(CtBool p_enable);
+
+    /**
+     * @brief Bind the socket to an interface and port and accept connections.
+     *      CtSocketBindError is thrown if the socket cannot be bound or cannot listen.
+     * 
+     * @ref FR-006-004-001
+     * 
+     * @param p_interfaceName The interface name to bind to.
+     * @param p_port The port to bind to. Zero lets the kernel pick one, see getPort().
+     * @param p_backlog The maximum number of pending connections.
+     */
+    EXPORTED_API void listen(const CtString& p_interfaceName, CtUInt16 p_port, CtInt32 p_backlog = SOMAXCONN);
+
+    /**
+     * @brief Accept a pending connection of a listening socket.
+     *      CtSocketError is thrown if accepting fails.
+     * 
+     * @ref FR-006-004-001
+     * 
+     * @details
+     * The connection replaces the socket of p_client. In non-blocking mode CT_FALSE is returned
+     * if no connection is pending. The accepted socket is blocking.
+     * 
+     * @param p_client The socket to store the connection (output parameter).
+     * @param p_address Pointer to a CtNetAddress object to store the client's address (output parameter).
+     * @return CtBool CT_TRUE if a connection was accepted.
+     */
+    EXPORTED_API CtBool accept(CtSocketTcp* p_client, CtNetAddress* p_address = nullptr);
+
+    /**
+     * @brief Connect to a listening socket.
+     *      CtSocketError is thrown if the connection fails.
+     * 
+     * @ref FR-006-004-001
+     * @ref FR-006-004-002
+     * 
+     * @details
+     * In non-blocking mode CT_FALSE is returned while the connection is in progress. The
+     * connection is established when pollWrite() succeeds; finishConnect() reports the result.
+     * 
+     * @param p_port The port to connect to.
+     * @param p_addr The address to connect to.
+     * @return CtBool CT_TRUE if connected, CT_FALSE if the connection is in progress.
+     */
+    EXPORTED_API CtBool connect(CtUInt16 p_port, const CtString& p_addr);
+
+    /**
+     * @brief Check the result of a non-blocking connect().
+     *      CtSocketError is thrown if the connection failed.
+     * 
+     * @ref FR-006-004-002
+     * 
+     */
+    EXPORTED_API void finishConnect();
+
+    /**
+     * @brief Get the local port of the socket.
+     * 
+     * @ref FR-006-004-001
+     * 
+     * @return CtUInt16 The port.
+     */
+    EXPORTED_API CtUInt16 getPort();
+
+    /**
+     * @brief Check if there is data available to read or a connection to accept.
+     * 
+     * @ref FR-006-004-002
+     * 
+     * @return CtBool CT_TRUE if data is available, CT_FALSE otherwise.
+     */
+    EXPORTED_API CtBool pollRead();
+
+    /**
+     * @brief Check if data can be written to the socket.
+     * 
+     * @ref FR-006-004-002
+     * 
+     * @return CtBool CT_TRUE if there is space in the send buffer, CT_FALSE otherwise.
+     */
+    EXPORTED_API CtBool pollWrite();
+
+    /**
+     * @brief Send a view of bytes over the connection without copying them.
+     *      CtSocketWriteError is thrown if the connection is broken.
+     * 
+     * @ref FR-006-004-003
+     * 
+     * @details
+     * Fewer bytes may be sent than requested. In non-blocking mode zero is returned if the send
+     * buffer is full.
+     * 
+     * @param p_data The view of the data to sent.
+     * @return CtUInt32 The number of bytes sent.
+     */
+    EXPORTED_API CtUInt32 send(const CtRawDataView& p_data);
+
+    /**
+     * @brief Send several buffers with a single system call.
+     *      CtSocketWriteError is thrown if the connection is broken.
+     * 
+     * @ref FR-006-004-003
+     * 
+     * @details
+     * Fewer bytes may be sent than requested. In non-blocking mode zero is returned if the send
+     * buffer is full.
+     * 
+     * @param p_data Array of p_count views to sent in order.
+     * @param p_count The number of views.
+     * @return CtUInt32 The number of bytes sent.
+     */
+    EXPORTED_API CtUInt32 sendGather(const CtRawDataView* p_data, CtUInt32 p_count);
+
+    /**
+     * @brief Send all segments of a shared buffer with a single system call.
+     *      CtSocketWriteError is thrown if the connection is broken.
+     * 
+     * @ref FR-006-004-003
+     * 
+     * @param p_data The shared data to sent.
+     * @return CtUInt32 The number of bytes sent.
+     */
+    EXPORTED_API CtUInt32 send(const CtSharedData& p_data);
+
+    /**
+     * @brief Send a view of bytes with MSG_ZEROCOPY. The kernel sends the pages of the buffer itself.
+     *      CtSocketWriteError is thrown if the connection is broken.
+     * 
+     * @ref FR-006-004-005
+     * 
+     * @details
+     * setZeroCopy() must be enabled. The buffer must not be modified or released until the send
+     * is completed, see getZeroCopyPending(). Zero-copy pays off for large buffers only; the kernel
+     * copies the data anyway over loopback. In non-blocking mode zero is returned if the send
+     * buffer is full.
+     * 
+     * @param p_data The view of the data to sent.
+     * @return CtUInt32 The number of bytes sent.
+     */
+    EXPORTED_API CtUInt32 sendZeroCopy(const CtRawDataView& p_data);
+
+    /**
+     * @brief Read the completion notifications of sendZeroCopy() from the error queue.
+     * 
+     * @ref FR-006-004-005
+     * 
+     * @details
+     * Sends complete in order, so the buffers of the oldest sends may be reused once the number of
+     * pending sends drops.
+     * 
+     * @return CtUInt32 The number of zero-copy sends that are not completed yet.
+     */
+    EXPORTED_API CtUInt32 getZeroCopyPending();
+
+    /**
+     * @brief Receive data directly in the buffer of p_message.
+     *      CtSocketReadError is thrown if the connection is broken.
+     * 
+     * @ref FR-006-004-003
+     * @ref FR-006-004-006
+     * 
+     * @details
+     * Up to maxSize() bytes are received and the size of p_message is set to the bytes received.
+     * Zero is returned if the peer closed the connection, see isClosed(), or in non-blocking mode
+     * if no data are available.
+     * 
+     * @param p_message The buffer to store the data received.
+     * @return CtUInt32 The number of bytes received.
+     */
+    EXPORTED_API CtUInt32 receive(CtRawData* p_message);
+
+    /**
+     * @brief Receive data in several buffers with a single system call.
+     *      CtSocketReadError is thrown if the connection is broken.
+     * 
+     * @ref FR-006-004-003
+     * @ref FR-006-004-006
+     * 
+     * @details
+     * The buffers are filled in order up to their maxSize() and their sizes are set to the bytes
+     * stored in each of them. Zero is returned as for receive().
+     * 
+     * @param p_messages Array of p_count buffers.
+     * @param p_count The number of buffers.
+     * @return CtUInt32 The total number of bytes received.
+     */
+    EXPORTED_API CtUInt32 receiveScatter(CtRawData* p_messages, CtUInt32 p_count);
+
+    /**
+     * @brief Check if the peer closed the connection.
+     * 
+     * @ref FR-006-004-006
+     * 
+     * @return CtBool CT_TRUE if the end of the stream was received.
+     */
+    EXPORTED_API CtBool isClosed();
+
+    /**
+     * @brief Stop sending. The peer receives the end of the stream after the pending data.
+     * 
+     * @ref FR-006-004-006
+     * 
+     */
+    EXPORTED_API void shutdown();
+
+    /**
+     * @brief Get the file descriptor of the socket, e.g. to register it to a CtReactor.
+     * 
+     * @ref FR-006-004-002
+     * 
+     * @return CtInt32 The socket descriptor.
+     */
+    EXPORTED_API CtInt32 getFd();
+
+private:
+    /**
+     * @brief Set an integer socket option. CtSocketError is thrown on failure.
+     * 
+     * @param p_level The option level.
+     * @param p_option The option name.
+     * @param p_value The option value.
+     * @param p_name The option name used in the error message.
+     */
+    void setOption(CtInt32 p_level, CtInt32 p_option, CtInt32 p_value, const CtString& p_name);
+
+    /**
+     * @brief Parse an address and convert it to the family of the socket.
+     *      CtSocketError is thrown if the address is invalid or does not match the socket.
+     * 
+     * @param p_addr The IP address.
+     * @param p_port The port.
+     * @return CtNetAddress The address usable by the socket.
+     */
+    CtNetAddress toSocketFamily(const CtString& p_addr, CtUInt16 p_port);
+
+    /**
+     * @brief Replace the socket descriptor, closing the previous one.
+     * 
+     * @param p_socket The new socket descriptor.
+     */
+    void reset(CtInt32 p_socket);
+
+    /**
+     * @brief Send the buffers of a message header.
+     * 
+     * @param p_msg The message header.
+     * @param p_flags The flags of sendmsg().
+     * @return CtUInt32 The number of bytes sent.
+     */
+    CtUInt32 sendMessage(struct msghdr* p_msg, CtInt32 p_flags);
+
+private:
+    CtInt32 m_socket;                       /**< The socket descriptor. */
+    CtInt32 m_family;                       /**< The socket domain (IPv4 or IPv6). */
+    CtBool m_closed;                        /**< CT_TRUE if the peer closed the connection. */
+    CtUInt32 m_zcSent;                      /**< Number of zero-copy sends. */
+    CtUInt32 m_zcDone;                      /**< Number of completed zero-copy sends. */
+    CtVector<struct iovec> m_iovs;          /**< Scratch buffers of the gather and scatter methods. */
+};
+
+#endif //INCLUDE_CTSOCKETTCP_HPP_
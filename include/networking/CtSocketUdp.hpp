@@ -38,6 +38,35 @@ SOFTWARE.
 #include <unistd.h>
 #include <arpa/inet.h>
 #include <poll.h>
+#include <sys/socket.h>
+
+/**
+ * @brief Size of the control buffer used to receive the ancillary data of a datagram.
+ * 
+ */
+#define CT_UDP_CONTROL_SIZE     64u
+
+/**
+ * @brief Buffer size able to hold any datagram coalesced by the kernel with UDP_GRO.
+ * 
+ */
+#define CT_UDP_GRO_BUFFER_SIZE  65535u
+
+/**
+ * @brief Struct describing the kernel metadata of a received datagram.
+ * 
+ * @ref FR-006-001-022
+ * 
+ * @details
+ * timestamp is the kernel receive time in nanoseconds since the epoch, or zero if receive
+ * timestamps are not enabled. drops is the number of datagrams the kernel dropped on this
+ * socket because its receive buffer was full, or zero if drop counters are not enabled.
+ * 
+ */
+typedef struct _CtUdpRxInfo {
+    CtUInt64 timestamp;
+    CtUInt32 drops;
+} CtUdpRxInfo;
 
 /**
  * @class CtSocketUdp
@@ -78,6 +107,14 @@ SOFTWARE.
  * socket.send(message);
  * @endcode
  * 
+ * Example multicast subscriber:
+ * @code {.cpp}
+ * CtSocketUdp socket;
+ * socket.setReusePort(CT_TRUE);
+ * socket.setSub(CtNetAddress("0.0.0.0", 1234));
+ * socket.joinGroup("239.0.0.1", "eth0");
+ * @endcode
+ * 
  */
 class CtSocketUdp {
 public:
@@ -86,9 +123,15 @@ public:
      * 
      * @ref FR-006-001-001
      * @ref FR-006-001-003
+     * @ref FR-006-001-025
+     * 
+     * @details
+     * A DualStack socket is an IPv6 socket that also exchanges datagrams with IPv4 peers. Their
+     * addresses are reported as IPv4-mapped IPv6 addresses.
      * 
+     * @param p_family The IP version of the socket.
      */
-    EXPORTED_API CtSocketUdp();
+    EXPORTED_API explicit CtSocketUdp(CtNetFamily p_family = CtNetFamily::Ipv4);
 
     /**
      * @brief Destructor for CtSocketUdp.
@@ -98,6 +141,114 @@ public:
      */
     EXPORTED_API ~CtSocketUdp();
 
+    /**
+     * @brief Allow several sockets to bind to the same address and port. The kernel spreads the
+     *      incoming datagrams among them. It must be called before setSub().
+     * 
+     * @ref FR-006-001-019
+     * 
+     * @param p_enable CT_TRUE to enable SO_REUSEPORT.
+     */
+    EXPORTED_API void setReusePort(CtBool p_enable);
+
+    /**
+     * @brief Set the size of the kernel receive buffer.
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-001-020
+     * 
+     * @details
+     * Without p_force the size is limited by net.core.rmem_max. With p_force SO_RCVBUFFORCE is used,
+     * which ignores the limit but needs CAP_NET_ADMIN. The kernel doubles the value for bookkeeping.
+     * 
+     * @param p_size The size in bytes.
+     * @param p_force CT_TRUE to exceed the system limit.
+     */
+    EXPORTED_API void setReceiveBuffer(CtUInt32 p_size, CtBool p_force = CT_FALSE);
+
+    /**
+     * @brief Get the size of the kernel receive buffer as reported by the kernel.
+     * 
+     * @ref FR-006-001-020
+     * 
+     * @return CtUInt32 The size in bytes.
+     */
+    EXPORTED_API CtUInt32 getReceiveBuffer();
+
+    /**
+     * @brief Set the size of the kernel send buffer.
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-001-020
+     * 
+     * @details
+     * Without p_force the size is limited by net.core.wmem_max. With p_force SO_SNDBUFFORCE is used,
+     * which ignores the limit but needs CAP_NET_ADMIN.
+     * 
+     * @param p_size The size in bytes.
+     * @param p_force CT_TRUE to exceed the system limit.
+     */
+    EXPORTED_API void setSendBuffer(CtUInt32 p_size, CtBool p_force = CT_FALSE);
+
+    /**
+     * @brief Get the size of the kernel send buffer as reported by the kernel.
+     * 
+     * @ref FR-006-001-020
+     * 
+     * @return CtUInt32 The size in bytes.
+     */
+    EXPORTED_API CtUInt32 getSendBuffer();
+
+    /**
+     * @brief Busy poll the device queue for up to p_usec microseconds on blocking receives.
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-001-021
+     * 
+     * @param p_usec Busy poll time in microseconds. Zero disables busy polling.
+     */
+    EXPORTED_API void setBusyPoll(CtUInt32 p_usec);
+
+    /**
+     * @brief Set the type of service field of the sent packets. IP_TOS is set on IPv4 sockets,
+     *      IPV6_TCLASS on IPv6 sockets and both on dual-stack sockets.
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-001-021
+     * 
+     * @param p_tos The type of service (DSCP and ECN bits).
+     */
+    EXPORTED_API void setTos(CtUInt8 p_tos);
+
+    /**
+     * @brief Enable kernel receive timestamps, returned in CtUdpRxInfo.
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-001-022
+     * 
+     * @param p_enable CT_TRUE to enable SO_TIMESTAMPNS.
+     */
+    EXPORTED_API void setTimestamps(CtBool p_enable);
+
+    /**
+     * @brief Enable the kernel drop counter, returned in CtUdpRxInfo and by getDrops().
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-001-022
+     * 
+     * @param p_enable CT_TRUE to enable SO_RXQ_OVFL.
+     */
+    EXPORTED_API void setDropCounter(CtBool p_enable);
+
+    /**
+     * @brief The number of datagrams dropped by the kernel as reported with the last received datagram.
+     * 
+     * @ref FR-006-001-022
+     * 
+     * @return CtUInt32 The number of dropped datagrams.
+     */
+    EXPORTED_API CtUInt32 getDrops();
+
     /**
      * @brief Set the socket for subscribing.
      * 
@@ -108,6 +259,16 @@ public:
      */
     EXPORTED_API void setSub(const CtString& p_interfaceName, CtUInt16 p_port);
 
+    /**
+     * @brief Set the socket for subscribing on a specific address, e.g. "::" for all interfaces.
+     * 
+     * @ref FR-006-001-004
+     * @ref FR-006-001-025
+     * 
+     * @param p_address The address and port to bind to.
+     */
+    EXPORTED_API void setSub(const CtNetAddress& p_address);
+
     /**
      * @brief Set the socket for publishing.
      * 
@@ -118,6 +279,102 @@ public:
      */
     EXPORTED_API void setPub(CtUInt16 p_port, const CtString& p_addr = "0.0.0.0");
 
+    /**
+     * @brief Set the socket for publishing to an address, e.g. the sender of a received datagram.
+     * 
+     * @ref FR-006-001-005
+     * @ref FR-006-001-025
+     * 
+     * @param p_address The address and port to send data to.
+     */
+    EXPORTED_API void setPub(const CtNetAddress& p_address);
+
+    /**
+     * @brief Join a multicast group to receive the datagrams sent to it.
+     *      CtSocketError is thrown if the group cannot be joined.
+     * 
+     * @ref FR-006-001-026
+     * 
+     * @details
+     * The socket must be bound with setSub() to the wildcard address, or to the group address to
+     * receive nothing else, and the port of the group. Several sockets of the same host may join
+     * the same group if setReusePort() is enabled; each one receives a copy of every datagram.
+     * Once a group is joined, the socket receives only the groups it joined itself, not the ones
+     * joined by other sockets of the host. A dual-stack socket can join IPv4 and IPv6 groups.
+     * 
+     * @param p_group The multicast group address.
+     * @param p_interfaceName The interface to join on. Empty lets the kernel choose by route.
+     */
+    EXPORTED_API void joinGroup(const CtString& p_group, const CtString& p_interfaceName = "");
+
+    /**
+     * @brief Leave a multicast group joined with joinGroup().
+     *      CtSocketError is thrown if the group cannot be left.
+     * 
+     * @ref FR-006-001-026
+     * 
+     * @param p_group The multicast group address.
+     * @param p_interfaceName The interface the group was joined on.
+     */
+    EXPORTED_API void leaveGroup(const CtString& p_group, const CtString& p_interfaceName = "");
+
+    /**
+     * @brief Join a multicast group accepting only the datagrams of one source (source-specific multicast).
+     *      CtSocketError is thrown if the group cannot be joined.
+     * 
+     * @ref FR-006-001-027
+     * 
+     * @details
+     * It may be called several times with the same group to accept more sources.
+     * 
+     * @param p_group The multicast group address.
+     * @param p_source The address of the accepted sender.
+     * @param p_interfaceName The interface to join on. Empty lets the kernel choose by route.
+     */
+    EXPORTED_API void joinSourceGroup(const CtString& p_group, const CtString& p_source, const CtString& p_interfaceName = "");
+
+    /**
+     * @brief Stop accepting a source joined with joinSourceGroup().
+     *      CtSocketError is thrown if the source cannot be left.
+     * 
+     * @ref FR-006-001-027
+     * 
+     * @param p_group The multicast group address.
+     * @param p_source The address of the sender.
+     * @param p_interfaceName The interface the group was joined on.
+     */
+    EXPORTED_API void leaveSourceGroup(const CtString& p_group, const CtString& p_source, const CtString& p_interfaceName = "");
+
+    /**
+     * @brief Select if multicast datagrams sent by this socket are delivered to the sockets of this host.
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-001-028
+     * 
+     * @param p_enable CT_TRUE to loop the datagrams back. Enabled by default.
+     */
+    EXPORTED_API void setMulticastLoop(CtBool p_enable);
+
+    /**
+     * @brief Set how many routers the multicast datagrams sent by this socket may cross.
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-001-028
+     * 
+     * @param p_ttl The time to live (hop limit for IPv6). Defaults to 1, the local network.
+     */
+    EXPORTED_API void setMulticastTtl(CtUInt8 p_ttl);
+
+    /**
+     * @brief Select the interface the multicast datagrams of this socket are sent from.
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-001-028
+     * 
+     * @param p_interfaceName The interface name.
+     */
+    EXPORTED_API void setMulticastInterface(const CtString& p_interfaceName);
+
     /**
      * @brief Check if there is data available to read.
      * 
@@ -159,17 +416,42 @@ public:
      */
     EXPORTED_API void send(CtRawData& p_message);
 
+    /**
+     * @brief Send a view of bytes over the socket without copying them.
+     * 
+     * @ref FR-006-001-013
+     * 
+     * @param p_data The view of the data to sent.
+     */
+    EXPORTED_API void send(const CtRawDataView& p_data);
+
+    /**
+     * @brief Send a shared buffer over the socket as one datagram.
+     *      All segments are passed to the kernel with a single call without being copied.
+     * 
+     * @ref FR-006-001-014
+     * 
+     * @param p_data The shared data to sent.
+     */
+    EXPORTED_API void send(const CtSharedData& p_data);
+
     /**
      * @brief Receive data from the socket.
      * 
      * @ref FR-006-001-010
      * @ref FR-006-001-012
      * 
-     * @param p_data Buffer containing the data to sent.
+     * @ref FR-006-001-017
+     * 
+     * @details
+     * A NUL byte is written after the data only if it fits in the buffer.
+     * 
+     * @param p_data Buffer to store the data received.
      * @param p_size Size of the buffer.
      * @param p_client Pointer to a CtNetAddress object to store the client's address (output parameter).
+     * @return CtUInt32 The number of bytes received.
      */
-    EXPORTED_API void receive(CtUInt8* p_data, CtUInt32 p_size, CtNetAddress* p_client = nullptr);
+    EXPORTED_API CtUInt32 receive(CtUInt8* p_data, CtUInt32 p_size, CtNetAddress* p_client = nullptr);
 
     /**
      * @brief Receive data from the socket.
@@ -177,10 +459,216 @@ public:
      * @ref FR-006-001-010
      * @ref FR-006-001-012
      * 
+     * @ref FR-006-001-017
+     * 
+     * @details
+     * The datagram is received directly in the buffer of p_message and its size is set to the
+     * number of bytes received. No memory is allocated and the data are not copied.
+     * 
+     * @param p_message Struct to store the message received.
+     * @param p_clientAddress Pointer to a CtNetAddress object to store the client's address (output parameter).
+     * @return CtUInt32 The number of bytes received.
+     */
+    EXPORTED_API CtUInt32 receive(CtRawData* p_message, CtNetAddress* p_clientAddress = nullptr);
+
+    /**
+     * @brief Receive data from the socket together with its kernel metadata.
+     * 
+     * @ref FR-006-001-022
+     * 
      * @param p_message Struct to store the message received.
      * @param p_clientAddress Pointer to a CtNetAddress object to store the client's address (output parameter).
+     * @param p_info Struct to store the timestamp and the drop counter (output parameter).
+     * @return CtUInt32 The number of bytes received.
+     */
+    EXPORTED_API CtUInt32 receive(CtRawData* p_message, CtNetAddress* p_clientAddress, CtUdpRxInfo* p_info);
+
+    /**
+     * @brief Receive up to p_count datagrams with a single system call.
+     * 
+     * @ref FR-006-001-015
+     * 
+     * @details
+     * Every datagram is stored directly in the buffer of the corresponding CtRawData and its
+     * size is set to the datagram length. Datagrams longer than the maximum size are truncated.
+     * The call does not block; zero is returned if no datagram is available.
+     * 
+     * @param p_messages Array of p_count buffers to store the datagrams.
+     * @param p_count The number of buffers.
+     * @param p_clients Optional array of p_count addresses to store the senders (output parameter).
+     * @param p_infos Optional array of p_count structs to store the kernel metadata (output parameter).
+     * @return CtUInt32 The number of datagrams received.
+     */
+    EXPORTED_API CtUInt32 receiveBatch(CtRawData* p_messages, CtUInt32 p_count, CtNetAddress* p_clients = nullptr, CtUdpRxInfo* p_infos = nullptr);
+
+    /**
+     * @brief Send up to p_count datagrams with as few system calls as possible.
+     * 
+     * @ref FR-006-001-016
+     * 
+     * @details
+     * The call does not block. If the socket buffer is full fewer datagrams are sent.
+     * 
+     * @param p_messages Array of p_count views, each one sent as a datagram.
+     * @param p_count The number of datagrams.
+     * @return CtUInt32 The number of datagrams sent.
+     */
+    EXPORTED_API CtUInt32 sendBatch(const CtRawDataView* p_messages, CtUInt32 p_count);
+
+    /**
+     * @brief Send up to p_count datagrams with as few system calls as possible.
+     * 
+     * @ref FR-006-001-016
+     * 
+     * @param p_messages Array of p_count buffers, each one sent as a datagram.
+     * @param p_count The number of datagrams.
+     * @return CtUInt32 The number of datagrams sent.
+     */
+    EXPORTED_API CtUInt32 sendBatch(CtRawData* p_messages, CtUInt32 p_count);
+
+    /**
+     * @brief Send a buffer as a stream of equal-sized datagrams using UDP segmentation offload.
+     *      CtSocketWriteError is thrown if the kernel rejects the datagrams.
+     * 
+     * @ref FR-006-001-023
+     * 
+     * @details
+     * p_data is split in datagrams of p_segmentSize bytes, the last one may be shorter. The kernel
+     * (or the network card) does the split, so up to 64 datagrams are passed with one system call.
+     * The call does not block. If the socket buffer is full fewer datagrams are sent.
+     * 
+     * @param p_data The data to sent.
+     * @param p_segmentSize The payload size of every datagram.
+     * @return CtUInt32 The number of datagrams sent.
+     */
+    EXPORTED_API CtUInt32 sendSegmented(const CtRawDataView& p_data, CtUInt16 p_segmentSize);
+
+    /**
+     * @brief Send p_count datagrams using UDP segmentation offload without copying them.
+     *      CtSocketWriteError is thrown if the kernel rejects the datagrams.
+     * 
+     * @ref FR-006-001-023
+     * 
+     * @details
+     * Consecutive datagrams of the same size are gathered and passed to the kernel with one system
+     * call. A shorter datagram closes the group. Best throughput is achieved when all datagrams but
+     * the last have the same size. The call does not block.
+     * 
+     * @param p_messages Array of p_count views, each one sent as a datagram.
+     * @param p_count The number of datagrams.
+     * @return CtUInt32 The number of datagrams sent.
+     */
+    EXPORTED_API CtUInt32 sendSegmented(const CtRawDataView* p_messages, CtUInt32 p_count);
+
+    /**
+     * @brief Let the kernel coalesce datagrams of the same flow before they are received.
+     *      CtSocketError is thrown if the option cannot be set.
+     * 
+     * @ref FR-006-001-024
+     * 
+     * @param p_enable CT_TRUE to enable UDP_GRO.
+     */
+    EXPORTED_API void setGro(CtBool p_enable);
+
+    /**
+     * @brief Receive a coalesced datagram and split it back into the original datagrams.
+     * 
+     * @ref FR-006-001-024
+     * 
+     * @details
+     * The data are received directly in p_buffer, which should hold CT_UDP_GRO_BUFFER_SIZE bytes.
+     * p_segments is filled with one view per original datagram pointing in p_buffer, so the views
+     * are valid until p_buffer is modified. Without UDP_GRO, or if the kernel did not coalesce
+     * anything, a single view is returned. The call does not block; zero is returned if no
+     * datagram is available.
+     * 
+     * @param p_buffer The buffer to store the data received.
+     * @param p_segments The views of the datagrams (output parameter).
+     * @param p_client Pointer to a CtNetAddress object to store the client's address (output parameter).
+     * @return CtUInt32 The number of datagrams received.
+     */
+    EXPORTED_API CtUInt32 receiveSegmented(CtRawData* p_buffer, CtVector<CtRawDataView>* p_segments, CtNetAddress* p_client = nullptr);
+
+    /**
+     * @brief Get the file descriptor of the socket, e.g. to register it to a CtReactor.
+     * 
+     * @ref FR-006-001-018
+     * 
+     * @return CtInt32 The socket descriptor.
+     */
+    EXPORTED_API CtInt32 getFd();
+
+private:
+    /**
+     * @brief Make sure that the scratch arrays of the batch methods hold p_count entries.
+     * 
+     * @param p_count The number of entries.
+     */
+    void reserveBatch(CtUInt32 p_count);
+
+    /**
+     * @brief Send the messages prepared in the scratch arrays.
+     * 
+     * @param p_count The number of prepared messages.
+     * @return CtUInt32 The number of datagrams sent.
+     */
+    CtUInt32 sendPrepared(CtUInt32 p_count);
+
+    /**
+     * @brief Set an integer socket option. CtSocketError is thrown on failure.
+     * 
+     * @param p_level The option level.
+     * @param p_option The option name.
+     * @param p_value The option value.
+     * @param p_name The option name used in the error message.
+     */
+    void setOption(CtInt32 p_level, CtInt32 p_option, CtInt32 p_value, const CtString& p_name);
+
+    /**
+     * @brief Get an integer socket option. CtSocketError is thrown on failure.
+     * 
+     * @param p_level The option level.
+     * @param p_option The option name.
+     * @return CtInt32 The option value.
+     */
+    CtInt32 getOption(CtInt32 p_level, CtInt32 p_option);
+
+    /**
+     * @brief Send the gathered buffers of m_iovs as datagrams of p_segmentSize bytes.
+     * 
+     * @param p_count The number of gathered buffers.
+     * @param p_segmentSize The payload size of every datagram.
+     * @return CtBool CT_TRUE if sent, CT_FALSE if the socket buffer is full.
+     */
+    CtBool sendGathered(CtUInt32 p_count, CtUInt16 p_segmentSize);
+
+    /**
+     * @brief Parse the ancillary data of a received datagram.
+     * 
+     * @param p_msg The message header of the datagram.
+     * @param p_info The struct to be filled.
+     */
+    void parseControl(struct msghdr* p_msg, CtUdpRxInfo* p_info);
+
+    /**
+     * @brief Convert an address to the family of the socket.
+     *      CtSocketError is thrown if an IPv6 address is used with an IPv4 socket.
+     * 
+     * @param p_address The address.
+     * @return CtNetAddress The address usable by the socket.
+     */
+    CtNetAddress toSocketFamily(const CtNetAddress& p_address);
+
+    /**
+     * @brief Join or leave a multicast group, optionally for one source only.
+     *      CtSocketError is thrown on failure.
+     * 
+     * @param p_option MCAST_JOIN_GROUP, MCAST_LEAVE_GROUP, MCAST_JOIN_SOURCE_GROUP or MCAST_LEAVE_SOURCE_GROUP.
+     * @param p_group The multicast group address.
+     * @param p_source The source address, empty for any source.
+     * @param p_interfaceName The interface name, empty for the default.
      */
-    EXPORTED_API void receive(CtRawData* p_message, CtNetAddress* p_clientAddress = nullptr);
+    void setMembership(CtInt32 p_option, const CtString& p_group, const CtString& p_source, const CtString& p_interfaceName);
 
 private:
     int m_addrType;                         /**< The socket domain (IPv4 or IPv6). */
@@ -189,8 +677,12 @@ private:
     CtString m_addr;                        /**< The address associated with the socket. */
     struct pollfd m_pollin_sockets[1];      /**< Array for polling-in file descriptors. */
     struct pollfd m_pollout_sockets[1];     /**< Array for polling-out file descriptors. */
-    sockaddr_in m_pubAddress;               /**< The address for publishing data. */
-    sockaddr_in m_subAddress;               /**< The address for subscribing to data. */
+    CtNetAddress m_pubAddress;              /**< The address for publishing data. */
+    CtNetAddress m_subAddress;              /**< The address for subscribing to data. */
+    CtVector<struct mmsghdr> m_msgs;        /**< Scratch message headers of the batch methods. */
+    CtVector<struct iovec> m_iovs;          /**< Scratch buffers of the batch methods. */
+    CtVector<CtUInt8> m_control;            /**< Scratch ancillary data of receiveBatch(). */
+    CtUInt32 m_drops;                       /**< Last drop counter reported by the kernel. */
 };
 
 #endif //INCLUDE_CTSOCKETUDP_HPP_
@@ -0,0 +1,227 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtSocketUdpSharded.hpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTSOCKETUDPSHARDED_HPP_
+#define INCLUDE_CTSOCKETUDPSHARDED_HPP_
+
+#include "core.hpp"
+#include "networking/CtSocketUdp.hpp"
+#include "threading/CtWorker.hpp"
+
+#include <functional>
+#include <memory>
+
+/**
+ * @brief Maximum number of datagrams received by a shard with a single system call.
+ * 
+ */
+#define CT_SHARD_BATCH          32u
+
+/**
+ * @brief Timeout in milliseconds a shard waits for data before it checks if it must stop.
+ * 
+ */
+#define CT_SHARD_TIMEOUT        100
+
+/**
+ * @brief Callback of CtSocketUdpSharded. It gets the shard index and a batch of received datagrams.
+ * 
+ */
+typedef std::function<void(CtUInt32, CtRawData*, CtUInt32)> CtShardCallback;
+
+/**
+ * @class CtSocketUdpSharded
+ * @brief A UDP receiver that spreads one port over several sockets and threads.
+ * 
+ * @ref FR-006-003-001
+ * 
+ * @details
+ * N sockets are bound to the same address and port with SO_REUSEPORT, so the kernel spreads the
+ * incoming datagrams among them. Every socket is serviced by its own thread that receives in
+ * batches and calls the callback with the shard index. Threads can be pinned to CPUs.
+ * 
+ * By default the kernel picks a socket by hashing the sender address and port. With CPU steering
+ * a BPF program picks shard c modulo the number of shards for a packet handled by CPU c, so all
+ * datagrams of one CPU go to one shard. Only when there is one shard per CPU (the default) and
+ * the threads are pinned, a datagram is processed by the thread pinned to the CPU that received it.
+ * 
+ * An exception thrown while a shard receives or by the callback does not stop the shard. It is
+ * counted and can be read with getErrors().
+ * 
+ * @code {.cpp}
+ * CtSocketUdpSharded receiver(4);
+ * receiver.setCpuSteering(CT_TRUE);
+ * receiver.setSub("lo", 5000);
+ * receiver.runShards([](CtUInt32 shard, CtRawData* messages, CtUInt32 count) {
+ *     // process messages of the shard
+ * });
+ * // ...
+ * receiver.stopShards();
+ * @endcode
+ * 
+ */
+class CtSocketUdpSharded {
+public:
+    /**
+     * @brief Constructor for CtSocketUdpSharded.
+     * 
+     * @ref FR-006-003-002
+     * 
+     * @param p_shards The number of sockets and threads. If zero the number of CPUs is used.
+     */
+    EXPORTED_API explicit CtSocketUdpSharded(CtUInt32 p_shards = 0);
+
+    /**
+     * @brief Destructor for CtSocketUdpSharded. It stops the shard threads.
+     * 
+     * @ref FR-006-003-002
+     * 
+     */
+    EXPORTED_API ~CtSocketUdpSharded();
+
+    /**
+     * @brief Steer datagrams to the socket of the CPU that received them with a BPF program.
+     *      It must be called before setSub().
+     * 
+     * @ref FR-006-003-003
+     * 
+     * @param p_enable CT_TRUE to enable CPU steering.
+     */
+    EXPORTED_API void setCpuSteering(CtBool p_enable);
+
+    /**
+     * @brief Bind all sockets to the same interface and port.
+     *      CtSocketBindError is thrown if a socket cannot be bound and CtSocketError if
+     *      the steering program cannot be attached.
+     * 
+     * @ref FR-006-003-002
+     * @ref FR-006-003-003
+     * 
+     * @param p_interfaceName The interface name to bind to.
+     * @param p_port The port to bind to.
+     */
+    EXPORTED_API void setSub(const CtString& p_interfaceName, CtUInt16 p_port);
+
+    /**
+     * @brief Start one thread per shard. Every thread receives datagrams of its socket in batches
+     *      and calls the callback. CtThreadError is thrown if the shards already run or if a
+     *      thread must be pinned to a CPU that is not available to the process.
+     * 
+     * @ref FR-006-003-004
+     * 
+     * @param p_callback The function called for every received batch.
+     * @param p_pin CT_TRUE to pin the thread of shard i to CPU i modulo the number of CPUs.
+     */
+    EXPORTED_API void runShards(const CtShardCallback& p_callback, CtBool p_pin = CT_TRUE);
+
+    /**
+     * @brief Stop the shard threads and wait for them.
+     * 
+     * @ref FR-006-003-004
+     * 
+     */
+    EXPORTED_API void stopShards();
+
+    /**
+     * @brief The number of shards.
+     * 
+     * @ref FR-006-003-002
+     * 
+     * @return CtUInt32 The number of shards.
+     */
+    EXPORTED_API CtUInt32 shards();
+
+    /**
+     * @brief The number of datagrams received by a shard.
+     *      If the index is out of range an exception will be thrown - CtOutOfRangeError()
+     * 
+     * @ref FR-006-003-005
+     * 
+     * @param p_shard The shard index.
+     * @return CtUInt64 The number of datagrams.
+     */
+    EXPORTED_API CtUInt64 getReceived(CtUInt32 p_shard);
+
+    /**
+     * @brief The number of errors of a shard: exceptions thrown while receiving or by the
+     *      callback, and a failure to pin the thread to its CPU.
+     *      If the index is out of range an exception will be thrown - CtOutOfRangeError()
+     * 
+     * @ref FR-006-003-006
+     * 
+     * @param p_shard The shard index.
+     * @return CtUInt64 The number of errors.
+     */
+    EXPORTED_API CtUInt64 getErrors(CtUInt32 p_shard);
+
+private:
+    /**
+     * @struct CtShard
+     * @brief A socket with the thread that services it.
+     * 
+     */
+    typedef struct _CtShard {
+        CtSocketUdp socket;
+        CtWorker worker;
+        CtAtomic<CtUInt64> received;
+        CtAtomic<CtUInt64> errors;
+    } CtShard;
+
+    /**
+     * @brief Receive loop of a shard thread.
+     * 
+     * @param p_idx The shard index.
+     * @param p_pin Pin the thread to a CPU.
+     */
+    void shardLoop(CtUInt32 p_idx, CtBool p_pin);
+
+    /**
+     * @brief The CPU the thread of a shard is pinned to.
+     * 
+     * @param p_idx The shard index.
+     * @return CtUInt32 The CPU index.
+     */
+    CtUInt32 shardCpu(CtUInt32 p_idx);
+
+    /**
+     * @brief Attach the CPU steering program to the reuseport group.
+     * 
+     */
+    void attachSteering();
+
+private:
+    CtVector<std::unique_ptr<CtShard>> m_shards;    /*!< The shards. */
+    CtBool m_steering;                              /*!< CPU steering is enabled. */
+    CtAtomic<CtBool> m_running;                     /*!< The shard threads run. */
+    CtShardCallback m_callback;                     /*!< Function called for every received batch. */
+};
+
+#endif //INCLUDE_CTSOCKETUDPSHARDED_HPP_
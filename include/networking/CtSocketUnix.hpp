@@ -0,0 +1,275 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtSocketUnix.hpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTSOCKETUNIX_HPP_
+#define INCLUDE_CTSOCKETUNIX_HPP_
+
+#include "core.hpp"
+
+#include <cstring>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/**
+ * @class CtSocketUnix
+ * @brief A class representing a Unix domain socket wrapper for processes of the same host.
+ * 
+ * @ref FR-006-005-001
+ * 
+ * @details
+ * A datagram socket is used like CtSocketUdp with a path instead of an interface and port: the
+ * receiver binds with setSub() and the sender selects the receiver with setPub(). A stream socket
+ * is used like CtSocketTcp with listen(), accept() and connect(). Paths starting with '@' are
+ * placed in the abstract namespace and leave no file behind.
+ * 
+ * All calls are non-blocking; pollRead() and pollWrite() wait up to CtSocketHelpers::socketTimeout.
+ * File descriptors, e.g. the memory of a CtShmRing, can be passed to the peer with sendFd().
+ * 
+ * @code {.cpp}
+ * CtSocketUnix receiver;
+ * receiver.setSub("@service");
+ * CtSocketUnix sender;
+ * sender.setPub("@service");
+ * sender.send(CtRawDataView((const CtUInt8*)"ping", 4));
+ * CtRawData message;
+ * if (receiver.pollRead()) {
+ *      receiver.receive(&message);
+ * }
+ * @endcode
+ * 
+ */
+class CtSocketUnix {
+public:
+    /**
+     * @brief Enum representing the socket type.
+     * 
+     */
+    enum class Type {
+        Datagram,   /**< Message oriented socket, SOCK_DGRAM. */
+        Stream      /**< Connection oriented byte stream, SOCK_STREAM. */
+    };
+
+    /**
+     * @brief Constructor for CtSocketUnix.
+     *      CtSocketError is thrown if the socket cannot be created.
+     * 
+     * @ref FR-006-005-001
+     * 
+     * @param p_type The socket type.
+     */
+    EXPORTED_API explicit CtSocketUnix(Type p_type = Type::Datagram);
+
+    /**
+     * @brief Destructor for CtSocketUnix. The socket file created by setSub() or listen() is removed.
+     * 
+     * @ref FR-006-005-001
+     * 
+     */
+    EXPORTED_API ~CtSocketUnix();
+
+    /**
+     * @brief Bind a datagram socket to a path for receiving.
+     *      CtSocketBindError is thrown if the socket cannot be bound.
+     * 
+     * @ref FR-006-005-002
+     * 
+     * @param p_path The socket path. A leading '@' selects the abstract namespace.
+     */
+    EXPORTED_API void setSub(const CtString& p_path);
+
+    /**
+     * @brief Set the path datagrams are sent to.
+     * 
+     * @ref FR-006-005-002
+     * 
+     * @param p_path The socket path of the receiver.
+     */
+    EXPORTED_API void setPub(const CtString& p_path);
+
+    /**
+     * @brief Bind a stream socket to a path and accept connections.
+     *      CtSocketBindError is thrown if the socket cannot be bound or cannot listen.
+     * 
+     * @ref FR-006-005-003
+     * 
+     * @param p_path The socket path. A leading '@' selects the abstract namespace.
+     * @param p_backlog The maximum number of pending connections.
+     */
+    EXPORTED_API void listen(const CtString& p_path, CtInt32 p_backlog = SOMAXCONN);
+
+    /**
+     * @brief Accept a pending connection of a listening socket.
+     *      CtSocketError is thrown if accepting fails.
+     * 
+     * @ref FR-006-005-003
+     * 
+     * @param p_client The socket to store the connection (output parameter).
+     * @return CtBool CT_TRUE if a connection was accepted, CT_FALSE if none is pending.
+     */
+    EXPORTED_API CtBool accept(CtSocketUnix* p_client);
+
+    /**
+     * @brief Connect a stream socket to a listening socket.
+     *      CtSocketError is thrown if the connection fails.
+     * 
+     * @ref FR-006-005-003
+     * 
+     * @param p_path The socket path of the listener.
+     * @return CtBool CT_TRUE if connected, CT_FALSE if the backlog of the listener is full.
+     */
+    EXPORTED_API CtBool connect(const CtString& p_path);
+
+    /**
+     * @brief Check if there is data available to read or a connection to accept.
+     * 
+     * @ref FR-006-005-004
+     * 
+     * @return CtBool CT_TRUE if data is available, CT_FALSE otherwise.
+     */
+    EXPORTED_API CtBool pollRead();
+
+    /**
+     * @brief Check if data can be written to the socket.
+     * 
+     * @ref FR-006-005-004
+     * 
+     * @return CtBool CT_TRUE if data can be written, CT_FALSE otherwise.
+     */
+    EXPORTED_API CtBool pollWrite();
+
+    /**
+     * @brief Send a view of bytes, as one datagram or appended to the stream.
+     *      CtSocketWriteError is thrown if sending fails.
+     * 
+     * @ref FR-006-005-004
+     * 
+     * @param p_data The view of the data to sent.
+     * @return CtUInt32 The number of bytes sent. Zero if the socket buffer is full.
+     */
+    EXPORTED_API CtUInt32 send(const CtRawDataView& p_data);
+
+    /**
+     * @brief Receive a datagram or the available stream data directly in the buffer of p_message.
+     *      CtSocketReadError is thrown if receiving fails.
+     * 
+     * @ref FR-006-005-004
+     * 
+     * @details
+     * Zero is returned if no data are available or if the peer of a stream socket closed the
+     * connection, see isClosed().
+     * 
+     * @param p_message The buffer to store the data received.
+     * @return CtUInt32 The number of bytes received.
+     */
+    EXPORTED_API CtUInt32 receive(CtRawData* p_message);
+
+    /**
+     * @brief Pass a file descriptor to the peer together with some data.
+     *      CtSocketWriteError is thrown if sending fails.
+     * 
+     * @ref FR-006-005-005
+     * 
+     * @details
+     * The peer gets its own descriptor of the same open file. If p_data is empty a single zero
+     * byte is sent, since the descriptor cannot travel without data.
+     * 
+     * @param p_fd The descriptor to pass.
+     * @param p_data The data sent with the descriptor.
+     * @return CtBool CT_TRUE if sent, CT_FALSE if the socket buffer is full.
+     */
+    EXPORTED_API CtBool sendFd(CtInt32 p_fd, const CtRawDataView& p_data = CtRawDataView());
+
+    /**
+     * @brief Receive a file descriptor passed by the peer with sendFd().
+     *      CtSocketReadError is thrown if receiving fails.
+     * 
+     * @ref FR-006-005-005
+     * 
+     * @param p_message Optional buffer to store the data sent with the descriptor.
+     * @return CtInt32 The received descriptor, -1 if no descriptor is available.
+     */
+    EXPORTED_API CtInt32 receiveFd(CtRawData* p_message = nullptr);
+
+    /**
+     * @brief Check if the peer of a stream socket closed the connection.
+     * 
+     * @ref FR-006-005-003
+     * 
+     * @return CtBool CT_TRUE if the end of the stream was received.
+     */
+    EXPORTED_API CtBool isClosed();
+
+    /**
+     * @brief Get the file descriptor of the socket, e.g. to register it to a CtReactor.
+     * 
+     * @ref FR-006-005-004
+     * 
+     * @return CtInt32 The socket descriptor.
+     */
+    EXPORTED_API CtInt32 getFd();
+
+private:
+    /**
+     * @brief Fill a Unix socket address.
+     *      CtSocketError is thrown if the path is too long.
+     * 
+     * @param p_path The socket path. A leading '@' selects the abstract namespace.
+     * @param p_address The address to fill (output parameter).
+     * @return socklen_t The length of the address.
+     */
+    static socklen_t toAddress(const CtString& p_path, sockaddr_un* p_address);
+
+    /**
+     * @brief Bind the socket to a path and remember it so that it is removed on destruction.
+     * 
+     * @param p_path The socket path.
+     */
+    void bindPath(const CtString& p_path);
+
+    /**
+     * @brief Replace the socket descriptor, closing the previous one.
+     * 
+     * @param p_socket The new socket descriptor.
+     */
+    void reset(CtInt32 p_socket);
+
+private:
+    Type m_type;                            /**< The socket type. */
+    CtInt32 m_socket;                       /**< The socket descriptor. */
+    CtBool m_closed;                        /**< CT_TRUE if the peer closed the connection. */
+    CtString m_path;                        /**< The path of the socket file to remove, if any. */
+    sockaddr_un m_pubAddress;               /**< The address for publishing data. */
+    socklen_t m_pubLength;                  /**< The length of m_pubAddress, zero if not set. */
+};
+
+#endif //INCLUDE_CTSOCKETUNIX_HPP_
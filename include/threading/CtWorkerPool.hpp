@@ -37,6 +37,7 @@ SOFTWARE.
 #include "threading/CtWorker.hpp"
 #include "threading/CtThread.hpp"
 #include "threading/CtTask.hpp"
+#include "utils/CtLogContext.hpp"
 
 #include <functional>
 
@@ -95,6 +96,16 @@ public:
      */
     EXPORTED_API void addTask(const CtTask& task);
 
+    /**
+     * @brief Add a task to the worker pool that runs with a log context, e.g. the id of the request it serves.
+     * 
+     * @ref FR-004-008-002
+     * 
+     * @param task The task to be added to the pool.
+     * @param context The CtLogContext of the worker thread while the task runs.
+     */
+    EXPORTED_API void addTask(const CtTask& task, const CtLogContext& context);
+
     /**
      * @brief Add a task function to the worker pool.
      * 
@@ -35,7 +35,38 @@ SOFTWARE.
 #include "core.hpp"
 
 #include "io/CtFileOutput.hpp"
-#include "io/CtFileInput.hpp"
+#include "threading/CtThread.hpp"
+#include "utils/CtConfigValue.hpp"
+#include "utils/CtObject.hpp"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+
+#define CT_CONFIG_WATCH_INTERVAL    100u        /**< Milliseconds between two checks of the stop request by the file watcher. */
+#define CT_CONFIG_KEY_EVENTS        0x100u      /**< First event code returned by CtConfig::watchKey(). */
+
+/**
+ * @brief Hash of configuration keys, so that keys are looked up as std::string_view without a copy.
+ * 
+ * @ref FR-004-001-004
+ */
+struct CtConfigKeyHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view p_key) const noexcept {
+        return std::hash<std::string_view>{}(p_key);
+    }
+};
+
+/**
+ * @brief The configuration values by key.
+ * 
+ * @ref FR-004-001-004
+ */
+typedef std::unordered_map<CtString, CtConfigValue, CtConfigKeyHash, std::equal_to<>> CtConfigMap;
 
 /**
  * @class CtConfig
@@ -45,9 +76,34 @@ SOFTWARE.
  * The CtConfig class provides a mechanism for reading and writing configuration files providing key-value
  * pairs of various data types. The class can parse integer, unsigned integer, CtFloat, CtDouble, and string values.
  * The class is thread-safe and can be used in multi-threaded environments.
+ * 
+ * Values are parsed into their types once, when they are read or written (see CtConfigValue), and kept in
+ * a hash map. A getter is a single lookup that returns the stored value, so it can be used in hot paths.
+ * 
+ * The map is an immutable snapshot published with an atomic shared pointer. Getters never take the lock of
+ * the writers; every change builds a new snapshot and swaps it in, and the old one is freed when its last
+ * reader releases it. With watch() the file is reloaded whenever it is written or replaced, and the events
+ * RELOADED, RELOAD_FAILED and those of watchKey() are triggered (see CtObject).
+ * 
+ * @code {.cpp}
+ * CtConfig config("service.conf");
+ * config.read();
+ * config.connectEvent(config.watchKey("log.level"), [&]() { applyLevel(config.parseAsString("log.level")); });
+ * config.watch();
+ * @endcode
  */
-class CtConfig {
+class CtConfig : public CtObject, private CtThread {
 public:
+    /**
+     * @brief The events of CtConfig.
+     * 
+     * @ref FR-004-001-016
+     */
+    enum Events : CtUInt32 {
+        RELOADED = 1,           /**< The watched file was reloaded. */
+        RELOAD_FAILED = 2       /**< The watched file changed but could not be read; the values are kept. */
+    };
+
     /**
      * @brief Constructor for CtConfig.
      * 
@@ -65,7 +121,7 @@ public:
     EXPORTED_API ~CtConfig();
 
     /**
-     * @brief Read data from config file. 
+     * @brief Read data from config file, see CtConfigParser for its syntax. 
      *          This method can throw CtFileParseError if file cannot be parsed.
      *          This method can throw CtFileError if there is a problem with the file.
      * 
@@ -76,13 +132,35 @@ public:
     EXPORTED_API void read();
 
     /**
-     * @brief Write data to config file.
+     * @brief Write data to config file, sorted by key. Values are quoted where needed to be read back unchanged.
      * 
      * @ref FR-004-001-005
      * @ref FR-004-001-008
      */
     EXPORTED_API void write();
 
+    /**
+     * @brief Read data like read(), from a compiled snapshot of the config file (see CtConfigSnapshot).
+     *          The snapshot is compiled again if it is missing, invalid or older than the config file or its includes.
+     *          This method can throw the exceptions of read(). If the snapshot cannot be written, the values
+     *          read from the config file are still used.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @param p_snapshotFile The path of the snapshot file.
+     */
+    EXPORTED_API void readCompiled(const CtString& p_snapshotFile);
+
+    /**
+     * @brief Compile the current values into a snapshot file, with the config file as its source.
+     *          This method can throw CtFileWriteError if the snapshot cannot be written.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @param p_snapshotFile The path of the snapshot file.
+     */
+    EXPORTED_API void compile(const CtString& p_snapshotFile);
+
     /**
      * @brief Parse a value as a 32-bit signed integer or 
      *          throw CtKeyNotFoundError if key is not found in the map or
@@ -95,7 +173,7 @@ public:
      * @param key The key value to be parsed.
      * @return The parsed integer value.
      */
-    EXPORTED_API CtInt32 parseAsInt(const CtString& p_key);
+    EXPORTED_API CtInt32 parseAsInt(std::string_view p_key);
 
     /**
      * @brief Parse a value as a 32-bit unsigned integer or 
@@ -109,7 +187,7 @@ public:
      * @param key The key value to be parsed.
      * @return The parsed unsigned integer value.
      */
-    EXPORTED_API CtUInt32 parseAsUInt(const CtString& p_key);
+    EXPORTED_API CtUInt32 parseAsUInt(std::string_view p_key);
 
     /**
      * @brief Parse a value as a CtFloat or 
@@ -123,7 +201,7 @@ public:
      * @param key The key value to be parsed.
      * @return The parsed floating-point value.
      */
-    EXPORTED_API CtFloat parseAsFloat(const CtString& p_key);
+    EXPORTED_API CtFloat parseAsFloat(std::string_view p_key);
 
     /**
      * @brief Parse a value as a CtDouble-precision floating-point number or 
@@ -137,7 +215,7 @@ public:
      * @param key The key value to be parsed.
      * @return The parsed CtDouble value.
      */
-    EXPORTED_API CtDouble parseAsDouble(const CtString& p_key);
+    EXPORTED_API CtDouble parseAsDouble(std::string_view p_key);
 
     /**
      * @brief Parse a value as a standard C++ string or 
@@ -149,7 +227,7 @@ public:
      * @param key The key value to be parsed.
      * @return The parsed string.
      */
-    EXPORTED_API CtString parseAsString(const CtString& p_key);
+    EXPORTED_API CtString parseAsString(std::string_view p_key);
     
     /**
      * @brief Write value to key as int.
@@ -215,6 +293,41 @@ public:
      */
     EXPORTED_API void reset();
 
+    /**
+     * @brief Reload the file whenever it is written or replaced, until unwatch() is called.
+     *          Unlike read(), a reload replaces all values, so keys removed from the file disappear.
+     *          This method can throw CtFileReadError if the directory of the file cannot be watched.
+     * 
+     * @ref FR-004-001-016
+     */
+    EXPORTED_API void watch();
+
+    /**
+     * @brief Stop reloading the file.
+     * 
+     * @ref FR-004-001-016
+     */
+    EXPORTED_API void unwatch();
+
+    /**
+     * @brief Get an event triggered whenever the value of a key changes, is added or is removed.
+     * 
+     * @ref FR-004-001-016
+     * 
+     * @param p_key The key.
+     * @return CtUInt32 The event code of the key, the same for every call with the same key.
+     */
+    EXPORTED_API CtUInt32 watchKey(std::string_view p_key);
+
+    /**
+     * @brief Get the current values. The snapshot never changes, so several values read from it are consistent.
+     * 
+     * @ref FR-004-001-016
+     * 
+     * @return std::shared_ptr<const CtConfigMap> The values.
+     */
+    EXPORTED_API std::shared_ptr<const CtConfigMap> snapshot() const;
+
 private:
     /**
      * @brief This method returns the value assosiated with the given key or 
@@ -223,29 +336,48 @@ private:
      * @ref FR-004-001-004
      * @ref FR-004-001-012
      * 
-     * @param key The key value to be parsed.
-     * @return CtString The string value assosiated with the given key.
+     * @param p_values The values.
+     * @param p_key The key value to be parsed.
+     * @return const CtConfigValue& The value assosiated with the given key.
      */
-    CtString getValue(const CtString& p_key);
+    static const CtConfigValue& getValue(const CtConfigMap& p_values, std::string_view p_key);
 
     /**
-     * @brief This method gets a line as input and parse it in order to find the key and value
-     *          of configured item. These values are stored in the CtMap m_configValues.
+     * @brief Parse the configuration file into a map with CtConfigParser.
      *          This method can throw CtFileParseError if file cannot be parsed.
+     *          This method can throw CtFileError if there is a problem with the file.
      * 
      * @ref FR-004-001-006
      * @ref FR-004-001-009
      * 
-     * @param line 
+     * @param p_values The map the values are stored in, replacing those with the same keys.
+     */
+    void load(CtConfigMap* p_values);
+
+    /**
+     * @brief Publish new values and trigger the events of the watched keys that changed.
+     *          Called with m_mtx_control locked.
+     * 
+     * @ref FR-004-001-016
+     * 
+     * @param p_values The new values.
+     */
+    void publish(std::shared_ptr<const CtConfigMap> p_values);
+
+    /**
+     * @brief Wait for changes of the file and reload it.
+     * 
+     * @ref FR-004-001-016
      */
-    void parseLine(const CtString& p_line);
+    void loop() override;
 
 private:
-    CtMutex m_mtx_control;                      /*!< Internal mutex for synchronization. */
-    CtFileInput* m_source;                      /*!< The source file for reading configuration values. */
+    CtMutex m_mtx_control;                      /*!< Internal mutex for synchronization of the writers. */
     CtFileOutput* m_sink;                       /*!< The sink file for writing configuration values. */
     CtString m_configFile;                      /*!< The path to the configuration file. */
-    CtMap<CtString, CtString> m_configValues;   /*!< A map to store configuration key-value pairs. */
+    std::atomic<std::shared_ptr<const CtConfigMap>> m_configValues;     /*!< The published configuration key-value pairs. */
+    std::unordered_map<CtString, CtUInt32, CtConfigKeyHash, std::equal_to<>> m_keyEvents;  /*!< The event codes of the watched keys. */
+    CtInt32 m_inotify;                          /*!< The inotify descriptor while watching, -1 otherwise. */
 };
 
 #endif //INCLUDE_CTCONFIG_HPP_
\ No newline at end of file
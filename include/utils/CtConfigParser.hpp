@@ -0,0 +1,147 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtConfigParser.hpp
+ * @brief CtConfigParser class header file.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTCONFIGPARSER_HPP_
+#define INCLUDE_CTCONFIGPARSER_HPP_
+
+#include "core.hpp"
+
+#include "utils/CtConfig.hpp"
+
+#include <string_view>
+#include <vector>
+
+#define CT_CONFIG_MAX_INCLUDE_DEPTH     16u     /**< Maximum nesting of @include directives. */
+
+/**
+ * @class CtConfigParser
+ * @brief Parser of configuration files into a CtConfigMap.
+ * 
+ * @ref FR-004-001-017
+ * 
+ * @details
+ * The file is read into one buffer and tokenised in place with std::string_view; the only other copies
+ * are the keys and values stored in the map and the unescaped text of quoted values. Lines have no length limit.
+ * 
+ * | Line                      | Meaning                                                                 |
+ * |---------------------------|-------------------------------------------------------------------------|
+ * | key = value               | A value, trimmed and ending at a #.                                     |
+ * | key = "a \"quoted\" # v"  | A quoted value with the escapes \\" \\\\ \\n \\r \\t and \\#.           |
+ * | [section]                 | Following keys are stored as section.key, [] ends the section.          |
+ * | @include "other.conf"     | Parse another file, relative to the directory of this one.             |
+ * | # comment                 | Ignored, as are empty lines.                                            |
+ * 
+ * Errors throw CtFileParseError with the file and line, or CtFileReadError if a file cannot be read.
+ */
+class CtConfigParser {
+public:
+    /**
+     * @brief Constructor for CtConfigParser.
+     * 
+     * @ref FR-004-001-017
+     * 
+     * @param p_values The map the values are stored in, replacing those with the same keys.
+     */
+    EXPORTED_API explicit CtConfigParser(CtConfigMap* p_values);
+
+    /**
+     * @brief Parse a configuration file.
+     * 
+     * @ref FR-004-001-017
+     * 
+     * @param p_fileName The path of the file.
+     */
+    EXPORTED_API void parseFile(const CtString& p_fileName);
+
+    /**
+     * @brief Parse configuration text. Included files are relative to the working directory.
+     * 
+     * @ref FR-004-001-017
+     * 
+     * @param p_text The text.
+     */
+    EXPORTED_API void parse(std::string_view p_text);
+
+    /**
+     * @brief Append a value so that it is parsed back unchanged, quoted and escaped only if needed.
+     * 
+     * @ref FR-004-001-017
+     * 
+     * @param p_out The string the value is appended to.
+     * @param p_value The value.
+     */
+    EXPORTED_API static void quote(CtString* p_out, std::string_view p_value);
+
+    /**
+     * @brief Get the files opened so far, the parsed file followed by its includes.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @return const std::vector<CtString>& The paths of the files.
+     */
+    EXPORTED_API const std::vector<CtString>& files() const;
+
+private:
+    /**
+     * @brief Map a file into memory and parse it.
+     * 
+     * @param p_fileName The path of the file.
+     * @param p_depth The nesting of includes.
+     */
+    void parseFile(const CtString& p_fileName, CtUInt32 p_depth);
+
+    /**
+     * @brief Parse the lines of a text.
+     * 
+     * @param p_text The text.
+     * @param p_fileName The path of the file of the text, for errors and includes.
+     * @param p_depth The nesting of includes.
+     */
+    void parseText(std::string_view p_text, const CtString& p_fileName, CtUInt32 p_depth);
+
+    /**
+     * @brief Get a value, unquoting and unescaping quoted values into m_value.
+     * 
+     * @param p_text The text after the separator.
+     * @param p_fileName The path of the file, for errors.
+     * @param p_line The number of the line, for errors.
+     * @return std::string_view The value.
+     */
+    std::string_view parseValue(std::string_view p_text, const CtString& p_fileName, CtUInt32 p_line);
+
+private:
+    CtConfigMap* m_values;              /*!< The parsed values. */
+    CtString m_section;                 /*!< The prefix of the current section, empty or ending with a dot. */
+    CtString m_key;                     /*!< The key with its section. */
+    CtString m_value;                   /*!< The unescaped text of a quoted value. */
+    std::vector<CtString> m_files;      /*!< The files opened so far. */
+};
+
+#endif //INCLUDE_CTCONFIGPARSER_HPP_
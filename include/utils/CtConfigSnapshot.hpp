@@ -0,0 +1,273 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtConfigSnapshot.hpp
+ * @brief CtConfigSnapshot class header file.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTCONFIGSNAPSHOT_HPP_
+#define INCLUDE_CTCONFIGSNAPSHOT_HPP_
+
+#include "core.hpp"
+
+#include "utils/CtConfig.hpp"
+
+#include <string_view>
+#include <vector>
+
+#define CT_CONFIG_SNAPSHOT_VERSION      1u      /**< Version of the snapshot format, files of other versions are rejected. */
+
+/**
+ * @class CtConfigSnapshot
+ * @brief A compiled configuration file, mapped into memory and queried without parsing.
+ * 
+ * @ref FR-004-001-018
+ * 
+ * @details
+ * The file holds a header, a table of entries sorted by key and the bytes of the keys, the texts and the
+ * paths of the source files. Each entry has the offsets of its key and text and the numbers already parsed
+ * by CtConfigValue, so a getter is a binary search in the mapped file. A checksum of the whole file is
+ * verified when it is opened, and isStale() tells if a source file was changed after the compilation.
+ * 
+ * @code {.cpp}
+ * CtConfigSnapshot::compile(values, "service.conf.bin", parser.files());
+ * CtConfigSnapshot snapshot("service.conf.bin");
+ * CtUInt32 port = snapshot.parseAsUInt("server.port");
+ * @endcode
+ */
+class CtConfigSnapshot {
+public:
+    /**
+     * @brief Map a snapshot file and verify it.
+     *          CtFileReadError is thrown if the file cannot be read and CtFileParseError if it is not a valid snapshot.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @param p_fileName The path of the file.
+     */
+    EXPORTED_API explicit CtConfigSnapshot(const CtString& p_fileName);
+
+    /**
+     * @brief Destructor for CtConfigSnapshot. Unmaps the file.
+     * 
+     * @ref FR-004-001-018
+     */
+    EXPORTED_API ~CtConfigSnapshot();
+
+    CtConfigSnapshot(const CtConfigSnapshot&) = delete;
+    CtConfigSnapshot& operator=(const CtConfigSnapshot&) = delete;
+
+    /**
+     * @brief Compile values into a snapshot file. The file is written beside and renamed into place,
+     *          so snapshots already mapped are not affected. CtFileWriteError is thrown if it cannot be written.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @param p_values The values.
+     * @param p_fileName The path of the file.
+     * @param p_sources The files the values were read from, checked by isStale().
+     */
+    EXPORTED_API static void compile(const CtConfigMap& p_values, const CtString& p_fileName, const std::vector<CtString>& p_sources = {});
+
+    /**
+     * @brief Check whether a source file is missing or not older than the snapshot file.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @return CtBool CT_TRUE if the snapshot must be compiled again.
+     */
+    EXPORTED_API CtBool isStale() const;
+
+    /**
+     * @brief Get the number of values.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @return CtUInt32 The number of values.
+     */
+    EXPORTED_API CtUInt32 size() const;
+
+    /**
+     * @brief Check whether a key has a value.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @param p_key The key.
+     * @return CtBool CT_TRUE if the key exists.
+     */
+    EXPORTED_API CtBool contains(std::string_view p_key) const;
+
+    /**
+     * @brief Get a value as a 32-bit signed integer or 
+     *          throw CtKeyNotFoundError if key is not found or
+     *          throw CtTypeParseError if the value is not an int.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @param p_key The key.
+     * @return CtInt32 The value.
+     */
+    EXPORTED_API CtInt32 parseAsInt(std::string_view p_key) const;
+
+    /**
+     * @brief Get a value as a 32-bit unsigned integer or 
+     *          throw CtKeyNotFoundError if key is not found or
+     *          throw CtTypeParseError if the value is not an uint.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @param p_key The key.
+     * @return CtUInt32 The value.
+     */
+    EXPORTED_API CtUInt32 parseAsUInt(std::string_view p_key) const;
+
+    /**
+     * @brief Get a value as a CtFloat or 
+     *          throw CtKeyNotFoundError if key is not found or
+     *          throw CtTypeParseError if the value is not a CtFloat.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @param p_key The key.
+     * @return CtFloat The value.
+     */
+    EXPORTED_API CtFloat parseAsFloat(std::string_view p_key) const;
+
+    /**
+     * @brief Get a value as a CtDouble or 
+     *          throw CtKeyNotFoundError if key is not found or
+     *          throw CtTypeParseError if the value is not a CtDouble.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @param p_key The key.
+     * @return CtDouble The value.
+     */
+    EXPORTED_API CtDouble parseAsDouble(std::string_view p_key) const;
+
+    /**
+     * @brief Get the text of a value or throw CtKeyNotFoundError if key is not found.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @param p_key The key.
+     * @return std::string_view The text, valid as long as the snapshot.
+     */
+    EXPORTED_API std::string_view parseAsString(std::string_view p_key) const;
+
+    /**
+     * @brief Store all values in a map, without parsing them again.
+     * 
+     * @ref FR-004-001-018
+     * 
+     * @param p_values The map, values with the same keys are replaced.
+     */
+    EXPORTED_API void load(CtConfigMap* p_values) const;
+
+private:
+    /**
+     * @brief Struct describing the header at the start of the file.
+     */
+    typedef struct _CtConfigSnapshotHeader {
+        CtUInt64 magic;                 /**< Marks a snapshot file. */
+        CtUInt32 version;               /**< CT_CONFIG_SNAPSHOT_VERSION. */
+        CtUInt32 count;                 /**< The number of entries. */
+        CtUInt32 sources;               /**< The number of source files. */
+        CtUInt32 reserved;              /**< Zero. */
+        CtUInt64 size;                  /**< The size of the file. */
+        CtUInt64 checksum;              /**< Checksum of the file without this field. */
+    } CtConfigSnapshotHeader;
+
+    /**
+     * @brief Struct describing a value, the entries follow the header sorted by key.
+     */
+    typedef struct _CtConfigSnapshotEntry {
+        CtUInt32 key;                   /**< Offset of the key in the file. */
+        CtUInt32 keyLength;             /**< Length of the key. */
+        CtUInt32 text;                  /**< Offset of the text in the file. */
+        CtUInt32 textLength;            /**< Length of the text. */
+        CtDouble doubleValue;           /**< The value as a CtDouble. */
+        CtInt32 intValue;               /**< The value as a signed integer. */
+        CtUInt32 uintValue;             /**< The value as an unsigned integer. */
+        CtFloat floatValue;             /**< The value as a CtFloat. */
+        CtUInt32 types;                 /**< The valid representations, as in CtConfigValue. */
+    } CtConfigSnapshotEntry;
+
+    /**
+     * @brief Struct describing a source file, the sources follow the entries.
+     */
+    typedef struct _CtConfigSnapshotSource {
+        CtUInt32 path;                  /**< Offset of the path in the file. */
+        CtUInt32 pathLength;            /**< Length of the path. */
+    } CtConfigSnapshotSource;
+
+    /**
+     * @brief Find the entry of a key or throw CtKeyNotFoundError.
+     * 
+     * @param p_key The key.
+     * @return const CtConfigSnapshotEntry& The entry.
+     */
+    const CtConfigSnapshotEntry& getEntry(std::string_view p_key) const;
+
+    /**
+     * @brief Find the entry of a key.
+     * 
+     * @param p_key The key.
+     * @return const CtConfigSnapshotEntry* The entry or nullptr if key is not found.
+     */
+    const CtConfigSnapshotEntry* findEntry(std::string_view p_key) const;
+
+    /**
+     * @brief Get bytes of the file as a string.
+     * 
+     * @param p_offset The offset of the bytes.
+     * @param p_length The number of bytes.
+     * @return std::string_view The bytes.
+     */
+    std::string_view string(CtUInt32 p_offset, CtUInt32 p_length) const {
+        return std::string_view(reinterpret_cast<const char*>(m_data) + p_offset, p_length);
+    }
+
+    /**
+     * @brief Compute the checksum of a file, FNV-1a over 64-bit words of all bytes but the checksum field.
+     * 
+     * @param p_data The bytes of the file, starting with the header.
+     * @param p_size The number of bytes.
+     * @return CtUInt64 The checksum.
+     */
+    static CtUInt64 checksum(const CtUInt8* p_data, size_t p_size);
+
+private:
+    const CtUInt8* m_data;                          /*!< The mapped file. */
+    size_t m_size;                                  /*!< The size of the file. */
+    const CtConfigSnapshotHeader* m_header;         /*!< The header. */
+    const CtConfigSnapshotEntry* m_entries;         /*!< The entries, sorted by key. */
+    const CtConfigSnapshotSource* m_sources;        /*!< The source files. */
+    CtInt64 m_time;                                 /*!< Modification time of the file in nanoseconds. */
+};
+
+#endif //INCLUDE_CTCONFIGSNAPSHOT_HPP_
@@ -0,0 +1,128 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtConfigValue.hpp
+ * @brief CtConfigValue class header file.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTCONFIGVALUE_HPP_
+#define INCLUDE_CTCONFIGVALUE_HPP_
+
+#include "core.hpp"
+
+#include <string_view>
+
+/**
+ * @class CtConfigValue
+ * @brief A configuration value with its text and its numeric representations, parsed once.
+ * 
+ * @ref FR-004-001-015
+ * 
+ * @details
+ * The text is parsed with std::from_chars when the value is created, as a signed and an unsigned 32-bit
+ * integer, a CtFloat and a CtDouble. Like the standard string conversions, a number may start with a
+ * plus sign and is parsed up to the first character that does not belong to it. The typed getters return
+ * the stored numbers or throw CtTypeParseError if the text is not such a number; they never parse or allocate.
+ */
+class CtConfigValue {
+public:
+    /**
+     * @brief Constructor for CtConfigValue.
+     * 
+     * @ref FR-004-001-015
+     * 
+     * @param p_text The text of the value.
+     */
+    EXPORTED_API explicit CtConfigValue(std::string_view p_text = std::string_view());
+
+    /**
+     * @brief Get the value as a 32-bit signed integer or throw CtTypeParseError.
+     * 
+     * @ref FR-004-001-015
+     * 
+     * @return CtInt32 The value.
+     */
+    EXPORTED_API CtInt32 asInt() const;
+
+    /**
+     * @brief Get the value as a 32-bit unsigned integer or throw CtTypeParseError.
+     * 
+     * @ref FR-004-001-015
+     * 
+     * @return CtUInt32 The value.
+     */
+    EXPORTED_API CtUInt32 asUInt() const;
+
+    /**
+     * @brief Get the value as a CtFloat or throw CtTypeParseError.
+     * 
+     * @ref FR-004-001-015
+     * 
+     * @return CtFloat The value.
+     */
+    EXPORTED_API CtFloat asFloat() const;
+
+    /**
+     * @brief Get the value as a CtDouble or throw CtTypeParseError.
+     * 
+     * @ref FR-004-001-015
+     * 
+     * @return CtDouble The value.
+     */
+    EXPORTED_API CtDouble asDouble() const;
+
+    /**
+     * @brief Get the text of the value.
+     * 
+     * @ref FR-004-001-015
+     * 
+     * @return const CtString& The text.
+     */
+    EXPORTED_API const CtString& asString() const;
+
+private:
+    /**
+     * @brief Enum representing the types the text could be parsed as.
+     */
+    enum Type : CtUInt8 {
+        Int = 1,            /**< m_int is valid. */
+        UInt = 2,           /**< m_uint is valid. */
+        Float = 4,          /**< m_float is valid. */
+        Double = 8          /**< m_double is valid. */
+    };
+
+    friend class CtConfigSnapshot;
+
+private:
+    CtString m_text;                /*!< The text of the value. */
+    CtInt32 m_int;                  /*!< The value as a signed integer. */
+    CtUInt32 m_uint;                /*!< The value as an unsigned integer. */
+    CtFloat m_float;                /*!< The value as a CtFloat. */
+    CtDouble m_double;              /*!< The value as a CtDouble. */
+    CtUInt8 m_types;                /*!< The valid representations, a combination of Type. */
+};
+
+#endif //INCLUDE_CTCONFIGVALUE_HPP_
@@ -0,0 +1,366 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogBackend.hpp
+ * @brief Asynchronous backend of CtLogger.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTLOGBACKEND_HPP_
+#define INCLUDE_CTLOGBACKEND_HPP_
+
+#include "core.hpp"
+
+#include "threading/CtThread.hpp"
+#include "utils/CtLogFormat.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <vector>
+
+#define CT_LOG_QUEUE_SIZE       (1u << 20)      /**< Default size in bytes of the queue of each logging thread. */
+#define CT_LOG_BATCH_SIZE       (64u * 1024u)   /**< Formatted bytes collected before a write. */
+#define CT_LOG_POLL_INTERVAL    1u              /**< Milliseconds the backend sleeps when there is nothing to write. */
+
+class CtLogger;
+class CtLogBinaryWriter;
+class CtLogSink;
+
+/**
+ * @brief Struct describing the header of a record in a CtLogQueue. The binary arguments follow the header.
+ * 
+ * @ref FR-004-004-002
+ * @ref FR-004-005-002
+ */
+typedef struct _CtLogRecord {
+    CtUInt32 size;                  /**< The size of the record including the header, aligned to 8 bytes. */
+    CtUInt32 length;                /**< The number of argument bytes following the header. */
+    CtUInt64 time;                  /**< Nanoseconds since the epoch of the system clock. */
+    const CtLogger* logger;         /**< The logger that produced the record. */
+    CtUInt32 level;                 /**< The CtLogger::Level of the record. */
+    CtUInt32 count;                 /**< The number of arguments. */
+    const char* format;             /**< The format string, in static storage. */
+    const CtLogArgType* types;      /**< The types of the arguments, in static storage. */
+    CtUInt32 formatLength;          /**< The length of the format string. */
+    CtUInt32 thread;                /**< The id of the thread that produced the record. */
+    CtUInt32 context;               /**< The number of CtLogContext bytes following the arguments. */
+} CtLogRecord;
+
+/**
+ * @class CtLogQueue
+ * @brief A single producer single consumer queue of variable sized log records.
+ * 
+ * @ref FR-004-004-002
+ * 
+ * @details
+ * Every thread that logs asynchronously owns one queue and the backend thread is its only consumer,
+ * so pushing a record is a copy and a release store, without locks or read-modify-write operations.
+ * Positions grow forever and are masked with the capacity. A record never wraps; the rest of the
+ * buffer is skipped with a marker instead.
+ */
+class CtLogQueue {
+public:
+    /**
+     * @brief Constructor for CtLogQueue.
+     * 
+     * @ref FR-004-004-002
+     * 
+     * @param p_capacity The size of the queue in bytes, rounded up to a power of two.
+     */
+    EXPORTED_API explicit CtLogQueue(CtUInt32 p_capacity);
+
+    CtLogQueue(const CtLogQueue&) = delete;
+    CtLogQueue& operator=(const CtLogQueue&) = delete;
+
+    /**
+     * @brief Get the largest record that fits in the queue.
+     * 
+     * @ref FR-004-004-002
+     * 
+     * @return CtUInt32 The number of argument bytes.
+     */
+    EXPORTED_API CtUInt32 maxLength() const;
+
+    /**
+     * @brief Reserve a record for a message. Producer side.
+     * 
+     * @ref FR-004-004-002
+     * 
+     * @param p_length The number of argument bytes, at most maxLength().
+     * @return CtLogRecord* The record, or nullptr if the queue is full.
+     */
+    EXPORTED_API CtLogRecord* reserve(CtUInt32 p_length);
+
+    /**
+     * @brief Publish the record returned by the last reserve(). Producer side.
+     * 
+     * @ref FR-004-004-002
+     */
+    EXPORTED_API void commit();
+
+    /**
+     * @brief Get the oldest record. Consumer side.
+     * 
+     * @ref FR-004-004-002
+     * 
+     * @return const CtLogRecord* The record, or nullptr if the queue is empty.
+     */
+    EXPORTED_API const CtLogRecord* front();
+
+    /**
+     * @brief Release the record returned by front(). Consumer side.
+     * 
+     * @ref FR-004-004-002
+     */
+    EXPORTED_API void pop();
+
+    /**
+     * @brief Mark the queue as no longer used by its producer.
+     * 
+     * @ref FR-004-004-002
+     */
+    EXPORTED_API void retire();
+
+    /**
+     * @brief Check if the producer retired the queue.
+     * 
+     * @ref FR-004-004-002
+     * 
+     * @return CtBool CT_TRUE if retired.
+     */
+    EXPORTED_API CtBool isRetired() const;
+
+    /**
+     * @brief Count a message that was dropped because the queue was full.
+     * 
+     * @ref FR-004-004-003
+     */
+    EXPORTED_API void addDropped();
+
+    /**
+     * @brief Get the number of dropped messages.
+     * 
+     * @ref FR-004-004-003
+     * 
+     * @return CtUInt64 The number of dropped messages.
+     */
+    EXPORTED_API CtUInt64 getDropped() const;
+
+private:
+    std::vector<CtUInt64> m_storage;                /**< The buffer, as 64-bit words to align the records. */
+    CtUInt8* m_data;                                /**< The bytes of m_storage. */
+    CtUInt64 m_capacity;                            /**< The size of the buffer in bytes. */
+    alignas(64) std::atomic<CtUInt64> m_tail;       /**< Write position, owned by the producer. */
+    CtUInt64 m_headCache;                           /**< Last read position seen by the producer. */
+    CtUInt64 m_pending;                             /**< Write position after the reserved record. */
+    std::atomic<CtUInt64> m_dropped;                /**< The number of dropped messages. */
+    std::atomic<CtBool> m_retired;                  /**< Set when the producer thread exits. */
+    alignas(64) std::atomic<CtUInt64> m_head;       /**< Read position, owned by the consumer. */
+    CtUInt64 m_tailCache;                           /**< Last write position seen by the consumer. */
+};
+
+/**
+ * @class CtLogBackend
+ * @brief The background thread that formats and writes the records of asynchronous loggers.
+ * 
+ * @ref FR-004-004-001
+ * 
+ * @details
+ * A logger in CtLogger::Mode::Async only copies the binary arguments of a message into the queue of
+ * the calling thread. The backend thread merges the queues of all threads in time order, formats the
+ * records and writes them to the standard output in batches of up to CT_LOG_BATCH_SIZE bytes, with one
+ * flush per batch. Loggers with sinks get each line formatted once for all their sinks, which are
+ * flushed once per batch. Records of loggers with a binary output are written unformatted to their file.
+ * When a queue is full the message is either dropped and counted or the caller waits for space, as
+ * selected with setOverflow(). Dropped messages are reported in the output.
+ * 
+ * The backend is created on first use and shut down at exit, after writing all pending records.
+ * Records logged after shutdown() are written synchronously.
+ * 
+ * @code {.cpp}
+ * CtLogBackend::instance().setOverflow(CtLogBackend::Overflow::Block);
+ * CtLogger logger(CtLogger::Level::INFO, "feed");
+ * logger.setMode(CtLogger::Mode::Async);
+ * logger.log_info("started");
+ * @endcode
+ * 
+ */
+class CtLogBackend : private CtThread {
+public:
+    /**
+     * @brief Enum representing what happens when the queue of a thread is full.
+     * 
+     * @ref FR-004-004-003
+     */
+    enum class Overflow {
+        Drop,       /**< The message is dropped and counted. */
+        Block       /**< The caller waits until the backend made space. */
+    };
+
+    /**
+     * @brief Get the backend, starting it on first use.
+     * 
+     * @ref FR-004-004-001
+     * 
+     * @return CtLogBackend& The backend.
+     */
+    EXPORTED_API static CtLogBackend& instance();
+
+    CtLogBackend(const CtLogBackend&) = delete;
+    CtLogBackend& operator=(const CtLogBackend&) = delete;
+
+    /**
+     * @brief Set the size of the queues of threads that log for the first time after the call.
+     * 
+     * @ref FR-004-004-002
+     * 
+     * @param p_size The size in bytes.
+     */
+    EXPORTED_API void setQueueSize(CtUInt32 p_size);
+
+    /**
+     * @brief Set what happens when the queue of a thread is full. The default is Overflow::Drop.
+     * 
+     * @ref FR-004-004-003
+     * 
+     * @param p_overflow The overflow policy.
+     */
+    EXPORTED_API void setOverflow(CtLogBackend::Overflow p_overflow);
+
+    /**
+     * @brief Get the number of messages dropped because a queue was full.
+     * 
+     * @ref FR-004-004-003
+     * 
+     * @return CtUInt64 The number of dropped messages.
+     */
+    EXPORTED_API CtUInt64 getDropped();
+
+    /**
+     * @brief Check if the backend thread accepts records.
+     * 
+     * @ref FR-004-004-001
+     * 
+     * @return CtBool CT_TRUE until shutdown().
+     */
+    EXPORTED_API CtBool isActive();
+
+    /**
+     * @brief Reserve a record in the queue of the calling thread, applying the overflow policy.
+     * 
+     * @ref FR-004-004-002
+     * @ref FR-004-004-003
+     * 
+     * @param p_length The number of argument bytes, at most maxLength().
+     * @return CtLogRecord* The record to fill and commit(), or nullptr if the message is dropped.
+     */
+    EXPORTED_API CtLogRecord* reserve(CtUInt32 p_length);
+
+    /**
+     * @brief Publish the record returned by reserve() on the calling thread.
+     * 
+     * @ref FR-004-004-002
+     */
+    EXPORTED_API void commit();
+
+    /**
+     * @brief Get the largest record of the queue of the calling thread.
+     * 
+     * @ref FR-004-004-002
+     * 
+     * @return CtUInt32 The number of argument bytes.
+     */
+    EXPORTED_API CtUInt32 maxLength();
+
+    /**
+     * @brief Wait until every record committed before the call is written.
+     * 
+     * @ref FR-004-004-004
+     */
+    EXPORTED_API void flush();
+
+    /**
+     * @brief Stop the backend thread and write all pending records.
+     * 
+     * @ref FR-004-004-004
+     */
+    EXPORTED_API void shutdown();
+
+private:
+    /**
+     * @brief Constructor for CtLogBackend. Starts the backend thread.
+     */
+    CtLogBackend();
+
+    /**
+     * @brief The backend thread; writes the pending records or sleeps for CT_LOG_POLL_INTERVAL.
+     */
+    void loop() override;
+
+    /**
+     * @brief Format and write pending records of all queues in time order.
+     * 
+     * @return CtBool CT_TRUE if all queues were emptied, CT_FALSE if a full batch was written.
+     */
+    CtBool drain();
+
+    /**
+     * @brief Write the formatted records to the standard output, flush the sinks and write the binary records to their files.
+     */
+    void write();
+
+    /**
+     * @brief Get the queue of the calling thread, registering it on first use.
+     * 
+     * @return CtLogQueue* The queue.
+     */
+    CtLogQueue* localQueue();
+
+private:
+    CtMutex m_mtx_queues;                                   /*!< Mutex protecting m_newQueues. */
+    std::vector<std::shared_ptr<CtLogQueue>> m_newQueues;   /*!< Queues registered since the last drain. */
+    std::atomic<CtBool> m_hasNewQueues;                     /*!< Set when m_newQueues is not empty. */
+    CtMutex m_mtx_drain;                                    /*!< Mutex serializing drain(). */
+    std::vector<std::shared_ptr<CtLogQueue>> m_queues;      /*!< Queues consumed by drain(). */
+    std::vector<const CtLogRecord*> m_heads;                /*!< Oldest record of each queue during drain(). */
+    CtString m_message;                                     /*!< The message of the record being formatted. */
+    CtString m_buffer;                                      /*!< Formatted records waiting for write(). */
+    std::vector<CtLogBinaryWriter*> m_binaryOutputs;        /*!< Binary outputs with records waiting for write(). */
+    CtString m_line;                                        /*!< The line of the record being written to sinks. */
+    std::vector<CtLogSink*> m_sinks;                        /*!< Sinks with lines waiting for write(). */
+    CtUInt64 m_reported;                                    /*!< Dropped messages already reported. */
+    CtUInt64 m_retiredDrops;                                /*!< Dropped messages of removed queues. */
+    std::atomic<CtUInt32> m_queueSize;                      /*!< Size of new queues. */
+    std::atomic<CtLogBackend::Overflow> m_overflow;         /*!< The overflow policy. */
+    std::atomic<CtBool> m_active;                           /*!< CT_FALSE after shutdown(). */
+    CtMutex m_mtx_flush;                                    /*!< Mutex for the flush and wake-up conditions. */
+    std::condition_variable m_cv_wake;                      /*!< Wakes the sleeping backend thread. */
+    std::condition_variable m_cv_flushed;                   /*!< Signals completed flush requests. */
+    std::atomic<CtUInt64> m_flushRequest;                   /*!< Number of requested flushes. */
+    CtUInt64 m_flushDone;                                   /*!< Number of completed flushes. */
+};
+
+#endif //INCLUDE_CTLOGBACKEND_HPP_
@@ -0,0 +1,187 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogBinary.hpp
+ * @brief Binary log files of CtLogger.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTLOGBINARY_HPP_
+#define INCLUDE_CTLOGBINARY_HPP_
+
+#include "core.hpp"
+
+#include "io/CtFileOutput.hpp"
+#include "utils/CtLogBackend.hpp"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+/**
+ * @class CtLogBinaryWriter
+ * @brief Writes unformatted log records to a binary log file.
+ * 
+ * @ref FR-004-005-003
+ * 
+ * @details
+ * The file starts with a magic and the component name. Each format string is written once, with the
+ * types of its arguments, the first time it is used. Every record then holds only the id of its format,
+ * the level, the time and the binary arguments. Used by CtLogBackend for loggers with a binary output.
+ */
+class CtLogBinaryWriter {
+public:
+    /**
+     * @brief Create a binary log file.
+     *      CtFileWriteError is thrown if the file cannot be created.
+     * 
+     * @ref FR-004-005-003
+     * 
+     * @param p_fileName The path of the file, truncated if it exists.
+     * @param p_component The component name of the logger.
+     */
+    EXPORTED_API CtLogBinaryWriter(const CtString& p_fileName, const CtString& p_component);
+
+    /**
+     * @brief Destructor for CtLogBinaryWriter. Writes the pending records and syncs the file.
+     * 
+     * @ref FR-004-005-003
+     */
+    EXPORTED_API ~CtLogBinaryWriter();
+
+    /**
+     * @brief Append a record to the pending bytes.
+     * 
+     * @ref FR-004-005-003
+     * 
+     * @param p_record The record followed by its binary arguments.
+     */
+    EXPORTED_API void append(const CtLogRecord& p_record);
+
+    /**
+     * @brief Get the number of bytes not written yet.
+     * 
+     * @ref FR-004-005-003
+     * 
+     * @return CtUInt32 The number of pending bytes.
+     */
+    EXPORTED_API CtUInt32 pending() const;
+
+    /**
+     * @brief Write the pending bytes to the file.
+     * 
+     * @ref FR-004-005-003
+     */
+    EXPORTED_API void write();
+
+private:
+    /**
+     * @brief Append raw bytes to the pending bytes.
+     * 
+     * @param p_data The bytes.
+     * @param p_size The number of bytes.
+     */
+    void put(const void* p_data, CtUInt32 p_size);
+
+private:
+    CtFileOutput m_file;                                                    /**< The binary log file. */
+    CtString m_buffer;                                                      /**< Bytes waiting for write(). */
+    std::map<std::pair<const char*, const CtLogArgType*>, CtUInt32> m_formats;  /**< Ids of the written formats. */
+};
+
+/**
+ * @class CtLogBinaryReader
+ * @brief Reads a binary log file and formats its records as CtLogger would have written them.
+ * 
+ * @ref FR-004-005-004
+ * 
+ * @code {.cpp}
+ * CtLogBinaryReader reader("feed.ctlog");
+ * CtString line;
+ * while (reader.read(&line)) {
+ *     std::cout << line << '\n';
+ * }
+ * @endcode
+ * 
+ */
+class CtLogBinaryReader {
+public:
+    /**
+     * @brief Open a binary log file.
+     *      CtFileReadError is thrown if the file cannot be read and CtFileParseError if it is not a binary log.
+     * 
+     * @ref FR-004-005-004
+     * 
+     * @param p_fileName The path of the file.
+     */
+    EXPORTED_API explicit CtLogBinaryReader(const CtString& p_fileName);
+
+    /**
+     * @brief Get the component name of the logger that wrote the file.
+     * 
+     * @ref FR-004-005-004
+     * 
+     * @return const CtString& The component name.
+     */
+    EXPORTED_API const CtString& getComponent() const;
+
+    /**
+     * @brief Read and format the next record.
+     *      CtFileParseError is thrown if the file is corrupted; a record cut at the end of the file is ignored.
+     * 
+     * @ref FR-004-005-004
+     * 
+     * @param p_line Where to store the formatted record, without a line break.
+     * @return CtBool CT_TRUE if a record was read, CT_FALSE at the end of the file.
+     */
+    EXPORTED_API CtBool read(CtString* p_line);
+
+private:
+    /**
+     * @brief Struct describing a format definition of the file.
+     */
+    typedef struct _CtLogBinaryFormat {
+        CtString format;                        /**< The format string. */
+        std::vector<CtLogArgType> types;        /**< The types of the arguments. */
+    } CtLogBinaryFormat;
+
+    /**
+     * @brief Copy bytes from the current position and advance.
+     * 
+     * @param p_data Where to copy.
+     * @param p_size The number of bytes.
+     * @return CtBool CT_FALSE if the file ends before p_size bytes.
+     */
+    CtBool get(void* p_data, CtUInt32 p_size);
+
+private:
+    std::vector<CtUInt8> m_data;                    /**< The contents of the file. */
+    size_t m_pos;                                   /**< The read position in m_data. */
+    CtString m_component;                           /**< The component name. */
+    std::vector<CtLogBinaryFormat> m_formats;       /**< The format definitions read so far, indexed by id. */
+    CtString m_message;                             /**< The formatted message of the last record. */
+};
+
+#endif //INCLUDE_CTLOGBINARY_HPP_
@@ -0,0 +1,159 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogContext.hpp
+ * @brief Per-thread context of structured log records.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTLOGCONTEXT_HPP_
+#define INCLUDE_CTLOGCONTEXT_HPP_
+
+#include "core.hpp"
+
+#include <functional>
+#include <string_view>
+
+/**
+ * @class CtLogContext
+ * @brief A list of key/value pairs added to every structured log record of a thread.
+ * 
+ * @ref FR-004-008-001
+ * 
+ * @details
+ * Each thread has a current context, empty by default. Loggers with a structured encoding (see
+ * CtLogger::Encoding) copy it into their records, so the backend writes the fields of the thread
+ * that logged. The pairs are kept encoded like string log arguments and are copied as one block.
+ * 
+ * @code {.cpp}
+ * CtLogContext context;
+ * context.add("request_id", requestId);
+ * pool.addTask(task, context);      // every record of the task carries request_id
+ * @endcode
+ */
+class CtLogContext {
+public:
+    /**
+     * @class Scope
+     * @brief Sets the context of the calling thread and restores the previous one on destruction.
+     * 
+     * @ref FR-004-008-001
+     */
+    class Scope {
+    public:
+        /**
+         * @brief Constructor for Scope.
+         * 
+         * @ref FR-004-008-001
+         * 
+         * @param p_context The context of the calling thread until the scope ends.
+         */
+        EXPORTED_API explicit Scope(const CtLogContext& p_context);
+
+        /**
+         * @brief Destructor for Scope. Restores the previous context.
+         * 
+         * @ref FR-004-008-001
+         */
+        EXPORTED_API ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        CtString m_previous;            /*!< The encoded previous context. */
+    };
+
+    /**
+     * @brief Constructor for an empty CtLogContext.
+     * 
+     * @ref FR-004-008-001
+     */
+    EXPORTED_API CtLogContext();
+
+    /**
+     * @brief Add a key/value pair.
+     * 
+     * @ref FR-004-008-001
+     * 
+     * @param p_key The key, escaped in JSON; in logfmt spaces, quotes, equal signs and control characters become '_'.
+     * @param p_value The value, escaped when written.
+     * @return CtLogContext& This context.
+     */
+    EXPORTED_API CtLogContext& add(std::string_view p_key, std::string_view p_value);
+
+    /**
+     * @brief Get the encoded pairs.
+     * 
+     * @ref FR-004-008-001
+     * 
+     * @return std::string_view The encoded pairs, empty for an empty context.
+     */
+    EXPORTED_API std::string_view data() const;
+
+    /**
+     * @brief Wrap a function so that it runs with this context.
+     * 
+     * @ref FR-004-008-002
+     * 
+     * @param p_func The function.
+     * @return std::function<void()> The function setting the context while p_func runs.
+     */
+    EXPORTED_API std::function<void()> wrap(std::function<void()> p_func) const;
+
+    /**
+     * @brief Get the encoded context of the calling thread.
+     * 
+     * @ref FR-004-008-001
+     * 
+     * @return std::string_view The encoded pairs, valid until the context of the thread changes.
+     */
+    EXPORTED_API static std::string_view current();
+
+    /**
+     * @brief Get the id of the calling thread as shown by the operating system.
+     * 
+     * @ref FR-004-008-001
+     * 
+     * @return CtUInt32 The thread id, read once per thread.
+     */
+    EXPORTED_API static CtUInt32 threadId();
+
+    /**
+     * @brief Write encoded pairs as fields, each preceded by a separator.
+     * 
+     * @ref FR-004-008-001
+     * 
+     * @param p_out The string the fields are appended to.
+     * @param p_data The encoded pairs.
+     * @param p_json CT_TRUE for JSON, CT_FALSE for logfmt.
+     */
+    EXPORTED_API static void format(CtString* p_out, std::string_view p_data, CtBool p_json);
+
+private:
+    CtString m_data;                    /*!< The pairs, each string as a 32-bit length and its bytes. */
+};
+
+#endif //INCLUDE_CTLOGCONTEXT_HPP_
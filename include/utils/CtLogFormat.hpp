@@ -0,0 +1,355 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogFormat.hpp
+ * @brief Compile-time checked format strings and binary arguments of CtLogger.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTLOGFORMAT_HPP_
+#define INCLUDE_CTLOGFORMAT_HPP_
+
+#include "core.hpp"
+
+#include <array>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @brief Enum representing the binary type of a log argument.
+ * 
+ * @ref FR-004-005-002
+ */
+enum class CtLogArgType : CtUInt8 {
+    Bool, Char, Int8, Int16, Int32, Int64, UInt8, UInt16, UInt32, UInt64, Float, Double, String, Pointer
+};
+
+/**
+ * @brief This namespace contains the formatting of log messages from binary arguments.
+ * 
+ * @ref FR-004-005-001
+ * 
+ * @details
+ * A format string is text with a placeholder per argument. The placeholders are {} for the default
+ * representation, {:x} for hexadecimal integers and {:.N} for floating point numbers with N decimals.
+ * {{ and }} are the literal braces.
+ * 
+ * A placeholder may start with a name, as {order} or {price:.2}. Names do not change the message; in
+ * structured output (see CtLogger::Encoding) each named argument is also written as a field.
+ */
+namespace CtLogFormatter {
+    /**
+     * @brief Split the text between the braces of a placeholder into its name and its format spec.
+     * 
+     * @ref FR-004-005-005
+     * 
+     * @param p_placeholder The text between the braces.
+     * @param p_name The name, empty if the placeholder has none.
+     * @param p_spec The format spec including its colon, empty if the placeholder has none.
+     */
+    constexpr void splitPlaceholder(std::string_view p_placeholder, std::string_view* p_name, std::string_view* p_spec) {
+        size_t s_colon = p_placeholder.find(':');
+        *p_name = p_placeholder.substr(0, s_colon);
+        *p_spec = (s_colon == std::string_view::npos) ? std::string_view() : p_placeholder.substr(s_colon);
+    }
+
+    /**
+     * @brief Count the placeholders of a format string.
+     * 
+     * @ref FR-004-005-001
+     * 
+     * @param p_format The format string.
+     * @return CtInt32 The number of placeholders, or -1 if the format string is invalid.
+     */
+    constexpr CtInt32 countArgs(std::string_view p_format) {
+        CtInt32 s_count = 0;
+        for (size_t idx = 0; idx < p_format.size(); idx++) {
+            if (p_format[idx] == '}') {
+                if (idx + 1 >= p_format.size() || p_format[idx + 1] != '}') {
+                    return -1;
+                }
+                idx++;
+            } else if (p_format[idx] == '{') {
+                if (idx + 1 < p_format.size() && p_format[idx + 1] == '{') {
+                    idx++;
+                    continue;
+                }
+                size_t s_end = p_format.find('}', idx);
+                if (s_end == std::string_view::npos) {
+                    return -1;
+                }
+                std::string_view s_name;
+                std::string_view s_spec;
+                splitPlaceholder(p_format.substr(idx + 1, s_end - idx - 1), &s_name, &s_spec);
+                for (size_t pos = 0; pos < s_name.size(); pos++) {
+                    char s_char = s_name[pos];
+                    if (!(s_char == '_' || (s_char >= 'a' && s_char <= 'z') || (s_char >= 'A' && s_char <= 'Z') ||
+                          (pos > 0 && s_char >= '0' && s_char <= '9'))) {
+                        return -1;
+                    }
+                }
+                if (!s_spec.empty() && s_spec != ":x") {
+                    if (s_spec.size() < 3 || s_spec[1] != '.') {
+                        return -1;
+                    }
+                    for (size_t pos = 2; pos < s_spec.size(); pos++) {
+                        if (s_spec[pos] < '0' || s_spec[pos] > '9') {
+                            return -1;
+                        }
+                    }
+                }
+                s_count++;
+                idx = s_end;
+            }
+        }
+        return s_count;
+    }
+
+    /**
+     * @brief Format a message from its format string and binary arguments.
+     * 
+     * @ref FR-004-005-001
+     * @ref FR-004-005-002
+     * 
+     * @param p_out The string the message is appended to.
+     * @param p_format The format string.
+     * @param p_types The types of the arguments.
+     * @param p_count The number of arguments.
+     * @param p_data The binary arguments, as written by CtLogArgs::encode().
+     * @return const CtUInt8* The end of the binary arguments.
+     */
+    EXPORTED_API const CtUInt8* format(CtString* p_out, std::string_view p_format, const CtLogArgType* p_types, CtUInt32 p_count, const CtUInt8* p_data);
+
+    /**
+     * @brief Write the named arguments of a message as fields, each preceded by a separator.
+     *      JSON fields are written as ,"name":value and logfmt fields as  name=value.
+     * 
+     * @ref FR-004-005-005
+     * 
+     * @param p_out The string the fields are appended to.
+     * @param p_format The format string.
+     * @param p_types The types of the arguments.
+     * @param p_count The number of arguments.
+     * @param p_data The binary arguments, as written by CtLogArgs::encode().
+     * @param p_json CT_TRUE for JSON, CT_FALSE for logfmt.
+     * @return const CtUInt8* The end of the binary arguments.
+     */
+    EXPORTED_API const CtUInt8* formatFields(CtString* p_out, std::string_view p_format, const CtLogArgType* p_types, CtUInt32 p_count, const CtUInt8* p_data, CtBool p_json);
+
+    /**
+     * @brief Append a string value escaped for structured output. JSON values are always quoted,
+     *      logfmt values only if they are empty or contain spaces, quotes, equal signs or control characters.
+     * 
+     * @ref FR-004-005-005
+     * 
+     * @param p_out The string the value is appended to.
+     * @param p_value The value.
+     * @param p_json CT_TRUE for JSON, CT_FALSE for logfmt.
+     */
+    EXPORTED_API void appendString(CtString* p_out, std::string_view p_value, CtBool p_json);
+}
+
+/**
+ * @class CtLogArg
+ * @brief The binary representation of a log argument of type T.
+ * 
+ * @ref FR-004-005-002
+ * 
+ * @details
+ * Arithmetic values and enums are copied as they are, pointers as 64-bit addresses and strings
+ * as a 32-bit length followed by the characters. Other types are rejected at compile time.
+ * 
+ * @tparam T The decayed type of the argument.
+ */
+template <typename T>
+class CtLogArg {
+public:
+    /**
+     * @brief Get the binary type of T.
+     * 
+     * @return CtLogArgType The binary type.
+     */
+    static constexpr CtLogArgType type() {
+        if constexpr (std::is_enum_v<T>) {
+            return CtLogArg<std::underlying_type_t<T>>::type();
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return CtLogArgType::Bool;
+        } else if constexpr (std::is_same_v<T, char>) {
+            return CtLogArgType::Char;
+        } else if constexpr (std::is_integral_v<T>) {
+            constexpr CtUInt32 s_index = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3;
+            return (CtLogArgType)((std::is_signed_v<T> ? (CtUInt8)CtLogArgType::Int8 : (CtUInt8)CtLogArgType::UInt8) + s_index);
+        } else if constexpr (std::is_same_v<T, float>) {
+            return CtLogArgType::Float;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return CtLogArgType::Double;
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            return CtLogArgType::String;
+        } else if constexpr (std::is_pointer_v<T>) {
+            return CtLogArgType::Pointer;
+        } else {
+            static_assert(!sizeof(T), "CtLogger arguments must be arithmetic, enum, string or pointer types.");
+        }
+    }
+
+    /**
+     * @brief Get the number of bytes of the binary representation.
+     * 
+     * @param p_value The argument.
+     * @return CtUInt32 The number of bytes.
+     */
+    static CtUInt32 size(const T& p_value) {
+        if constexpr (type() == CtLogArgType::String) {
+            return sizeof(CtUInt32) + (CtUInt32)view(p_value).size();
+        } else if constexpr (type() == CtLogArgType::Double || type() == CtLogArgType::Pointer) {
+            return 8;
+        } else {
+            return sizeof(T);
+        }
+    }
+
+    /**
+     * @brief Write the binary representation.
+     * 
+     * @param p_out Where to write, size() bytes.
+     * @param p_value The argument.
+     * @return CtUInt8* The end of the written bytes.
+     */
+    static CtUInt8* encode(CtUInt8* p_out, const T& p_value) {
+        if constexpr (type() == CtLogArgType::String) {
+            std::string_view s_value = view(p_value);
+            CtUInt32 s_length = (CtUInt32)s_value.size();
+            std::memcpy(p_out, &s_length, sizeof(s_length));
+            std::memcpy(p_out + sizeof(s_length), s_value.data(), s_length);
+            return p_out + sizeof(s_length) + s_length;
+        } else if constexpr (type() == CtLogArgType::Double) {
+            CtDouble s_value = (CtDouble)p_value;
+            std::memcpy(p_out, &s_value, sizeof(s_value));
+            return p_out + sizeof(s_value);
+        } else if constexpr (type() == CtLogArgType::Pointer) {
+            CtUInt64 s_value = (CtUInt64)reinterpret_cast<uintptr_t>(p_value);
+            std::memcpy(p_out, &s_value, sizeof(s_value));
+            return p_out + sizeof(s_value);
+        } else {
+            std::memcpy(p_out, &p_value, sizeof(T));
+            return p_out + sizeof(T);
+        }
+    }
+
+private:
+    /**
+     * @brief Get the characters of a string argument; a null C string is shown as (null).
+     * 
+     * @param p_value The argument.
+     * @return std::string_view The characters.
+     */
+    static std::string_view view(const T& p_value) {
+        if constexpr (std::is_pointer_v<T>) {
+            return p_value == nullptr ? std::string_view("(null)") : std::string_view(p_value);
+        } else {
+            return std::string_view(p_value);
+        }
+    }
+};
+
+/**
+ * @class CtLogArgs
+ * @brief The binary representation of the arguments of a log message.
+ * 
+ * @ref FR-004-005-002
+ * 
+ * @tparam Args The types of the arguments.
+ */
+template <typename... Args>
+class CtLogArgs {
+public:
+    /**
+     * @brief The binary types of the arguments; one array per argument list.
+     */
+    static constexpr std::array<CtLogArgType, sizeof...(Args)> types = { CtLogArg<std::decay_t<const Args&>>::type()... };
+
+    /**
+     * @brief Get the number of bytes of the binary arguments.
+     * 
+     * @param p_args The arguments.
+     * @return CtUInt32 The number of bytes.
+     */
+    static CtUInt32 size(const Args&... p_args) {
+        return (0u + ... + CtLogArg<std::decay_t<const Args&>>::size(p_args));
+    }
+
+    /**
+     * @brief Write the binary arguments.
+     * 
+     * @param p_out Where to write, size() bytes.
+     * @param p_args The arguments.
+     */
+    static void encode([[maybe_unused]] CtUInt8* p_out, const Args&... p_args) {
+        ((p_out = CtLogArg<std::decay_t<const Args&>>::encode(p_out, p_args)), ...);
+    }
+};
+
+/**
+ * @class CtLogFormat
+ * @brief A format string checked at compile time against the arguments of a log message.
+ * 
+ * @ref FR-004-005-001
+ * 
+ * @details
+ * Constructed implicitly from a string literal. A format string that is invalid or whose number of
+ * placeholders differs from the number of arguments does not compile.
+ * 
+ * @tparam Args The types of the arguments.
+ */
+template <typename... Args>
+class CtLogFormat {
+public:
+    /**
+     * @brief Constructor for CtLogFormat.
+     * 
+     * @param p_format The format string literal.
+     */
+    template <typename S> requires std::is_convertible_v<const S&, std::string_view>
+    consteval CtLogFormat(const S& p_format) : m_format(p_format) {
+        if (CtLogFormatter::countArgs(m_format) != (CtInt32)sizeof...(Args)) {
+            throw "CtLogFormat: invalid format string or wrong number of arguments";
+        }
+    }
+
+    /**
+     * @brief Get the format string.
+     * 
+     * @return std::string_view The format string, in static storage.
+     */
+    constexpr std::string_view get() const {
+        return m_format;
+    }
+
+private:
+    std::string_view m_format;          /**< The format string. */
+};
+
+#endif //INCLUDE_CTLOGFORMAT_HPP_
@@ -0,0 +1,386 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogSink.hpp
+ * @brief Output destinations of CtLogger.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTLOGSINK_HPP_
+#define INCLUDE_CTLOGSINK_HPP_
+
+#include "core.hpp"
+
+#include "io/CtFileOutput.hpp"
+#include "networking/CtSocketUdp.hpp"
+#include "utils/CtLogger.hpp"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#define CT_LOG_MEMORY_SINKS     16u         /**< Maximum number of memory sinks dumped by the crash handler. */
+#define CT_LOG_UDP_MAX_LINE     65000u      /**< Longer lines are truncated by CtLogUdpSink. */
+
+/**
+ * @class CtLogSink
+ * @brief Base class of the destinations of formatted log lines.
+ * 
+ * @ref FR-004-006-001
+ * 
+ * @details
+ * A logger with sinks formats each message once and passes the line to every sink whose level
+ * it reaches. In asynchronous mode all sinks are written by the CtLogBackend thread and flushed once
+ * per batch, in synchronous mode after each line. A sink may be shared by several loggers. Errors of
+ * a sink are ignored, logging never throws.
+ */
+class CtLogSink {
+public:
+    /**
+     * @brief Constructor for CtLogSink.
+     * 
+     * @ref FR-004-006-001
+     * 
+     * @param p_level The lowest level written by the sink.
+     */
+    EXPORTED_API explicit CtLogSink(CtLogger::Level p_level = CtLogger::Level::DEBUG);
+
+    /**
+     * @brief Destructor for CtLogSink.
+     * 
+     * @ref FR-004-006-001
+     */
+    EXPORTED_API virtual ~CtLogSink();
+
+    CtLogSink(const CtLogSink&) = delete;
+    CtLogSink& operator=(const CtLogSink&) = delete;
+
+    /**
+     * @brief Set the lowest level written by the sink.
+     * 
+     * @ref FR-004-006-001
+     * 
+     * @param p_level The level.
+     */
+    EXPORTED_API void setLevel(CtLogger::Level p_level);
+
+    /**
+     * @brief Check if lines of a level are written by the sink.
+     * 
+     * @ref FR-004-006-001
+     * 
+     * @param p_level The level.
+     * @return CtBool CT_TRUE if the level is equal to or above the sink level.
+     */
+    EXPORTED_API CtBool isEnabled(CtLogger::Level p_level) const;
+
+    /**
+     * @brief Write a formatted line if its level is enabled.
+     * 
+     * @ref FR-004-006-001
+     * 
+     * @param p_level The level of the line.
+     * @param p_time The time of the line in nanoseconds since the epoch of the system clock.
+     * @param p_line The line, without a line break.
+     */
+    EXPORTED_API void log(CtLogger::Level p_level, CtUInt64 p_time, std::string_view p_line);
+
+    /**
+     * @brief Make the written lines visible at the destination.
+     * 
+     * @ref FR-004-006-001
+     */
+    EXPORTED_API void flush();
+
+protected:
+    /**
+     * @brief Write a formatted line. Called with the sink locked.
+     * 
+     * @ref FR-004-006-001
+     * 
+     * @param p_level The level of the line.
+     * @param p_time The time of the line in nanoseconds since the epoch of the system clock.
+     * @param p_line The line, without a line break.
+     */
+    virtual void writeLine(CtLogger::Level p_level, CtUInt64 p_time, std::string_view p_line) = 0;
+
+    /**
+     * @brief Write buffered lines to the destination. Called with the sink locked.
+     * 
+     * @ref FR-004-006-001
+     */
+    virtual void flushLines();
+
+protected:
+    CtMutex m_mtx_control;                      /*!< Mutex serializing the loggers that share the sink. */
+
+private:
+    std::atomic<CtLogger::Level> m_level;       /*!< The lowest level written by the sink. */
+};
+
+/**
+ * @class CtLogConsoleSink
+ * @brief Writes log lines to the standard output or the standard error.
+ * 
+ * @ref FR-004-006-002
+ */
+class CtLogConsoleSink : public CtLogSink {
+public:
+    /**
+     * @brief Constructor for CtLogConsoleSink.
+     * 
+     * @ref FR-004-006-002
+     * 
+     * @param p_level The lowest level written by the sink.
+     * @param p_stderr CT_TRUE to write to the standard error instead of the standard output.
+     */
+    EXPORTED_API explicit CtLogConsoleSink(CtLogger::Level p_level = CtLogger::Level::DEBUG, CtBool p_stderr = CT_FALSE);
+
+protected:
+    void writeLine(CtLogger::Level p_level, CtUInt64 p_time, std::string_view p_line) override;
+    void flushLines() override;
+
+private:
+    std::ostream& m_stream;                     /*!< The output stream. */
+};
+
+/**
+ * @class CtLogFileSink
+ * @brief Writes log lines to a file, rotated by size and age.
+ * 
+ * @ref FR-004-006-003
+ * 
+ * @details
+ * On rotation the file is renamed to name.1, older files are shifted to name.2 and so on up to
+ * the maximum number of files, the oldest is removed and a new file is started. Lines are collected
+ * in memory and written through CtFileOutput when the sink is flushed.
+ */
+class CtLogFileSink : public CtLogSink {
+public:
+    /**
+     * @brief Constructor for CtLogFileSink. Lines are appended to an existing file.
+     *      CtFileWriteError is thrown if the file cannot be opened.
+     * 
+     * @ref FR-004-006-003
+     * 
+     * @param p_fileName The path of the file.
+     * @param p_level The lowest level written by the sink.
+     */
+    EXPORTED_API explicit CtLogFileSink(const CtString& p_fileName, CtLogger::Level p_level = CtLogger::Level::DEBUG);
+
+    /**
+     * @brief Destructor for CtLogFileSink. Writes the buffered lines.
+     * 
+     * @ref FR-004-006-003
+     */
+    EXPORTED_API ~CtLogFileSink();
+
+    /**
+     * @brief Rotate when the file would grow beyond a size.
+     * 
+     * @ref FR-004-006-003
+     * 
+     * @param p_size The size in bytes, 0 disables rotation by size.
+     */
+    EXPORTED_API void setMaxSize(CtUInt64 p_size);
+
+    /**
+     * @brief Rotate when the file is older than a duration.
+     * 
+     * @ref FR-004-006-003
+     * 
+     * @param p_seconds The age in seconds, 0 disables rotation by age.
+     */
+    EXPORTED_API void setMaxAge(CtUInt32 p_seconds);
+
+    /**
+     * @brief Set the number of rotated files kept next to the current file. The default is 5.
+     * 
+     * @ref FR-004-006-003
+     * 
+     * @param p_files The number of rotated files.
+     */
+    EXPORTED_API void setMaxFiles(CtUInt32 p_files);
+
+protected:
+    void writeLine(CtLogger::Level p_level, CtUInt64 p_time, std::string_view p_line) override;
+    void flushLines() override;
+
+private:
+    /**
+     * @brief Open the file for appending and read its size.
+     * 
+     * @param p_time The current time in nanoseconds since the epoch.
+     */
+    void open(CtUInt64 p_time);
+
+    /**
+     * @brief Close the file, shift the rotated files and open a new file.
+     * 
+     * @param p_time The current time in nanoseconds since the epoch.
+     */
+    void rotate(CtUInt64 p_time);
+
+private:
+    CtString m_fileName;                        /*!< The path of the current file. */
+    std::unique_ptr<CtFileOutput> m_file;       /*!< The current file. */
+    CtString m_buffer;                          /*!< Lines waiting for flushLines(). */
+    CtUInt64 m_size;                            /*!< The size of the current file including m_buffer. */
+    CtUInt64 m_opened;                          /*!< The time the current file was started. */
+    std::atomic<CtUInt64> m_maxSize;            /*!< Rotation size, 0 if disabled. */
+    std::atomic<CtUInt64> m_maxAge;             /*!< Rotation age in nanoseconds, 0 if disabled. */
+    std::atomic<CtUInt32> m_maxFiles;           /*!< The number of rotated files kept. */
+};
+
+/**
+ * @class CtLogUdpSink
+ * @brief Sends each log line as a UDP datagram with a syslog priority prefix.
+ * 
+ * @ref FR-004-006-004
+ * 
+ * @details
+ * Each datagram is "<PRI>line" where PRI is facility * 8 + severity and the levels map to the syslog
+ * severities debug, info, warning, err and crit. The lines of a batch are sent with one sendBatch()
+ * call. Lines longer than CT_LOG_UDP_MAX_LINE bytes are truncated.
+ */
+class CtLogUdpSink : public CtLogSink {
+public:
+    /**
+     * @brief Constructor for CtLogUdpSink.
+     *      CtSocketError is thrown if the socket cannot be created.
+     * 
+     * @ref FR-004-006-004
+     * 
+     * @param p_address The address of the collector.
+     * @param p_level The lowest level written by the sink.
+     * @param p_facility The syslog facility, 1 (user) by default.
+     */
+    EXPORTED_API explicit CtLogUdpSink(const CtNetAddress& p_address, CtLogger::Level p_level = CtLogger::Level::DEBUG, CtUInt8 p_facility = 1);
+
+protected:
+    void writeLine(CtLogger::Level p_level, CtUInt64 p_time, std::string_view p_line) override;
+    void flushLines() override;
+
+private:
+    CtSocketUdp m_socket;                       /*!< The sending socket. */
+    CtUInt8 m_facility;                         /*!< The syslog facility. */
+    CtString m_buffer;                          /*!< Datagrams waiting for flushLines(). */
+    std::vector<CtUInt32> m_ends;               /*!< End offset of each datagram in m_buffer. */
+    std::vector<CtRawDataView> m_views;         /*!< Views of the datagrams for sendBatch(). */
+};
+
+/**
+ * @class CtLogMemorySink
+ * @brief Keeps the most recent log lines in a memory ring, to be dumped when something goes wrong.
+ * 
+ * @ref FR-004-006-005
+ * 
+ * @details
+ * Typically used with a low level next to a file sink with a high level: the detail is only written
+ * when it is needed. The ring is dumped to the standard error when a line reaches the dump level
+ * (CRITICAL by default) and, after installCrashHandler(), when the process receives a fatal signal.
+ * Dumping only uses write(), so it is safe in a signal handler.
+ * 
+ * @code {.cpp}
+ * auto ring = std::make_shared<CtLogMemorySink>(1 << 20);
+ * logger.addSink(std::make_shared<CtLogFileSink>("app.log", CtLogger::Level::WARNING));
+ * logger.addSink(ring);
+ * CtLogMemorySink::installCrashHandler();
+ * @endcode
+ * 
+ */
+class CtLogMemorySink : public CtLogSink {
+public:
+    /**
+     * @brief Constructor for CtLogMemorySink.
+     * 
+     * @ref FR-004-006-005
+     * 
+     * @param p_capacity The size of the ring in bytes.
+     * @param p_level The lowest level kept by the sink.
+     */
+    EXPORTED_API explicit CtLogMemorySink(CtUInt32 p_capacity, CtLogger::Level p_level = CtLogger::Level::DEBUG);
+
+    /**
+     * @brief Destructor for CtLogMemorySink.
+     * 
+     * @ref FR-004-006-005
+     */
+    EXPORTED_API ~CtLogMemorySink();
+
+    /**
+     * @brief Set the level of the lines that trigger a dump.
+     * 
+     * @ref FR-004-006-005
+     * 
+     * @param p_level The level.
+     */
+    EXPORTED_API void setDumpLevel(CtLogger::Level p_level);
+
+    /**
+     * @brief Get the lines in the ring, oldest first.
+     * 
+     * @ref FR-004-006-005
+     * 
+     * @return CtString The lines, each followed by a line break.
+     */
+    EXPORTED_API CtString getLines();
+
+    /**
+     * @brief Write the lines in the ring to a descriptor, oldest first. Does not lock the sink.
+     * 
+     * @ref FR-004-006-005
+     * 
+     * @param p_fd The descriptor, the standard error by default.
+     */
+    EXPORTED_API void dump(CtInt32 p_fd = 2);
+
+    /**
+     * @brief Dump all memory sinks to the standard error on SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT.
+     *      The default action of the signal follows the dump.
+     * 
+     * @ref FR-004-006-005
+     */
+    EXPORTED_API static void installCrashHandler();
+
+protected:
+    void writeLine(CtLogger::Level p_level, CtUInt64 p_time, std::string_view p_line) override;
+
+private:
+    /**
+     * @brief Get the oldest complete line and the rest of the ring as two contiguous parts.
+     * 
+     * @param p_first The older part.
+     * @param p_second The newer part.
+     */
+    void parts(std::string_view* p_first, std::string_view* p_second) const;
+
+private:
+    std::vector<char> m_data;                   /*!< The ring. */
+    std::atomic<CtUInt64> m_written;            /*!< Bytes written to the ring since the start. */
+    std::atomic<CtLogger::Level> m_dumpLevel;   /*!< Lines of this level or above trigger a dump. */
+};
+
+#endif //INCLUDE_CTLOGSINK_HPP_
@@ -0,0 +1,153 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogTimestamp.hpp
+ * @brief Cached timestamp formatting of CtLogger.
+ * @date 19-10-2026
+ * 
+ */
+
+#ifndef INCLUDE_CTLOGTIMESTAMP_HPP_
+#define INCLUDE_CTLOGTIMESTAMP_HPP_
+
+#include "core.hpp"
+
+#include <string_view>
+
+/**
+ * @class CtLogTimestamp
+ * @brief Formats log timestamps, reformatting only the digits that changed since the previous call.
+ * 
+ * @ref FR-004-007-001
+ * 
+ * @details
+ * The date and the time up to the minutes are rebuilt once per minute with integer arithmetic, the
+ * seconds once per second and only the fraction on every call. Local time uses the UTC offset of the
+ * time zone, which is read with localtime_r() once per quarter of an hour; the global lock and the
+ * time zone checks of localtime() are never taken per line.
+ * 
+ * An object is not thread-safe. local() returns a cached object of the calling thread.
+ * 
+ * | Style   | Zone  | Example                             |
+ * |---------|-------|-------------------------------------|
+ * | Classic | Local | 2026-10-19 14:03:07.123456          |
+ * | Iso8601 | Local | 2026-10-19T14:03:07.123456+03:00    |
+ * | Iso8601 | Utc   | 2026-10-19T11:03:07.123456Z         |
+ */
+class CtLogTimestamp {
+public:
+    /**
+     * @brief Enum representing the digits of the fraction of the second.
+     * 
+     * @ref FR-004-007-002
+     */
+    enum class Precision {
+        Seconds,            /**< No fraction. */
+        Milliseconds,       /**< Three digits. */
+        Microseconds        /**< Six digits. */
+    };
+
+    /**
+     * @brief Enum representing the time zone of the timestamps.
+     * 
+     * @ref FR-004-007-003
+     */
+    enum class Zone {
+        Local,              /**< The local time zone. */
+        Utc                 /**< Coordinated universal time. */
+    };
+
+    /**
+     * @brief Enum representing the layout of the timestamps.
+     * 
+     * @ref FR-004-007-003
+     */
+    enum class Style {
+        Classic,            /**< Date and time separated by a space, without zone. */
+        Iso8601             /**< ISO 8601 with a T separator and the zone designator. */
+    };
+
+    /**
+     * @brief Constructor for CtLogTimestamp.
+     * 
+     * @ref FR-004-007-001
+     * 
+     * @param p_precision The digits of the fraction.
+     * @param p_zone The time zone.
+     * @param p_style The layout.
+     */
+    EXPORTED_API explicit CtLogTimestamp(Precision p_precision = Precision::Seconds, Zone p_zone = Zone::Local, Style p_style = Style::Classic);
+
+    /**
+     * @brief Format a time.
+     * 
+     * @ref FR-004-007-001
+     * @ref FR-004-007-002
+     * @ref FR-004-007-003
+     * 
+     * @param p_time The time in nanoseconds since the epoch of the system clock.
+     * @return std::string_view The timestamp, valid until the next call.
+     */
+    EXPORTED_API std::string_view format(CtUInt64 p_time);
+
+    /**
+     * @brief Get the cached formatter of the calling thread for a configuration.
+     * 
+     * @ref FR-004-007-001
+     * 
+     * @param p_precision The digits of the fraction.
+     * @param p_zone The time zone.
+     * @param p_style The layout.
+     * @return CtLogTimestamp& The formatter.
+     */
+    EXPORTED_API static CtLogTimestamp& local(Precision p_precision = Precision::Seconds, Zone p_zone = Zone::Local, Style p_style = Style::Classic);
+
+private:
+    /**
+     * @brief Read the UTC offset of the local time zone, valid until the next quarter of an hour.
+     * 
+     * @param p_seconds The time in seconds since the epoch.
+     */
+    void updateOffset(CtInt64 p_seconds);
+
+    /**
+     * @brief Rebuild the date, the hours, the minutes and the zone designator.
+     * 
+     * @param p_minute The local time in minutes since the epoch.
+     */
+    void updateMinute(CtInt64 p_minute);
+
+private:
+    Precision m_precision;              /*!< The digits of the fraction. */
+    Zone m_zone;                        /*!< The time zone. */
+    Style m_style;                      /*!< The layout. */
+    CtInt64 m_offset;                   /*!< UTC offset of the local time in seconds. */
+    CtInt64 m_offsetUntil;              /*!< End of the validity of m_offset, in seconds since the epoch. */
+    CtInt64 m_minute;                   /*!< The minute in m_buffer. */
+    CtInt64 m_second;                   /*!< The second in m_buffer. */
+    CtUInt32 m_length;                  /*!< The length of the timestamp in m_buffer. */
+    char m_buffer[40];                  /*!< The last timestamp. */
+};
+
+#endif //INCLUDE_CTLOGTIMESTAMP_HPP_
@@ -35,10 +35,59 @@ SOFTWARE.
 #include "core.hpp"
 
 #include "io/CtFileOutput.hpp"
+#include "utils/CtLogBackend.hpp"
+#include "utils/CtLogBinary.hpp"
+#include "utils/CtLogContext.hpp"
+#include "utils/CtLogFormat.hpp"
+#include "utils/CtLogTimestamp.hpp"
 
-#include <iomanip>
 #include <chrono>
 #include <iostream>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#define CT_LOG_LEVEL_DEBUG      0       /**< Value of CtLogger::Level::DEBUG for CT_LOG_MIN_LEVEL. */
+#define CT_LOG_LEVEL_INFO       1       /**< Value of CtLogger::Level::INFO for CT_LOG_MIN_LEVEL. */
+#define CT_LOG_LEVEL_WARNING    2       /**< Value of CtLogger::Level::WARNING for CT_LOG_MIN_LEVEL. */
+#define CT_LOG_LEVEL_ERROR      3       /**< Value of CtLogger::Level::ERROR for CT_LOG_MIN_LEVEL. */
+#define CT_LOG_LEVEL_CRITICAL   4       /**< Value of CtLogger::Level::CRITICAL for CT_LOG_MIN_LEVEL. */
+
+/**
+ * @brief The lowest level compiled by the CT_LOG_* macros; calls below it generate no code.
+ *      Defaults to CT_LOG_LEVEL_INFO in builds with NDEBUG and to CT_LOG_LEVEL_DEBUG otherwise.
+ * 
+ * @ref FR-004-002-007
+ */
+#ifndef CT_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define CT_LOG_MIN_LEVEL        CT_LOG_LEVEL_INFO
+#else
+#define CT_LOG_MIN_LEVEL        CT_LOG_LEVEL_DEBUG
+#endif
+#endif
+
+/**
+ * @brief Log with a CtLogger at the given level, evaluating the arguments only if the level is enabled.
+ * 
+ * @ref FR-004-002-007
+ */
+#define CT_LOG_AT(p_minLevel, p_level, p_method, p_logger, ...) \
+    do { \
+        if constexpr ((p_minLevel) >= CT_LOG_MIN_LEVEL) { \
+            if ((p_logger).isEnabled(CtLogger::Level::p_level)) { \
+                (p_logger).p_method(__VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define CT_LOG_DEBUG(p_logger, ...)     CT_LOG_AT(CT_LOG_LEVEL_DEBUG, DEBUG, log_debug, p_logger, __VA_ARGS__)         /**< Log at debug level. */
+#define CT_LOG_INFO(p_logger, ...)      CT_LOG_AT(CT_LOG_LEVEL_INFO, INFO, log_info, p_logger, __VA_ARGS__)            /**< Log at info level. */
+#define CT_LOG_WARNING(p_logger, ...)   CT_LOG_AT(CT_LOG_LEVEL_WARNING, WARNING, log_warning, p_logger, __VA_ARGS__)   /**< Log at warning level. */
+#define CT_LOG_ERROR(p_logger, ...)     CT_LOG_AT(CT_LOG_LEVEL_ERROR, ERROR, log_error, p_logger, __VA_ARGS__)         /**< Log at error level. */
+#define CT_LOG_CRITICAL(p_logger, ...)  CT_LOG_AT(CT_LOG_LEVEL_CRITICAL, CRITICAL, log_critical, p_logger, __VA_ARGS__) /**< Log at critical level. */
+
+class CtLogSink;
 
 /**
  * @brief A simple logger with log levels and timestamp.
@@ -47,6 +96,33 @@ SOFTWARE.
  * The CtLogger class provides a mechanism for logging messages with different log levels.
  * The log levels are DEBUG, INFO, WARNING, ERROR, and CRITICAL and can be used to filter messages.
  * The logger also provides a timestamp for each message. It is thread-safe and can be used in multi-threaded environments.
+ * 
+ * By default messages are formatted and written by the calling thread. In CtLogger::Mode::Async the caller
+ * only copies the message into a lock-free queue and CtLogBackend formats and writes it in the background.
+ * 
+ * Messages can also be given as a format string checked at compile time and its arguments (see CtLogFormatter).
+ * In asynchronous mode the caller then copies only the binary arguments and all formatting happens on the
+ * backend thread. With a binary output the records are not formatted at all but written to a binary log
+ * file, to be formatted later by CtLogBinaryReader.
+ * 
+ * Lines are written to the standard output unless sinks are added (see CtLogSink). Each line is formatted
+ * once and passed to all sinks whose level it reaches.
+ * 
+ * Lines are plain text unless a structured encoding is selected with setEncoding(), which writes JSON or
+ * logfmt records with the named arguments of the message and the CtLogContext of the logging thread.
+ * 
+ * @code {.cpp}
+ * CtLogger logger(CtLogger::Level::INFO, "feed");
+ * logger.setMode(CtLogger::Mode::Async);
+ * logger.log_info("order {} filled at {:.2} x {}", orderId, price, quantity);
+ * @endcode
+ * 
+ * The arguments of a method call are evaluated before the level is checked. The CT_LOG_* macros check the
+ * level first and compile to nothing below CT_LOG_MIN_LEVEL, so disabled logging costs nothing.
+ * 
+ * @code {.cpp}
+ * CT_LOG_DEBUG(logger, "book {}", book.dump());    // dump() runs only if DEBUG is enabled
+ * @endcode
  */
 class CtLogger {
 public:
@@ -57,6 +133,27 @@ public:
      */
     enum class Level { DEBUG, INFO, WARNING, ERROR, CRITICAL };
 
+    /**
+     * @brief Enum representing where messages are formatted and written.
+     * 
+     * @ref FR-004-002-006
+     */
+    enum class Mode {
+        Sync,       /**< On the calling thread, one flush per message. */
+        Async       /**< On the CtLogBackend thread, in batches. */
+    };
+
+    /**
+     * @brief Enum representing the layout of the written lines.
+     * 
+     * @ref FR-004-002-008
+     */
+    enum class Encoding {
+        Text,       /**< [time] [level] component: message */
+        Json,       /**< One JSON object per line. */
+        Logfmt      /**< Space separated key=value pairs. */
+    };
+
     /**
      * @brief Constructs a CtLogger with a component name.
      * 
@@ -68,12 +165,90 @@ public:
     EXPORTED_API explicit CtLogger(CtLogger::Level level = CtLogger::Level::DEBUG, const CtString& componentName = "");
 
     /**
-     * @brief Destructor.
+     * @brief Destructor. In asynchronous mode it waits until the pending messages are written.
      * 
      * @ref FR-004-002-002
      */
     EXPORTED_API ~CtLogger();
 
+    /**
+     * @brief Select where messages are formatted and written. Should be called before logging.
+     *          Leaving asynchronous mode waits until the queued messages are written.
+     * 
+     * @ref FR-004-002-006
+     * 
+     * @param p_mode The logging mode.
+     */
+    EXPORTED_API void setMode(CtLogger::Mode p_mode);
+
+    /**
+     * @brief Write the records of this logger unformatted to a binary log file instead of the standard output.
+     *      The logger is switched to asynchronous mode. Should be called before logging.
+     *      CtFileWriteError is thrown if the file cannot be created.
+     * 
+     * @ref FR-004-005-003
+     * 
+     * @param p_fileName The path of the binary log file, truncated if it exists.
+     */
+    EXPORTED_API void setBinaryOutput(const CtString& p_fileName);
+
+    /**
+     * @brief Add an output of the logger. Without sinks, lines are written to the standard output.
+     *      Should be called before logging.
+     * 
+     * @ref FR-004-006-001
+     * 
+     * @param p_sink The sink, may be shared with other loggers.
+     */
+    EXPORTED_API void addSink(std::shared_ptr<CtLogSink> p_sink);
+
+    /**
+     * @brief Select the layout of the written lines. Should be called before logging.
+     * 
+     * @ref FR-004-002-008
+     * 
+     * @details
+     * Structured lines hold the time, the level, the component, the id of the logging thread, the message,
+     * a field per named argument of the format string and the CtLogContext of the logging thread. Selecting
+     * a structured encoding also selects ISO 8601 UTC timestamps with microseconds; setTimestamp() may
+     * change them afterwards. Binary outputs are not affected.
+     * 
+     * @code {.cpp}
+     * logger.setEncoding(CtLogger::Encoding::Json);
+     * logger.log_info("order {id} filled", orderId);
+     * // {"time":"2026-10-19T11:03:07.123456Z","level":"INFO","component":"feed","thread":4711,"msg":"order 42 filled","id":42}
+     * @endcode
+     * 
+     * @param p_encoding The encoding.
+     */
+    EXPORTED_API void setEncoding(CtLogger::Encoding p_encoding);
+
+    /**
+     * @brief Select the format of the timestamps. The default is local time in seconds, as 2026-10-19 14:03:07.
+     *      Should be called before logging.
+     * 
+     * @ref FR-004-007-004
+     * 
+     * @param p_precision The digits of the fraction of the second.
+     * @param p_zone The time zone.
+     * @param p_style The layout.
+     */
+    EXPORTED_API void setTimestamp(CtLogTimestamp::Precision p_precision,
+                                   CtLogTimestamp::Zone p_zone = CtLogTimestamp::Zone::Local,
+                                   CtLogTimestamp::Style p_style = CtLogTimestamp::Style::Classic);
+
+    /**
+     * @brief Check if messages of a level are logged.
+     * 
+     * @ref FR-004-002-007
+     * 
+     * @param p_level The level.
+     * @return CtBool CT_TRUE if the level is equal to or above the logger level.
+     */
+    CtBool isEnabled(CtLogger::Level p_level) const {
+        return p_level >= m_level;
+    }
+
     /**
      * @brief Log a message with debug log level.
      * 
@@ -83,6 +258,21 @@ public:
      */
     EXPORTED_API void log_debug(const CtString& message);
 
+    /**
+     * @brief Log a formatted message with debug log level. The arguments are formatted only if the level is enabled,
+     *      in asynchronous mode by the backend thread.
+     * 
+     * @ref FR-004-002-004
+     * @ref FR-004-005-001
+     * 
+     * @param p_format The format string, checked at compile time against the arguments.
+     * @param p_args The arguments.
+     */
+    template <typename... Args>
+    void log_debug(CtLogFormat<std::type_identity_t<Args>...> p_format, const Args&... p_args) {
+        log(CtLogger::Level::DEBUG, p_format, p_args...);
+    }
+
     /**
      * @brief Log a message with info log level.
      * 
@@ -92,6 +282,21 @@ public:
      */
     EXPORTED_API void log_info(const CtString& message);
 
+    /**
+     * @brief Log a formatted message with info log level. The arguments are formatted only if the level is enabled,
+     *      in asynchronous mode by the backend thread.
+     * 
+     * @ref FR-004-002-004
+     * @ref FR-004-005-001
+     * 
+     * @param p_format The format string, checked at compile time against the arguments.
+     * @param p_args The arguments.
+     */
+    template <typename... Args>
+    void log_info(CtLogFormat<std::type_identity_t<Args>...> p_format, const Args&... p_args) {
+        log(CtLogger::Level::INFO, p_format, p_args...);
+    }
+
     /**
      * @brief Log a message with warning log level.
      * 
@@ -101,6 +306,21 @@ public:
      */
     EXPORTED_API void log_warning(const CtString& message);
 
+    /**
+     * @brief Log a formatted message with warning log level. The arguments are formatted only if the level is enabled,
+     *      in asynchronous mode by the backend thread.
+     * 
+     * @ref FR-004-002-004
+     * @ref FR-004-005-001
+     * 
+     * @param p_format The format string, checked at compile time against the arguments.
+     * @param p_args The arguments.
+     */
+    template <typename... Args>
+    void log_warning(CtLogFormat<std::type_identity_t<Args>...> p_format, const Args&... p_args) {
+        log(CtLogger::Level::WARNING, p_format, p_args...);
+    }
+
     /**
      * @brief Log a message with error log level.
      * 
@@ -110,6 +330,21 @@ public:
      */
     EXPORTED_API void log_error(const CtString& message);
 
+    /**
+     * @brief Log a formatted message with error log level. The arguments are formatted only if the level is enabled,
+     *      in asynchronous mode by the backend thread.
+     * 
+     * @ref FR-004-002-004
+     * @ref FR-004-005-001
+     * 
+     * @param p_format The format string, checked at compile time against the arguments.
+     * @param p_args The arguments.
+     */
+    template <typename... Args>
+    void log_error(CtLogFormat<std::type_identity_t<Args>...> p_format, const Args&... p_args) {
+        log(CtLogger::Level::ERROR, p_format, p_args...);
+    }
+
     /**
      * @brief Log a message with critical log level.
      * 
@@ -119,6 +354,21 @@ public:
      */
     EXPORTED_API void log_critical(const CtString& message);
 
+    /**
+     * @brief Log a formatted message with critical log level. The arguments are formatted only if the level is enabled,
+     *      in asynchronous mode by the backend thread.
+     * 
+     * @ref FR-004-002-004
+     * @ref FR-004-005-001
+     * 
+     * @param p_format The format string, checked at compile time against the arguments.
+     * @param p_args The arguments.
+     */
+    template <typename... Args>
+    void log_critical(CtLogFormat<std::type_identity_t<Args>...> p_format, const Args&... p_args) {
+        log(CtLogger::Level::CRITICAL, p_format, p_args...);
+    }
+
 private:
     /**
      * @brief Log a message with the specified log level.
@@ -127,10 +377,58 @@ private:
      * @ref FR-004-002-005
      * 
      * @param level The log level.
-     * @param componentName The name of the component or module.
-     * @param message The log message.
+     * @param format The format string.
+     * @param args The arguments.
+     */
+    template <typename... Args>
+    void log(CtLogger::Level level, CtLogFormat<std::type_identity_t<Args>...> format, const Args&... args) {
+        if (level < m_level) {
+            return;
+        }
+        CtUInt32 length = CtLogArgs<Args...>::size(args...);
+        CtLogBackend* backend = m_backend.load(std::memory_order_relaxed);
+        if (backend != nullptr && backend->isActive() && length <= backend->maxLength()) {
+            CtLogRecord* record = reserve(backend, level, format.get(), CtLogArgs<Args...>::types.data(), sizeof...(Args), length);
+            if (record != nullptr) {
+                CtLogArgs<Args...>::encode(reinterpret_cast<CtUInt8*>(record + 1), args...);
+                backend->commit();
+            }
+            return;
+        }
+        thread_local std::vector<CtUInt8> data;
+        data.resize(length);
+        CtLogArgs<Args...>::encode(data.data(), args...);
+        logFormatted(level, format.get(), CtLogArgs<Args...>::types.data(), sizeof...(Args), data.data());
+    }
+
+    /**
+     * @brief Reserve a record in the queue of the calling thread and fill its header.
+     * 
+     * @ref FR-004-005-002
+     * 
+     * @param backend The backend.
+     * @param level The log level.
+     * @param format The format string.
+     * @param types The types of the arguments.
+     * @param count The number of arguments.
+     * @param length The number of argument bytes.
+     * @return CtLogRecord* The record, or nullptr if the record is dropped.
+     */
+    EXPORTED_API CtLogRecord* reserve(CtLogBackend* backend, CtLogger::Level level, std::string_view format, const CtLogArgType* types, CtUInt32 count, CtUInt32 length);
+
+    /**
+     * @brief Format a message on the calling thread and write it, or queue it as text if it is too
+     *      large for a record of the asynchronous mode.
+     * 
+     * @ref FR-004-005-001
+     * 
+     * @param level The log level.
+     * @param format The format string.
+     * @param types The types of the arguments.
+     * @param count The number of arguments.
+     * @param data The binary arguments.
      */
-    void log(CtLogger::Level level, const CtString& message);
+    EXPORTED_API void logFormatted(CtLogger::Level level, std::string_view format, const CtLogArgType* types, CtUInt32 count, const CtUInt8* data);
 
     /**
      * @brief Given the logger output level in enum CtLogger::Level format this method returns it in a string format.
@@ -147,17 +445,58 @@ private:
      * 
      * @ref FR-004-002-005
      * 
+     * @param entry The string the generated message is appended to.
      * @param level The level of the message.
      * @param component_name The component's name.
      * @param message The message.
-     * @return const CtString The generated message to be printed via logger.
+     * @param time The time of the message in nanoseconds since the epoch of the system clock.
+     * @param timestamp The formatter of the time.
+     */
+    static void generateLoggerMsg(CtString* entry, CtLogger::Level level, const CtString& component_name, std::string_view message, CtUInt64 time, CtLogTimestamp& timestamp);
+
+    /**
+     * @brief This method generates a structured line of the logger encoding.
+     * 
+     * @ref FR-004-002-008
+     * 
+     * @param entry The string the generated line is appended to.
+     * @param level The level of the message.
+     * @param time The time of the message in nanoseconds since the epoch of the system clock.
+     * @param thread The id of the thread that logged the message.
+     * @param message The formatted message.
+     * @param format The format string.
+     * @param types The types of the arguments.
+     * @param count The number of arguments.
+     * @param data The binary arguments.
+     * @param context The encoded CtLogContext of the thread that logged the message.
      */
-    static const CtString generateLoggerMsg(CtLogger::Level level, const CtString& component_name, const CtString& message);
+    void generateStructuredMsg(CtString* entry, CtLogger::Level level, CtUInt64 time, CtUInt32 thread, std::string_view message,
+                               std::string_view format, const CtLogArgType* types, CtUInt32 count, const CtUInt8* data,
+                               std::string_view context) const;
+
+    /**
+     * @brief Get the timestamp formatter of the calling thread for the format of this logger.
+     * 
+     * @return CtLogTimestamp& The formatter.
+     */
+    CtLogTimestamp& timestamp() const {
+        return CtLogTimestamp::local(m_timestampPrecision, m_timestampZone, m_timestampStyle);
+    }
+
+    friend class CtLogBackend;
+    friend class CtLogBinaryReader;
 
 private:
     CtMutex m_mtx_control;                          /*!< Mutex for controlling access to shared resources. */
     CtLogger::Level m_level;                        /*!< Level of message logging. */
     CtString m_componentName;                       /*!< Component name. */
+    std::atomic<CtLogBackend*> m_backend;           /*!< The backend in asynchronous mode, nullptr in synchronous mode. */
+    std::unique_ptr<CtLogBinaryWriter> m_binaryOutput;  /*!< The binary log file, nullptr for the standard output. */
+    std::vector<std::shared_ptr<CtLogSink>> m_sinks;    /*!< The outputs, empty for the standard output. */
+    CtLogTimestamp::Precision m_timestampPrecision; /*!< The digits of the fraction of the timestamps. */
+    CtLogTimestamp::Zone m_timestampZone;           /*!< The time zone of the timestamps. */
+    CtLogTimestamp::Style m_timestampStyle;         /*!< The layout of the timestamps. */
+    CtLogger::Encoding m_encoding;                  /*!< The layout of the written lines. */
 };
 
 #endif //INCLUDE_CTLOGGER_HPP_
\ No newline at end of file
@@ -116,7 +116,7 @@ CtVector<CtString> CtSocketHelpers::getInterfaces() {
     return s_interfaces;
 }
 
-CtString CtSocketHelpers::interfaceToAddress(const CtString& p_ifName) {
+CtString CtSocketHelpers::interfaceToAddress(const CtString& p_ifName, CtInt32 p_family) {
     struct ifaddrs *ifaddr, *ifa;
 
     if (getifaddrs(&ifaddr) == -1) {
@@ -126,11 +126,10 @@ CtString CtSocketHelpers::interfaceToAddress(const CtString& p_ifName) {
     for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next) {
         if (CtString(ifa->ifa_name) == p_ifName) {
             if (ifa->ifa_addr == nullptr) {
-                freeifaddrs(ifaddr);
-                throw CtSocketError("Not valid interface entered.");
+                continue;
             }
 
-            if (ifa->ifa_addr->sa_family == AF_INET) {
+            if (ifa->ifa_addr->sa_family == AF_INET && p_family == AF_INET) {
                 CtChar ipBuffer[INET_ADDRSTRLEN];
                 sockaddr_in* sockAddr = reinterpret_cast<sockaddr_in*>(ifa->ifa_addr);
 
@@ -142,6 +141,23 @@ CtString CtSocketHelpers::interfaceToAddress(const CtString& p_ifName) {
                 freeifaddrs(ifaddr);
                 return ipBuffer;
             }
+
+            if (ifa->ifa_addr->sa_family == AF_INET6 && p_family == AF_INET6) {
+                CtChar ipBuffer[INET6_ADDRSTRLEN];
+                sockaddr_in6* sockAddr = reinterpret_cast<sockaddr_in6*>(ifa->ifa_addr);
+
+                if (inet_ntop(AF_INET6, &(sockAddr->sin6_addr), ipBuffer, INET6_ADDRSTRLEN) == nullptr) {
+                    freeifaddrs(ifaddr);
+                    throw CtSocketError("Failed to convert IPv6 address.");
+                }
+
+                CtString s_address(ipBuffer);
+                if (IN6_IS_ADDR_LINKLOCAL(&sockAddr->sin6_addr)) {
+                    s_address += CtString("%") + p_ifName;
+                }
+                freeifaddrs(ifaddr);
+                return s_address;
+            }
         }
     }
 
@@ -150,9 +166,9 @@ CtString CtSocketHelpers::interfaceToAddress(const CtString& p_ifName) {
 }
 
 CtUInt32 CtSocketHelpers::getAddressAsUInt(const CtString& p_addr) {
-    CtUInt32 result = inet_addr(p_addr.c_str());
+    CtUInt32 result;
 
-    if (result == INADDR_NONE) {
+    if (inet_pton(AF_INET, p_addr.c_str(), &result) != 1) {
         throw CtSocketError("Invalid address given.");
     }
 
@@ -0,0 +1,93 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtRawDataPool.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "core/CtRawDataPool.hpp"
+
+#include <bit>
+
+CtRawDataPool::CtRawDataPool(CtUInt32 p_maxCached) : m_allocations(0) {
+    for (CtUInt32 idx = 0; idx < m_classes; idx++) {
+        m_free[idx] = std::make_unique<CtRingBuffer<CtUInt8*>>(p_maxCached);
+    }
+}
+
+CtRawDataPool::~CtRawDataPool() {
+    CtUInt8* s_buffer;
+    for (CtUInt32 idx = 0; idx < m_classes; idx++) {
+        while (m_free[idx]->tryPop(s_buffer)) {
+            delete[] s_buffer;
+        }
+    }
+}
+
+CtUInt8* CtRawDataPool::acquire(CtUInt32 p_size, CtUInt32& p_capacity) {
+    CtUInt32 s_class = sizeClass(p_size);
+    CtUInt8* s_buffer = nullptr;
+
+    if (s_class < m_classes) {
+        p_capacity = 1u << (s_class + CT_POOL_MIN_SHIFT);
+        if (m_free[s_class]->tryPop(s_buffer)) {
+            return s_buffer;
+        }
+    } else {
+        p_capacity = p_size;
+    }
+    m_allocations++;
+    return new CtUInt8[p_capacity];
+}
+
+void CtRawDataPool::release(CtUInt8* p_buffer, CtUInt32 p_capacity) {
+    if (p_buffer == nullptr) {
+        return;
+    }
+    CtUInt32 s_class = sizeClass(p_capacity);
+    if (s_class < m_classes && (1u << (s_class + CT_POOL_MIN_SHIFT)) == p_capacity && m_free[s_class]->tryPush(p_buffer)) {
+        return;
+    }
+    delete[] p_buffer;
+}
+
+CtUInt64 CtRawDataPool::getAllocations() {
+    return m_allocations.load();
+}
+
+CtRawDataPool& CtRawDataPool::global() {
+    static CtRawDataPool* s_pool = new CtRawDataPool();
+    return *s_pool;
+}
+
+CtUInt32 CtRawDataPool::sizeClass(CtUInt32 p_size) {
+    CtUInt32 s_shift = (p_size <= 1) ? 0 : std::bit_width(p_size - 1);
+    if (s_shift < CT_POOL_MIN_SHIFT) {
+        s_shift = CT_POOL_MIN_SHIFT;
+    }
+    return (s_shift > CT_POOL_MAX_SHIFT) ? m_classes : s_shift - CT_POOL_MIN_SHIFT;
+}
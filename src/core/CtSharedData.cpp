@@ -0,0 +1,207 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtSharedData.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "core/CtSharedData.hpp"
+#include "core/CtRawDataPool.hpp"
+
+#include "core/exceptions/CtTypeExceptions.hpp"
+
+#include <cstring>
+
+/**
+ * @brief A reference counted block of bytes used by one or more segments.
+ * 
+ */
+typedef struct _CtSharedBuffer {
+    CtAtomic<CtUInt32> refs;
+    CtUInt8* data;
+    CtUInt32 capacity;
+    CtRawDataPool* pool;
+} CtSharedBuffer;
+
+/**
+ * @brief A range of bytes inside a CtSharedBuffer.
+ * 
+ */
+typedef struct _CtSharedSegment {
+    CtSharedBuffer* buffer;
+    CtUInt32 size;
+} CtSharedSegment;
+
+/**
+ * @brief The immutable list of segments shared by the CtSharedData copies.
+ *      The first segment is stored inline so that a single buffer needs no vector.
+ * 
+ */
+struct CtSharedData::CtSharedChain {
+    CtAtomic<CtUInt32> refs;
+    CtUInt32 size;
+    CtSharedSegment first;
+    CtVector<CtSharedSegment> more;
+};
+
+static CtSharedBuffer* acquireBuffer(CtSharedBuffer* p_buffer) {
+    p_buffer->refs.fetch_add(1, std::memory_order_relaxed);
+    return p_buffer;
+}
+
+static void releaseBuffer(CtSharedBuffer* p_buffer) {
+    if (p_buffer->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        if (p_buffer->pool != nullptr) {
+            p_buffer->pool->release(p_buffer->data, p_buffer->capacity);
+        } else {
+            delete[] p_buffer->data;
+        }
+        delete p_buffer;
+    }
+}
+
+CtSharedData::CtSharedData() : m_chain(nullptr) {
+}
+
+CtSharedData::CtSharedData(CtSharedChain* p_chain) : m_chain(p_chain) {
+}
+
+CtSharedData::CtSharedData(CtRawData&& p_data) {
+    CtSharedBuffer* s_buffer = new CtSharedBuffer{{1}, p_data.m_data, p_data.m_capacity, p_data.m_pool};
+    m_chain = new CtSharedChain{{1}, p_data.m_size, {s_buffer, p_data.m_size}, {}};
+    p_data.m_data = nullptr;
+    p_data.m_size = 0;
+    p_data.m_maxSize = 0;
+    p_data.m_capacity = 0;
+}
+
+CtSharedData::CtSharedData(const CtRawDataView& p_data) {
+    CtSharedBuffer* s_buffer = new CtSharedBuffer{{1}, nullptr, 0, &CtRawDataPool::global()};
+    s_buffer->data = s_buffer->pool->acquire(p_data.size(), s_buffer->capacity);
+    if (p_data.size() > 0) {
+        memcpy(s_buffer->data, p_data.get(), p_data.size());
+    }
+    m_chain = new CtSharedChain{{1}, p_data.size(), {s_buffer, p_data.size()}, {}};
+}
+
+CtSharedData::CtSharedData(const CtSharedData& p_data) : m_chain(p_data.m_chain) {
+    if (m_chain != nullptr) {
+        m_chain->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+CtSharedData::CtSharedData(CtSharedData&& p_data) noexcept : m_chain(p_data.m_chain) {
+    p_data.m_chain = nullptr;
+}
+
+CtSharedData::~CtSharedData() {
+    release();
+}
+
+CtSharedData& CtSharedData::operator=(const CtSharedData& other) {
+    if (m_chain != other.m_chain) {
+        release();
+        m_chain = other.m_chain;
+        if (m_chain != nullptr) {
+            m_chain->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    return *this;
+}
+
+CtSharedData& CtSharedData::operator=(CtSharedData&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_chain = other.m_chain;
+        other.m_chain = nullptr;
+    }
+    return *this;
+}
+
+CtUInt32 CtSharedData::size() const {
+    return (m_chain != nullptr) ? m_chain->size : 0;
+}
+
+CtBool CtSharedData::empty() const {
+    return size() == 0;
+}
+
+CtUInt32 CtSharedData::segments() const {
+    return (m_chain != nullptr) ? 1 + m_chain->more.size() : 0;
+}
+
+CtRawDataView CtSharedData::segment(CtUInt32 p_idx) const {
+    if (p_idx >= segments()) {
+        throw CtOutOfRangeError("Segment index is out of range.");
+    }
+    const CtSharedSegment& s_segment = (p_idx == 0) ? m_chain->first : m_chain->more[p_idx - 1];
+    return CtRawDataView(s_segment.buffer->data, s_segment.size);
+}
+
+CtUInt32 CtSharedData::useCount() const {
+    return (m_chain != nullptr) ? m_chain->refs.load(std::memory_order_relaxed) : 0;
+}
+
+CtSharedData CtSharedData::append(const CtSharedData& p_data) const {
+    if (p_data.m_chain == nullptr) {
+        return *this;
+    }
+    if (m_chain == nullptr) {
+        return p_data;
+    }
+
+    CtSharedChain* s_chain = new CtSharedChain{{1}, m_chain->size + p_data.m_chain->size, m_chain->first, {}};
+    s_chain->more.reserve(segments() + p_data.segments() - 1);
+    acquireBuffer(s_chain->first.buffer);
+    for (const CtSharedSegment& s_segment : m_chain->more) {
+        s_chain->more.push_back({acquireBuffer(s_segment.buffer), s_segment.size});
+    }
+    s_chain->more.push_back({acquireBuffer(p_data.m_chain->first.buffer), p_data.m_chain->first.size});
+    for (const CtSharedSegment& s_segment : p_data.m_chain->more) {
+        s_chain->more.push_back({acquireBuffer(s_segment.buffer), s_segment.size});
+    }
+    return CtSharedData(s_chain);
+}
+
+void CtSharedData::copyTo(CtRawData* p_data) const {
+    p_data->reset();
+    for (CtUInt32 idx = 0; idx < segments(); idx++) {
+        CtRawDataView s_segment = segment(idx);
+        p_data->setNextBytes((CtUInt8*)s_segment.get(), s_segment.size());
+    }
+}
+
+void CtSharedData::release() {
+    if (m_chain != nullptr && m_chain->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        releaseBuffer(m_chain->first.buffer);
+        for (const CtSharedSegment& s_segment : m_chain->more) {
+            releaseBuffer(s_segment.buffer);
+        }
+        delete m_chain;
+    }
+    m_chain = nullptr;
+}
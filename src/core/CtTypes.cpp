@@ -30,36 +30,56 @@ SOFTWARE.
  */
 
 #include "core/CtTypes.hpp"
+#include "core/CtRawDataPool.hpp"
 
 #include "core/exceptions/CtTypeExceptions.hpp"
 
 #include <cstring>
+#include <arpa/inet.h>
+#include <net/if.h>
 #include <memory>
+#include <algorithm>
 
-CtRawData::CtRawData(CtUInt32 p_size) : m_maxSize(p_size) {
-    m_data = new CtUInt8[m_maxSize];
+CtRawData::CtRawData(CtUInt32 p_size) : CtRawData(p_size, nullptr) {
+};
+
+CtRawData::CtRawData(CtUInt32 p_size, CtRawDataPool* p_pool) : m_maxSize(p_size), m_pool(p_pool), m_growable(CT_FALSE) {
+    if (m_pool != nullptr) {
+        m_data = m_pool->acquire(m_maxSize, m_capacity);
+    } else {
+        m_data = new CtUInt8[m_maxSize];
+        m_capacity = m_maxSize;
+    }
     m_size = 0;
 };
 
-CtRawData::CtRawData(CtRawData& p_data) : m_maxSize(p_data.maxSize()) {
-    m_data = new CtUInt8[m_maxSize];
+CtRawData::CtRawData(const CtRawData& p_data) : CtRawData(p_data.maxSize(), p_data.m_pool) {
+    m_growable = p_data.isGrowable();
     clone(p_data);
 };
 
+CtRawData::CtRawData(CtRawData&& p_data) noexcept : m_data(p_data.m_data), m_size(p_data.m_size), m_maxSize(p_data.m_maxSize),
+                                                   m_capacity(p_data.m_capacity), m_pool(p_data.m_pool), m_growable(p_data.m_growable) {
+    p_data.m_data = nullptr;
+    p_data.m_size = 0;
+    p_data.m_maxSize = 0;
+    p_data.m_capacity = 0;
+};
+
 CtRawData::~CtRawData() {
-    delete[] m_data;
+    release();
 }
 
 void CtRawData::setNextByte(CtUInt8 p_data) {
     if (m_size >= m_maxSize) {
-        throw CtOutOfRangeError("Data size is out of range.");
+        ensure(m_size + 1);
     } 
     m_data[m_size++] = p_data;
 }
 
 void CtRawData::setNextBytes(CtUInt8* p_data, CtUInt32 p_size) {
     if (m_size + p_size > m_maxSize) {
-        throw CtOutOfRangeError("Data size is out of range.");
+        ensure(m_size + p_size);
     }
     memcpy(&m_data[m_size], p_data, p_size);
     m_size += p_size;
@@ -79,11 +99,11 @@ void CtRawData::removeNLastBytes(CtUInt32 p_num) {
     m_size -= p_num;
 }
 
-CtUInt32 CtRawData::size() {
+CtUInt32 CtRawData::size() const {
     return m_size;
 }
 
-CtUInt32 CtRawData::maxSize() {
+CtUInt32 CtRawData::maxSize() const {
     return m_maxSize;
 }
 
@@ -91,17 +111,25 @@ CtUInt8* CtRawData::get() {
     return m_data;
 }
 
+const CtUInt8* CtRawData::get() const {
+    return m_data;
+}
+
+CtRawDataView CtRawData::view() const {
+    return CtRawDataView(m_data, m_size);
+}
+
 void CtRawData::clone(const CtUInt8* p_data, CtUInt32 p_size) {
     if (p_size > m_maxSize) {
-        throw CtOutOfRangeError("Data size is out of range.");
+        ensure(p_size);
     }
     m_size = p_size;
     memcpy(m_data, p_data, p_size);
 }
 
-void CtRawData::clone(CtRawData& p_data) {
+void CtRawData::clone(const CtRawData& p_data) {
     if (p_data.size() > m_maxSize) {
-        throw CtOutOfRangeError("Data size is out of range.");
+        ensure(p_data.size());
     }
     m_size = p_data.size();
     memcpy(m_data, p_data.get(), p_data.size());
@@ -111,9 +139,212 @@ void CtRawData::reset() {
     m_size = 0;
 }
 
-CtRawData& CtRawData::operator=(CtRawData& other) {
+CtRawData& CtRawData::operator=(const CtRawData& other) {
     if (this != &other) {
         clone(other);
     }
     return *this;
 }
+
+CtRawData& CtRawData::operator=(CtRawData&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_maxSize = other.m_maxSize;
+        m_capacity = other.m_capacity;
+        m_pool = other.m_pool;
+        m_growable = other.m_growable;
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_maxSize = 0;
+        other.m_capacity = 0;
+    }
+    return *this;
+}
+
+void CtRawData::setGrowable(CtBool p_growable) {
+    m_growable = p_growable;
+}
+
+CtBool CtRawData::isGrowable() const {
+    return m_growable;
+}
+
+void CtRawData::reserve(CtUInt32 p_size) {
+    if (p_size > m_capacity) {
+        reallocate(p_size);
+    }
+    if (p_size > m_maxSize) {
+        m_maxSize = p_size;
+    }
+}
+
+void CtRawData::resize(CtUInt32 p_size) {
+    if (p_size > m_maxSize) {
+        ensure(p_size);
+    }
+    m_size = p_size;
+}
+
+void CtRawData::ensure(CtUInt32 p_size) {
+    if (!m_growable) {
+        throw CtOutOfRangeError("Data size is out of range.");
+    }
+    CtUInt64 s_size = std::max<CtUInt64>(m_maxSize, 1);
+    while (s_size < p_size) {
+        s_size <<= 1;
+    }
+    reserve((CtUInt32)std::min<CtUInt64>(s_size, UINT32_MAX));
+}
+
+void CtRawData::reallocate(CtUInt32 p_capacity) {
+    CtUInt32 s_capacity = p_capacity;
+    CtUInt8* s_data = (m_pool != nullptr) ? m_pool->acquire(p_capacity, s_capacity) : new CtUInt8[p_capacity];
+    if (m_size > 0) {
+        memcpy(s_data, m_data, m_size);
+    }
+    release();
+    m_data = s_data;
+    m_capacity = s_capacity;
+}
+
+void CtRawData::release() {
+    if (m_pool != nullptr) {
+        m_pool->release(m_data, m_capacity);
+    } else {
+        delete[] m_data;
+    }
+}
+
+CtRawDataView::CtRawDataView() : m_data(nullptr), m_size(0) {
+}
+
+CtRawDataView::CtRawDataView(const CtUInt8* p_data, CtUInt32 p_size) : m_data(p_data), m_size(p_size) {
+}
+
+CtRawDataView::CtRawDataView(const CtRawData& p_data) : m_data(p_data.get()), m_size(p_data.size()) {
+}
+
+CtRawDataView::CtRawDataView(std::span<const CtUInt8> p_span) : m_data(p_span.data()), m_size((CtUInt32)p_span.size()) {
+}
+
+const CtUInt8* CtRawDataView::get() const {
+    return m_data;
+}
+
+CtUInt32 CtRawDataView::size() const {
+    return m_size;
+}
+
+CtBool CtRawDataView::empty() const {
+    return m_size == 0;
+}
+
+CtRawDataView CtRawDataView::subview(CtUInt32 p_offset, CtUInt32 p_size) const {
+    if (p_offset > m_size) {
+        throw CtOutOfRangeError("Data size is out of range.");
+    }
+    if (p_size == UINT32_MAX) {
+        p_size = m_size - p_offset;
+    } else if (p_size > m_size - p_offset) {
+        throw CtOutOfRangeError("Data size is out of range.");
+    }
+    return CtRawDataView(m_data + p_offset, p_size);
+}
+
+std::span<const CtUInt8> CtRawDataView::span() const {
+    return std::span<const CtUInt8>(m_data, m_size);
+}
+
+CtNetAddress::CtNetAddress() {
+    memset(&m_address, 0, sizeof(m_address));
+    m_address.base.sa_family = AF_UNSPEC;
+}
+
+CtNetAddress::CtNetAddress(const CtString& p_addr, CtUInt16 p_port) : CtNetAddress() {
+    if (inet_pton(AF_INET, p_addr.c_str(), &m_address.v4.sin_addr) == 1) {
+        m_address.v4.sin_family = AF_INET;
+        m_address.v4.sin_port = htons(p_port);
+        return;
+    }
+
+    CtString s_addr = p_addr;
+    size_t s_scope = p_addr.find('%');
+    if (s_scope != CtString::npos) {
+        m_address.v6.sin6_scope_id = if_nametoindex(p_addr.c_str() + s_scope + 1);
+        if (m_address.v6.sin6_scope_id == 0) {
+            throw CtTypeParseError(p_addr + CtString(" has an unknown interface."));
+        }
+        s_addr = p_addr.substr(0, s_scope);
+    }
+    if (inet_pton(AF_INET6, s_addr.c_str(), &m_address.v6.sin6_addr) != 1) {
+        throw CtTypeParseError(p_addr + CtString(" can not be parsed as network address."));
+    }
+    m_address.v6.sin6_family = AF_INET6;
+    m_address.v6.sin6_port = htons(p_port);
+}
+
+CtInt32 CtNetAddress::getFamily() const {
+    return m_address.base.sa_family;
+}
+
+CtString CtNetAddress::getAddress() const {
+    CtChar s_buffer[INET6_ADDRSTRLEN];
+    if (m_address.base.sa_family == AF_INET) {
+        return inet_ntop(AF_INET, &m_address.v4.sin_addr, s_buffer, sizeof(s_buffer));
+    } else if (m_address.base.sa_family == AF_INET6) {
+        return inet_ntop(AF_INET6, &m_address.v6.sin6_addr, s_buffer, sizeof(s_buffer));
+    }
+    return CtString();
+}
+
+CtUInt16 CtNetAddress::getPort() const {
+    return ntohs((m_address.base.sa_family == AF_INET6) ? m_address.v6.sin6_port : m_address.v4.sin_port);
+}
+
+void CtNetAddress::setPort(CtUInt16 p_port) {
+    if (m_address.base.sa_family == AF_INET6) {
+        m_address.v6.sin6_port = htons(p_port);
+    } else {
+        m_address.v4.sin_port = htons(p_port);
+    }
+}
+
+CtNetAddress CtNetAddress::toIpv6() const {
+    if (m_address.base.sa_family != AF_INET) {
+        return *this;
+    }
+    CtNetAddress s_mapped;
+    s_mapped.m_address.v6.sin6_family = AF_INET6;
+    s_mapped.m_address.v6.sin6_port = m_address.v4.sin_port;
+    s_mapped.m_address.v6.sin6_addr.s6_addr[10] = 0xff;
+    s_mapped.m_address.v6.sin6_addr.s6_addr[11] = 0xff;
+    memcpy(&s_mapped.m_address.v6.sin6_addr.s6_addr[12], &m_address.v4.sin_addr, sizeof(m_address.v4.sin_addr));
+    return s_mapped;
+}
+
+const struct sockaddr* CtNetAddress::getSockAddr() const {
+    return &m_address.base;
+}
+
+struct sockaddr* CtNetAddress::getSockAddr() {
+    return &m_address.base;
+}
+
+socklen_t CtNetAddress::getSockLength() const {
+    return (m_address.base.sa_family == AF_INET6) ? sizeof(m_address.v6) : sizeof(m_address.v4);
+}
+
+CtBool CtNetAddress::operator==(const CtNetAddress& p_other) const {
+    if (m_address.base.sa_family != p_other.m_address.base.sa_family) {
+        return CT_FALSE;
+    }
+    if (m_address.base.sa_family == AF_INET6) {
+        return m_address.v6.sin6_port == p_other.m_address.v6.sin6_port &&
+               m_address.v6.sin6_scope_id == p_other.m_address.v6.sin6_scope_id &&
+               memcmp(&m_address.v6.sin6_addr, &p_other.m_address.v6.sin6_addr, sizeof(m_address.v6.sin6_addr)) == 0;
+    }
+    return m_address.v4.sin_port == p_other.m_address.v4.sin_port &&
+           m_address.v4.sin_addr.s_addr == p_other.m_address.v4.sin_addr.s_addr;
+}
@@ -31,16 +31,46 @@ SOFTWARE.
 
 #include "io/CtFileInput.hpp"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * @brief Bytes kept in front of each block so that the read position can move back
+ *      after a block switch. It must be larger than the maximum delimiter size.
+ * 
+ */
+#define CT_FILE_URING_HISTORY   256u
+
 CtFileInput::CtFileInput(const CtString& p_fileName) {
     m_delim = nullptr;
     m_delim_size = 0;
+    m_ring = nullptr;
+    m_offset = 0;
+    m_block = 0;
+    m_pos = 0;
+    m_eof = CT_FALSE;
+    m_record.setGrowable(CT_TRUE);
+    // opened together with the stream, so that useIoUring() continues on the same file
+    m_fd = ::open(p_fileName.c_str(), O_RDONLY | O_CLOEXEC);
+    if (m_fd == -1) {
+        throw CtFileReadError("File cannot open.");
+    }
     m_file.open(p_fileName, std::ofstream::in);
     if (!m_file.is_open()) {
+        ::close(m_fd);
         throw CtFileReadError("File cannot open.");
     }
 }
 
 CtFileInput::~CtFileInput() {
+    if (m_ring != nullptr) {
+        for (CtFileInputBlock& s_block : m_blocks) {
+            if (s_block.busy) {
+                m_ring->wait(&s_block.request);
+            }
+        }
+    }
+    ::close(m_fd);
     if (m_file.is_open()) {
         m_file.close();
     }
@@ -65,16 +95,16 @@ void CtFileInput::setDelimiter(const CtChar* p_delim, CtUInt8 p_delim_size) {
 CtBool CtFileInput::read(CtRawData* p_data) {
     CtBool s_res = CT_FALSE;
 
-    if (m_file.is_open()) {
+    if (m_file.is_open() || m_ring != nullptr) {
         CtChar next_char;
         CtUInt8* delim_ptr = nullptr;
         p_data->reset();
 
-        while (m_file.get(next_char)) {
+        while (nextChar(next_char)) {
             try {
                 p_data->setNextByte(next_char);
             } catch (const CtOutOfRangeError& e) {
-                m_file.seekg(-(m_delim_size+1), std::ios::cur);
+                rewind(m_delim_size + 1);
                 p_data->removeNLastBytes(m_delim_size);
                 break;
             }
@@ -91,8 +121,6 @@ CtBool CtFileInput::read(CtRawData* p_data) {
 
         if (p_data->size() > 0) {
             s_res = CT_TRUE;
-        } else if (m_file.eof()) {
-            s_res = CT_FALSE;
         }
     } else {
         throw CtFileReadError("File is not open.");
@@ -100,3 +128,107 @@ CtBool CtFileInput::read(CtRawData* p_data) {
 
     return s_res;
 }
+
+CtBool CtFileInput::read(CtRawDataView* p_view) {
+    if (m_ring != nullptr && m_delim_size > 0) {
+        if (m_pos >= (CtInt32)m_blocks[m_block].size && !nextBlock()) {
+            return CT_FALSE;
+        }
+        CtFileInputBlock& s_block = m_blocks[m_block];
+        CtUInt8* s_start = &s_block.buffer[CT_FILE_URING_HISTORY + m_pos];
+        CtUInt32 s_left = s_block.size - m_pos;
+        CtUInt8* s_found = (CtUInt8*)memmem(s_start, s_left, m_delim, m_delim_size);
+        if (s_found != nullptr) {
+            *p_view = CtRawDataView(s_start, s_found - s_start);
+            m_pos += (s_found - s_start) + m_delim_size;
+            return CT_TRUE;
+        }
+    }
+
+    CtBool s_res = read(&m_record);
+    *p_view = m_record.view();
+    return s_res;
+}
+
+CtBool CtFileInput::useIoUring(CtIoUring* p_ring) {
+    if (!CtIoUring::isSupported()) {
+        return CT_FALSE;
+    }
+    if (m_ring != nullptr) {
+        throw CtFileReadError("io_uring is already enabled.");
+    }
+    if (!m_file.is_open()) {
+        throw CtFileReadError("File is not open.");
+    }
+
+    std::streampos s_pos = m_file.tellg();
+    m_offset = (s_pos == std::streampos(-1)) ? ::lseek(m_fd, 0, SEEK_END) : (CtUInt64)s_pos;
+
+    if (p_ring == nullptr) {
+        m_ownRing = std::make_unique<CtIoUring>();
+        p_ring = m_ownRing.get();
+    }
+    for (CtFileInputBlock& s_block : m_blocks) {
+        s_block.buffer = std::make_unique<CtUInt8[]>(CT_FILE_URING_HISTORY + CT_IO_URING_BLOCK_SIZE);
+        s_block.size = 0;
+        s_block.busy = CT_FALSE;
+    }
+    m_file.close();
+    m_ring = p_ring;
+    m_block = 0;
+    m_pos = 0;
+    m_eof = CT_FALSE;
+    requestBlock(m_blocks[1]);
+    return CT_TRUE;
+}
+
+CtBool CtFileInput::nextChar(CtChar& p_char) {
+    if (m_ring == nullptr) {
+        return m_file.get(p_char) ? CT_TRUE : CT_FALSE;
+    }
+    if (m_pos >= (CtInt32)m_blocks[m_block].size && !nextBlock()) {
+        return CT_FALSE;
+    }
+    p_char = (CtChar)m_blocks[m_block].buffer[CT_FILE_URING_HISTORY + m_pos++];
+    return CT_TRUE;
+}
+
+void CtFileInput::rewind(CtUInt32 p_count) {
+    if (m_ring == nullptr) {
+        m_file.seekg(-(CtInt32)p_count, std::ios::cur);
+    } else {
+        m_pos -= p_count;
+    }
+}
+
+CtBool CtFileInput::nextBlock() {
+    if (m_eof) {
+        return CT_FALSE;
+    }
+
+    CtFileInputBlock& s_current = m_blocks[m_block];
+    CtFileInputBlock& s_next = m_blocks[1 - m_block];
+    m_ring->wait(&s_next.request);
+    s_next.busy = CT_FALSE;
+    if (s_next.request.result < 0) {
+        throw CtFileReadError("File cannot be read.");
+    }
+    if (s_next.request.result == 0) {
+        m_eof = CT_TRUE;
+        return CT_FALSE;
+    }
+    s_next.size = s_next.request.result;
+    m_offset += s_next.size;
+
+    memcpy(s_next.buffer.get(), &s_current.buffer[s_current.size], CT_FILE_URING_HISTORY);
+    m_block = 1 - m_block;
+    m_pos = 0;
+    requestBlock(s_current);
+    return CT_TRUE;
+}
+
+void CtFileInput::requestBlock(CtFileInputBlock& p_block) {
+    p_block.busy = CT_TRUE;
+    m_ring->prepareRead(m_fd, &p_block.buffer[CT_FILE_URING_HISTORY], CT_IO_URING_BLOCK_SIZE, m_offset, &p_block.request);
+    m_ring->submit();
+}
@@ -31,8 +31,22 @@ SOFTWARE.
 
 #include "io/CtFileOutput.hpp"
 
-CtFileOutput::CtFileOutput(const CtString& p_fileName, WriteMode p_mode) {
+#include <fcntl.h>
+#include <unistd.h>
+#include <chrono>
+#include <algorithm>
+
+#define CT_FILE_ASYNC_BATCH     64u
+#define CT_FILE_ASYNC_IDLE_MS   100u
+#define CT_FILE_URING_BLOCKS    4u
+
+CtFileOutput::CtFileOutput(const CtString& p_fileName, WriteMode p_mode) : m_fileName(p_fileName), m_pending(0), m_dropped(0), m_idle(CT_FALSE), m_failed(CT_FALSE) {
     m_delim_size = 0;
+    m_ring = nullptr;
+    m_fd = -1;
+    m_offset = 0;
+    m_block = 0;
+    m_policy = OverflowPolicy::Block;
     switch (p_mode) {
         case WriteMode::Append:
             m_file.open(p_fileName, std::ios::out | std::ios::app);
@@ -45,15 +59,41 @@ CtFileOutput::CtFileOutput(const CtString& p_fileName, WriteMode p_mode) {
     if (!m_file.is_open()) {
         throw CtFileWriteError("File cannot open.");
     }
+    // opened right after the stream, so flush() syncs this file even if the path is renamed or unlinked later
+    m_fd = ::open(p_fileName.c_str(), O_WRONLY | O_CLOEXEC);
+    if (m_fd == -1) {
+        m_file.close();
+        throw CtFileWriteError("File cannot open.");
+    }
 }
 
 CtFileOutput::~CtFileOutput() {
+    if (m_queue) {
+        setRunning(CT_FALSE);
+        {
+            std::scoped_lock lock(m_mtx_idle);
+            m_cv_idle.notify_one();
+        }
+        CtThread::stop();
+        while (drain() > 0) {}
+    }
+    if (m_ring != nullptr) {
+        try {
+            submitBlock();
+            for (CtFileOutputBlock& s_block : m_blocks) {
+                waitBlock(s_block);
+            }
+        } catch (const CtException& e) {
+        }
+    }
     if (m_file.is_open()) {
         m_file.close();
     }
+    ::close(m_fd);
 }
 
 void CtFileOutput::setDelimiter(const CtChar* p_delim, CtUInt8 p_delim_size) {
+    std::scoped_lock lock(m_mtx_file);
     if (p_delim_size > 0 && p_delim != nullptr) {
         m_delim_size = p_delim_size;
         m_delim.reset();
@@ -66,20 +106,278 @@ void CtFileOutput::setDelimiter(const CtChar* p_delim, CtUInt8 p_delim_size) {
 }
 
 void CtFileOutput::write(CtRawData* p_data) {
-    if (m_file.is_open()) {
-        m_file.write((CtChar*)p_data->get(), p_data->size());
-        if (m_delim_size > 0) {
-            m_file.write(m_delim.get(), m_delim_size);
-        }
+    write(p_data->view());
+}
+
+void CtFileOutput::write(const CtRawDataView& p_data) {
+    if (m_queue) {
+        enqueue(p_data, CT_TRUE);
     } else {
-        throw CtFileWriteError("File is not open.");
+        writeData(p_data.get(), p_data.size(), CT_TRUE);
+    }
+}
+
+void CtFileOutput::write(const CtSharedData& p_data) {
+    if (m_queue) {
+        enqueue(p_data, CT_TRUE);
+    } else {
+        writeShared(p_data, CT_TRUE);
     }
 }
 
 void CtFileOutput::writePart(CtRawData* p_data) {
-    if (m_file.is_open()) {
-        m_file.write((CtChar*)p_data->get(), p_data->size());
+    writePart(p_data->view());
+}
+
+void CtFileOutput::writePart(const CtRawDataView& p_data) {
+    if (m_queue) {
+        enqueue(p_data, CT_FALSE);
+    } else {
+        writeData(p_data.get(), p_data.size(), CT_FALSE);
+    }
+}
+
+void CtFileOutput::writePart(const CtSharedData& p_data) {
+    if (m_queue) {
+        enqueue(p_data, CT_FALSE);
     } else {
-        throw CtFileWriteError("File is not open.");
+        writeShared(p_data, CT_FALSE);
+    }
+}
+
+void CtFileOutput::setAsync(CtUInt32 p_capacity, OverflowPolicy p_policy) {
+    if (m_queue) {
+        throw CtFileWriteError("Async mode is already enabled.");
+    }
+    m_policy = p_policy;
+    m_queue = std::make_unique<CtRingBuffer<CtFileOutputEntry>>(p_capacity);
+    start();
+}
+
+void CtFileOutput::flush() {
+    {
+        std::unique_lock lock(m_mtx_flushed);
+        while (m_pending.load() != 0) {
+            m_cv_flushed.wait_for(lock, std::chrono::milliseconds(CT_FILE_ASYNC_IDLE_MS));
+        }
+    }
+    if (m_failed.exchange(CT_FALSE)) {
+        throw CtFileWriteError("File cannot be written.");
+    }
+
+    std::scoped_lock lock(m_mtx_file);
+    if (m_ring != nullptr) {
+        submitBlock();
+        for (CtFileOutputBlock& s_block : m_blocks) {
+            waitBlock(s_block);
+        }
+        if (::fsync(m_fd) == -1) {
+            throw CtFileWriteError("File cannot be synced.");
+        }
+        return;
+    }
+
+    m_file.flush();
+    if (m_file.fail()) {
+        throw CtFileWriteError("File cannot be written.");
+    }
+
+    if (::fsync(m_fd) == -1) {
+        throw CtFileWriteError("File cannot be synced.");
+    }
+}
+
+CtUInt64 CtFileOutput::getDroppedWrites() {
+    return m_dropped.load();
+}
+
+CtBool CtFileOutput::useIoUring(CtIoUring* p_ring) {
+    if (!CtIoUring::isSupported()) {
+        return CT_FALSE;
+    }
+
+    std::scoped_lock lock(m_mtx_file);
+    if (m_ring != nullptr) {
+        throw CtFileWriteError("io_uring is already enabled.");
+    }
+
+    m_file.flush();
+    m_offset = ::lseek(m_fd, 0, SEEK_END);
+
+    if (p_ring == nullptr) {
+        m_ownRing = std::make_unique<CtIoUring>();
+        p_ring = m_ownRing.get();
     }
-}
\ No newline at end of file
+    m_blocks.resize(CT_FILE_URING_BLOCKS);
+    for (CtFileOutputBlock& s_block : m_blocks) {
+        s_block.buffer = std::make_unique<CtUInt8[]>(CT_IO_URING_BLOCK_SIZE);
+        s_block.size = 0;
+        s_block.offset = 0;
+        s_block.busy = CT_FALSE;
+    }
+    m_block = 0;
+    m_file.close();
+    m_ring = p_ring;
+    return CT_TRUE;
+}
+
+void CtFileOutput::writeData(const CtUInt8* p_data, CtUInt32 p_size, CtBool p_delimited) {
+    writeRaw(p_data, p_size);
+    if (p_delimited && m_delim_size > 0) {
+        writeRaw((CtUInt8*)m_delim.get(), m_delim_size);
+    }
+}
+
+void CtFileOutput::writeShared(const CtSharedData& p_data, CtBool p_delimited) {
+    for (CtUInt32 idx = 0; idx < p_data.segments(); idx++) {
+        CtRawDataView s_segment = p_data.segment(idx);
+        writeRaw(s_segment.get(), s_segment.size());
+    }
+    if (p_delimited && m_delim_size > 0) {
+        writeRaw((CtUInt8*)m_delim.get(), m_delim_size);
+    }
+}
+
+void CtFileOutput::writeRaw(const CtUInt8* p_data, CtUInt32 p_size) {
+    if (m_ring == nullptr) {
+        if (!m_file.is_open()) {
+            throw CtFileWriteError("File is not open.");
+        }
+        m_file.write((const CtChar*)p_data, p_size);
+        return;
+    }
+
+    while (p_size > 0) {
+        CtFileOutputBlock& s_block = m_blocks[m_block];
+        if (s_block.busy) {
+            waitBlock(s_block);
+        }
+        CtUInt32 s_size = std::min(p_size, CT_IO_URING_BLOCK_SIZE - s_block.size);
+        memcpy(&s_block.buffer[s_block.size], p_data, s_size);
+        s_block.size += s_size;
+        p_data += s_size;
+        p_size -= s_size;
+        if (s_block.size == CT_IO_URING_BLOCK_SIZE) {
+            submitBlock();
+        }
+    }
+}
+
+void CtFileOutput::submitBlock() {
+    CtFileOutputBlock& s_block = m_blocks[m_block];
+    if (s_block.busy || s_block.size == 0) {
+        return;
+    }
+    s_block.offset = m_offset;
+    s_block.busy = CT_TRUE;
+    m_offset += s_block.size;
+    m_ring->prepareWrite(m_fd, s_block.buffer.get(), s_block.size, s_block.offset, &s_block.request);
+    m_ring->submit();
+    m_block = (m_block + 1) % m_blocks.size();
+}
+
+void CtFileOutput::waitBlock(CtFileOutputBlock& p_block) {
+    CtUInt32 s_written = 0;
+    while (p_block.busy) {
+        m_ring->wait(&p_block.request);
+        if (p_block.request.result <= 0) {
+            p_block.busy = CT_FALSE;
+            p_block.size = 0;
+            throw CtFileWriteError("File cannot be written.");
+        }
+        s_written += p_block.request.result;
+        if (s_written < p_block.size) {
+            m_ring->prepareWrite(m_fd, &p_block.buffer[s_written], p_block.size - s_written, p_block.offset + s_written, &p_block.request);
+            m_ring->submit();
+        } else {
+            p_block.busy = CT_FALSE;
+            p_block.size = 0;
+        }
+    }
+}
+
+void CtFileOutput::enqueue(const CtRawDataView& p_data, CtBool p_delimited) {
+    CtFileOutputEntry s_entry;
+    s_entry.data = CtRawDataPool::global().acquire(p_data.size(), s_entry.capacity);
+    s_entry.size = p_data.size();
+    s_entry.delimited = p_delimited;
+    memcpy(s_entry.data, p_data.get(), s_entry.size);
+
+    if (!push(s_entry)) {
+        CtRawDataPool::global().release(s_entry.data, s_entry.capacity);
+    }
+}
+
+void CtFileOutput::enqueue(const CtSharedData& p_data, CtBool p_delimited) {
+    CtFileOutputEntry s_entry;
+    s_entry.data = nullptr;
+    s_entry.size = 0;
+    s_entry.capacity = 0;
+    s_entry.shared = p_data;
+    s_entry.delimited = p_delimited;
+    push(s_entry);
+}
+
+CtBool CtFileOutput::push(CtFileOutputEntry& p_entry) {
+    m_pending++;
+    while (!m_queue->tryPush(std::move(p_entry))) {
+        if (m_policy == OverflowPolicy::Drop) {
+            m_dropped++;
+            if (--m_pending == 0) {
+                std::scoped_lock lock(m_mtx_flushed);
+                m_cv_flushed.notify_all();
+            }
+            return CT_FALSE;
+        }
+        std::this_thread::yield();
+    }
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_idle.load()) {
+        std::scoped_lock lock(m_mtx_idle);
+        m_cv_idle.notify_one();
+    }
+    return CT_TRUE;
+}
+
+CtUInt32 CtFileOutput::drain() {
+    CtFileOutputEntry s_entry;
+    CtUInt32 s_count = 0;
+
+    std::scoped_lock lock(m_mtx_file);
+    while (s_count < CT_FILE_ASYNC_BATCH && m_queue->tryPop(s_entry)) {
+        try {
+            if (s_entry.data != nullptr) {
+                writeData(s_entry.data, s_entry.size, s_entry.delimited);
+            } else {
+                writeShared(s_entry.shared, s_entry.delimited);
+            }
+        } catch (const CtException& e) {
+            m_failed.store(CT_TRUE);
+        }
+        if (s_entry.data != nullptr) {
+            CtRawDataPool::global().release(s_entry.data, s_entry.capacity);
+        }
+        s_entry.shared = CtSharedData();
+        s_count++;
+    }
+    if (s_count > 0 && (m_pending -= s_count) == 0) {
+        std::scoped_lock lock(m_mtx_flushed);
+        m_cv_flushed.notify_all();
+    }
+    return s_count;
+}
+
+void CtFileOutput::loop() {
+    if (drain() > 0) {
+        return;
+    }
+
+    std::unique_lock lock(m_mtx_idle);
+    m_idle.store(CT_TRUE);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (isRunning() && m_queue->empty()) {
+        m_cv_idle.wait_for(lock, std::chrono::milliseconds(CT_FILE_ASYNC_IDLE_MS));
+    }
+    m_idle.store(CT_FALSE);
+}
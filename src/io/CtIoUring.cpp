@@ -0,0 +1,227 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtIoUring.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "io/CtIoUring.hpp"
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+static CtInt32 ioUringSetup(CtUInt32 p_entries, struct io_uring_params* p_params) {
+    return (CtInt32)syscall(__NR_io_uring_setup, p_entries, p_params);
+}
+
+static CtInt32 ioUringEnter(CtInt32 p_fd, CtUInt32 p_toSubmit, CtUInt32 p_minComplete, CtUInt32 p_flags) {
+    return (CtInt32)syscall(__NR_io_uring_enter, p_fd, p_toSubmit, p_minComplete, p_flags, nullptr, 0);
+}
+
+CtIoUring::CtIoUring(CtUInt32 p_entries) : m_toSubmit(0), m_inFlight(0) {
+    struct io_uring_params s_params;
+    memset(&s_params, 0, sizeof(s_params));
+
+    m_fd = ioUringSetup(p_entries, &s_params);
+    if (m_fd < 0) {
+        throw CtIoUringError("io_uring cannot be created.");
+    }
+    m_entries = s_params.sq_entries;
+
+    m_sqRingSize = s_params.sq_off.array + s_params.sq_entries * sizeof(CtUInt32);
+    m_cqRingSize = s_params.cq_off.cqes + s_params.cq_entries * sizeof(struct io_uring_cqe);
+    m_sqesSize = s_params.sq_entries * sizeof(struct io_uring_sqe);
+    if (s_params.features & IORING_FEAT_SINGLE_MMAP) {
+        m_sqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+        m_cqRingSize = m_sqRingSize;
+    }
+
+    m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+    if (m_sqRing == MAP_FAILED) {
+        close(m_fd);
+        throw CtIoUringError("io_uring submission queue cannot be mapped.");
+    }
+
+    if (s_params.features & IORING_FEAT_SINGLE_MMAP) {
+        m_cqRing = m_sqRing;
+    } else {
+        m_cqRing = mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_CQ_RING);
+        if (m_cqRing == MAP_FAILED) {
+            munmap(m_sqRing, m_sqRingSize);
+            close(m_fd);
+            throw CtIoUringError("io_uring completion queue cannot be mapped.");
+        }
+    }
+
+    m_sqes = mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+    if (m_sqes == MAP_FAILED) {
+        if (m_cqRing != m_sqRing) {
+            munmap(m_cqRing, m_cqRingSize);
+        }
+        munmap(m_sqRing, m_sqRingSize);
+        close(m_fd);
+        throw CtIoUringError("io_uring submission entries cannot be mapped.");
+    }
+
+    CtUInt8* s_sq = (CtUInt8*)m_sqRing;
+    CtUInt8* s_cq = (CtUInt8*)m_cqRing;
+    m_sqHead = (CtUInt32*)(s_sq + s_params.sq_off.head);
+    m_sqTail = (CtUInt32*)(s_sq + s_params.sq_off.tail);
+    m_sqMask = (CtUInt32*)(s_sq + s_params.sq_off.ring_mask);
+    m_sqArray = (CtUInt32*)(s_sq + s_params.sq_off.array);
+    m_cqHead = (CtUInt32*)(s_cq + s_params.cq_off.head);
+    m_cqTail = (CtUInt32*)(s_cq + s_params.cq_off.tail);
+    m_cqMask = (CtUInt32*)(s_cq + s_params.cq_off.ring_mask);
+    m_cqes = s_cq + s_params.cq_off.cqes;
+    m_sqLocalTail = *m_sqTail;
+}
+
+CtIoUring::~CtIoUring() {
+    munmap(m_sqes, m_sqesSize);
+    if (m_cqRing != m_sqRing) {
+        munmap(m_cqRing, m_cqRingSize);
+    }
+    munmap(m_sqRing, m_sqRingSize);
+    close(m_fd);
+}
+
+CtBool CtIoUring::isSupported() {
+    static const CtBool s_supported = []() {
+        struct io_uring_params s_params;
+        memset(&s_params, 0, sizeof(s_params));
+        CtInt32 s_fd = ioUringSetup(2, &s_params);
+        if (s_fd < 0) {
+            return (CtBool)CT_FALSE;
+        }
+        close(s_fd);
+        return (CtBool)CT_TRUE;
+    }();
+    return s_supported;
+}
+
+void CtIoUring::prepareRead(CtInt32 p_fd, CtUInt8* p_buffer, CtUInt32 p_size, CtUInt64 p_offset, CtIoUringRequest* p_request) {
+    struct io_uring_sqe* s_sqe = (struct io_uring_sqe*)nextEntry();
+    p_request->iov.iov_base = p_buffer;
+    p_request->iov.iov_len = p_size;
+    p_request->result = 0;
+    p_request->done = CT_FALSE;
+    s_sqe->opcode = IORING_OP_READV;
+    s_sqe->fd = p_fd;
+    s_sqe->addr = (CtUInt64)&p_request->iov;
+    s_sqe->len = 1;
+    s_sqe->off = p_offset;
+    s_sqe->user_data = (CtUInt64)p_request;
+}
+
+void CtIoUring::prepareWrite(CtInt32 p_fd, const CtUInt8* p_buffer, CtUInt32 p_size, CtUInt64 p_offset, CtIoUringRequest* p_request) {
+    struct io_uring_sqe* s_sqe = (struct io_uring_sqe*)nextEntry();
+    p_request->iov.iov_base = (void*)p_buffer;
+    p_request->iov.iov_len = p_size;
+    p_request->result = 0;
+    p_request->done = CT_FALSE;
+    s_sqe->opcode = IORING_OP_WRITEV;
+    s_sqe->fd = p_fd;
+    s_sqe->addr = (CtUInt64)&p_request->iov;
+    s_sqe->len = 1;
+    s_sqe->off = p_offset;
+    s_sqe->user_data = (CtUInt64)p_request;
+}
+
+void CtIoUring::submit() {
+    if (m_toSubmit > 0) {
+        enter(0);
+    }
+}
+
+void CtIoUring::wait(CtIoUringRequest* p_request) {
+    poll();
+    while (!p_request->done) {
+        enter(1);
+        poll();
+    }
+}
+
+CtUInt32 CtIoUring::poll() {
+    CtUInt32 s_count = 0;
+    CtUInt32 s_head = *m_cqHead;
+    CtUInt32 s_tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+    struct io_uring_cqe* s_cqes = (struct io_uring_cqe*)m_cqes;
+
+    while (s_head != s_tail) {
+        struct io_uring_cqe* s_cqe = &s_cqes[s_head & *m_cqMask];
+        CtIoUringRequest* s_request = (CtIoUringRequest*)s_cqe->user_data;
+        s_request->result = s_cqe->res;
+        s_request->done = CT_TRUE;
+        s_head++;
+        s_count++;
+    }
+    __atomic_store_n(m_cqHead, s_head, __ATOMIC_RELEASE);
+    m_inFlight -= s_count;
+    return s_count;
+}
+
+CtUInt32 CtIoUring::inFlight() {
+    return m_inFlight;
+}
+
+void* CtIoUring::nextEntry() {
+    /* Keep the number of requests in flight within the completion queue size. */
+    while (m_inFlight >= m_entries) {
+        enter(1);
+        poll();
+    }
+
+    CtUInt32 s_index = m_sqLocalTail & *m_sqMask;
+    struct io_uring_sqe* s_sqe = &((struct io_uring_sqe*)m_sqes)[s_index];
+    memset(s_sqe, 0, sizeof(struct io_uring_sqe));
+    m_sqArray[s_index] = s_index;
+    m_sqLocalTail++;
+    m_toSubmit++;
+    m_inFlight++;
+    return s_sqe;
+}
+
+void CtIoUring::enter(CtUInt32 p_minComplete) {
+    CtUInt32 s_flags = (p_minComplete > 0) ? IORING_ENTER_GETEVENTS : 0;
+    CtInt32 s_res;
+
+    /* Publish the prepared entries to the kernel. */
+    __atomic_store_n(m_sqTail, m_sqLocalTail, __ATOMIC_RELEASE);
+    do {
+        s_res = ioUringEnter(m_fd, m_toSubmit, p_minComplete, s_flags);
+    } while (s_res < 0 && errno == EINTR);
+
+    if (s_res < 0) {
+        throw CtIoUringError("io_uring requests cannot be submitted.");
+    }
+    m_toSubmit -= std::min((CtUInt32)s_res, m_toSubmit);
+}
@@ -0,0 +1,194 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtReactor.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "networking/CtReactor.hpp"
+
+#include <unistd.h>
+#include <cerrno>
+
+CtReactor::CtReactor(Trigger p_trigger, CtWorkerPool* p_pool) : m_trigger(p_trigger), m_pool(p_pool), m_inFlight(0) {
+    m_epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (m_epfd == -1) {
+        throw CtReactorError("Epoll instance cannot be created.");
+    }
+}
+
+CtReactor::~CtReactor() {
+    stopReactor();
+    while (m_inFlight.load() > 0) {
+        CtThread::sleepFor(1);
+    }
+    close(m_epfd);
+}
+
+void CtReactor::add(CtInt32 p_fd, CtUInt32 p_events, const CtReactorCallback& p_callback) {
+    std::shared_ptr<CtReactorHandler> s_handler = std::make_shared<CtReactorHandler>();
+    s_handler->fd = p_fd;
+    s_handler->events = p_events;
+    s_handler->callback = p_callback;
+
+    std::scoped_lock lock(m_mtx_handlers);
+    struct epoll_event s_event;
+    s_event.events = epollEvents(p_events);
+    s_event.data.fd = p_fd;
+    if (epoll_ctl(m_epfd, EPOLL_CTL_ADD, p_fd, &s_event) == -1) {
+        throw CtReactorError("Descriptor cannot be registered.");
+    }
+    m_handlers[p_fd] = s_handler;
+}
+
+void CtReactor::add(CtSocketUdp& p_socket, const CtReactorCallback& p_callback) {
+    add(p_socket.getFd(), EPOLLIN, p_callback);
+}
+
+void CtReactor::remove(CtInt32 p_fd) {
+    std::scoped_lock lock(m_mtx_handlers);
+    if (m_handlers.erase(p_fd) > 0) {
+        epoll_ctl(m_epfd, EPOLL_CTL_DEL, p_fd, nullptr);
+    }
+}
+
+void CtReactor::remove(CtSocketUdp& p_socket) {
+    remove(p_socket.getFd());
+}
+
+CtUInt32 CtReactor::size() {
+    std::scoped_lock lock(m_mtx_handlers);
+    return m_handlers.size();
+}
+
+void CtReactor::setErrorCallback(const CtReactorErrorCallback& p_callback) {
+    std::scoped_lock lock(m_mtx_handlers);
+    m_errorCallback = p_callback;
+}
+
+CtUInt32 CtReactor::poll(CtInt32 p_timeout) {
+    struct epoll_event s_events[CT_REACTOR_EVENTS];
+    CtInt32 s_ready = epoll_wait(m_epfd, s_events, CT_REACTOR_EVENTS, p_timeout);
+    if (s_ready == -1) {
+        if (errno == EINTR) {
+            return 0;
+        }
+        throw CtReactorError("Epoll wait failed.");
+    }
+
+    std::shared_ptr<CtReactorHandler> s_handlers[CT_REACTOR_EVENTS];
+    {
+        std::scoped_lock lock(m_mtx_handlers);
+        for (CtInt32 idx = 0; idx < s_ready; idx++) {
+            auto s_it = m_handlers.find(s_events[idx].data.fd);
+            if (s_it != m_handlers.end()) {
+                s_handlers[idx] = s_it->second;
+            }
+        }
+    }
+
+    CtUInt32 s_dispatched = 0;
+    for (CtInt32 idx = 0; idx < s_ready; idx++) {
+        if (!s_handlers[idx]) {
+            continue;
+        }
+        CtUInt32 s_revents = s_events[idx].events;
+        if (m_pool != nullptr) {
+            m_inFlight++;
+            std::shared_ptr<CtReactorHandler> s_handler = s_handlers[idx];
+            m_pool->addTask([this, s_handler, s_revents]() {
+                dispatch(s_handler, s_revents);
+                m_inFlight--;
+            });
+        } else {
+            dispatch(s_handlers[idx], s_revents);
+        }
+        s_dispatched++;
+    }
+    return s_dispatched;
+}
+
+void CtReactor::runReactor() {
+    start();
+}
+
+void CtReactor::stopReactor() {
+    stop();
+}
+
+void CtReactor::dispatch(const std::shared_ptr<CtReactorHandler>& p_handler, CtUInt32 p_events) {
+    try {
+        p_handler->callback(p_handler->fd, p_events);
+    } catch (const std::exception& e) {
+        reportError(p_handler->fd, e.what());
+    } catch (...) {
+        reportError(p_handler->fd, "Unknown exception.");
+    }
+    if (m_pool == nullptr) {
+        return;
+    }
+
+    std::scoped_lock lock(m_mtx_handlers);
+    auto s_it = m_handlers.find(p_handler->fd);
+    if (s_it != m_handlers.end() && s_it->second == p_handler) {
+        struct epoll_event s_event;
+        s_event.events = epollEvents(p_handler->events);
+        s_event.data.fd = p_handler->fd;
+        epoll_ctl(m_epfd, EPOLL_CTL_MOD, p_handler->fd, &s_event);
+    }
+}
+
+CtUInt32 CtReactor::epollEvents(CtUInt32 p_events) {
+    if (m_trigger == Trigger::Edge) {
+        p_events |= EPOLLET;
+    }
+    if (m_pool != nullptr) {
+        p_events |= EPOLLONESHOT;
+    }
+    return p_events;
+}
+
+void CtReactor::reportError(CtInt32 p_fd, const CtString& p_message) {
+    CtReactorErrorCallback s_callback;
+    {
+        std::scoped_lock lock(m_mtx_handlers);
+        s_callback = m_errorCallback;
+    }
+    if (s_callback) {
+        s_callback(p_fd, p_message);
+    }
+}
+
+void CtReactor::loop() {
+    try {
+        poll(CT_REACTOR_TIMEOUT);
+    } catch (const CtException& e) {
+        reportError(-1, e.what());
+        // a failing epoll_wait returns at once, wait before the next attempt
+        CtThread::sleepFor(CT_REACTOR_TIMEOUT);
+    }
+}
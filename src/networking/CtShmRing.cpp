@@ -0,0 +1,247 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtShmRing.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "networking/CtShmRing.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+/**
+ * @brief Value stored in the header of an initialized ring.
+ * 
+ */
+#define CT_SHM_MAGIC            0x474e495248535443ull
+
+/**
+ * @brief Length value marking that the next message starts at the beginning of the ring.
+ * 
+ */
+#define CT_SHM_WRAP             0xFFFFFFFFu
+
+/**
+ * @brief Minimum number of data bytes of a ring.
+ * 
+ */
+#define CT_SHM_MIN_CAPACITY     64u
+
+/**
+ * @brief Size of a message record: the length field and the data, aligned to 8 bytes.
+ * 
+ */
+#define CT_SHM_RECORD(size)     ((((CtUInt64)(size)) + sizeof(CtUInt32) + 7u) & ~7ull)
+
+CtShmRing::CtShmRing(const CtString& p_name, CtUInt32 p_capacity) : m_fd(-1), m_size(0), m_header(nullptr), m_data(nullptr), m_mask(0) {
+    CtUInt32 s_capacity = CT_SHM_MIN_CAPACITY;
+    while (s_capacity < p_capacity) {
+        if (s_capacity > (1u << 30)) {
+            throw CtIpcError("Ring capacity is too large.");
+        }
+        s_capacity <<= 1;
+    }
+
+    m_fd = memfd_create(p_name.c_str(), MFD_CLOEXEC);
+    if (m_fd == -1) {
+        throw CtIpcError("Shared memory cannot be created.");
+    }
+    if (ftruncate(m_fd, sizeof(CtShmHeader) + s_capacity) == -1) {
+        close(m_fd);
+        throw CtIpcError("Shared memory cannot be sized.");
+    }
+    map(sizeof(CtShmHeader) + s_capacity);
+
+    new (m_header) CtShmHeader();
+    m_header->capacity = s_capacity;
+    m_header->head.store(0);
+    m_header->tail.store(0);
+    m_header->readerWaiting.store(0);
+    m_header->writerWaiting.store(0);
+    m_header->dataSignal.store(0);
+    m_header->spaceSignal.store(0);
+    m_header->magic = CT_SHM_MAGIC;
+    m_mask = s_capacity - 1;
+}
+
+CtShmRing::CtShmRing(CtInt32 p_fd) : m_fd(p_fd), m_size(0), m_header(nullptr), m_data(nullptr), m_mask(0) {
+    struct stat s_stat;
+    if (fstat(m_fd, &s_stat) == -1 || (CtUInt64)s_stat.st_size <= sizeof(CtShmHeader)) {
+        close(m_fd);
+        throw CtIpcError("Descriptor is not a shared memory ring.");
+    }
+    map(s_stat.st_size);
+    if (m_header->magic != CT_SHM_MAGIC || sizeof(CtShmHeader) + m_header->capacity != m_size) {
+        munmap(m_header, m_size);
+        close(m_fd);
+        throw CtIpcError("Descriptor is not a shared memory ring.");
+    }
+    m_mask = m_header->capacity - 1;
+}
+
+CtShmRing::~CtShmRing() {
+    munmap(m_header, m_size);
+    close(m_fd);
+}
+
+CtInt32 CtShmRing::getFd() {
+    return m_fd;
+}
+
+CtUInt32 CtShmRing::capacity() {
+    return m_mask + 1;
+}
+
+CtBool CtShmRing::write(const CtRawDataView& p_data, CtInt32 p_timeout) {
+    CtUInt64 s_record = CT_SHM_RECORD(p_data.size());
+    if (s_record > capacity() / 2) {
+        throw CtIpcError("Message does not fit in the ring.");
+    }
+
+    CtUInt64 s_head = m_header->head.load(std::memory_order_relaxed);
+    CtUInt32 s_offset = s_head & m_mask;
+    CtUInt32 s_toEnd = capacity() - s_offset;
+    CtUInt64 s_needed = (s_record > s_toEnd) ? s_toEnd + s_record : s_record;
+    auto s_ready = [&]() {
+        return capacity() - (s_head - m_header->tail.load(std::memory_order_acquire)) >= s_needed;
+    };
+    if (!s_ready() && (p_timeout == 0 || !wait(m_header->writerWaiting, m_header->spaceSignal, s_ready, p_timeout))) {
+        return CT_FALSE;
+    }
+
+    if (s_record > s_toEnd) {
+        CtUInt32 s_wrap = CT_SHM_WRAP;
+        memcpy(m_data + s_offset, &s_wrap, sizeof(s_wrap));
+        s_head += s_toEnd;
+        s_offset = 0;
+    }
+    CtUInt32 s_size = p_data.size();
+    memcpy(m_data + s_offset, &s_size, sizeof(s_size));
+    memcpy(m_data + s_offset + sizeof(s_size), p_data.get(), s_size);
+    m_header->head.store(s_head + s_record, std::memory_order_release);
+
+    wake(m_header->readerWaiting, m_header->dataSignal);
+    return CT_TRUE;
+}
+
+CtBool CtShmRing::read(CtRawData* p_message, CtInt32 p_timeout) {
+    CtUInt64 s_tail = m_header->tail.load(std::memory_order_relaxed);
+    auto s_ready = [&]() {
+        return m_header->head.load(std::memory_order_acquire) != s_tail;
+    };
+    if (!s_ready() && (p_timeout == 0 || !wait(m_header->readerWaiting, m_header->dataSignal, s_ready, p_timeout))) {
+        return CT_FALSE;
+    }
+
+    CtUInt64 s_head = m_header->head.load(std::memory_order_acquire);
+    CtUInt32 s_offset = s_tail & m_mask;
+    CtUInt32 s_size;
+    memcpy(&s_size, m_data + s_offset, sizeof(s_size));
+    if (s_size == CT_SHM_WRAP) {
+        s_tail += capacity() - s_offset;
+        s_offset = 0;
+        memcpy(&s_size, m_data, sizeof(s_size));
+    }
+    // the record is written by the other process, it must not make this one read outside the ring
+    if (s_size > capacity() / 2 - sizeof(s_size) || s_offset + CT_SHM_RECORD(s_size) > capacity() ||
+        s_head - s_tail > capacity() || s_head - s_tail < CT_SHM_RECORD(s_size)) {
+        throw CtIpcError("Ring is corrupted.");
+    }
+    CtUInt64 s_next = s_tail + CT_SHM_RECORD(s_size);
+    if (s_size > p_message->maxSize() && !p_message->isGrowable()) {
+        m_header->tail.store(s_next, std::memory_order_release);
+        wake(m_header->writerWaiting, m_header->spaceSignal);
+        throw CtIpcError("Message does not fit in the buffer and was dropped.");
+    }
+    if (s_size > p_message->maxSize()) {
+        p_message->reserve(s_size);
+    }
+    p_message->resize(s_size);
+    memcpy(p_message->get(), m_data + s_offset + sizeof(s_size), s_size);
+    m_header->tail.store(s_next, std::memory_order_release);
+
+    wake(m_header->writerWaiting, m_header->spaceSignal);
+    return CT_TRUE;
+}
+
+void CtShmRing::map(CtUInt64 p_size) {
+    void* s_memory = mmap(nullptr, p_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (s_memory == MAP_FAILED) {
+        close(m_fd);
+        throw CtIpcError("Shared memory cannot be mapped.");
+    }
+    m_size = p_size;
+    m_header = (CtShmHeader*)s_memory;
+    m_data = (CtUInt8*)s_memory + sizeof(CtShmHeader);
+}
+
+template <typename Ready>
+CtBool CtShmRing::wait(std::atomic<CtUInt32>& p_waiting, std::atomic<CtUInt32>& p_signal, Ready p_ready, CtInt32 p_timeout) {
+    auto s_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(p_timeout);
+    while (CT_TRUE) {
+        CtUInt32 s_signal = p_signal.load(std::memory_order_acquire);
+        p_waiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (p_ready()) {
+            p_waiting.store(0, std::memory_order_relaxed);
+            return CT_TRUE;
+        }
+
+        struct timespec s_time;
+        struct timespec* s_timeout = nullptr;
+        if (p_timeout > 0) {
+            auto s_left = std::chrono::duration_cast<std::chrono::nanoseconds>(s_deadline - std::chrono::steady_clock::now()).count();
+            if (s_left <= 0) {
+                p_waiting.store(0, std::memory_order_relaxed);
+                return p_ready();
+            }
+            s_time.tv_sec = s_left / 1000000000;
+            s_time.tv_nsec = s_left % 1000000000;
+            s_timeout = &s_time;
+        }
+        syscall(SYS_futex, (CtUInt32*)&p_signal, FUTEX_WAIT, s_signal, s_timeout, nullptr, 0);
+        p_waiting.store(0, std::memory_order_relaxed);
+        if (p_ready()) {
+            return CT_TRUE;
+        }
+    }
+}
+
+void CtShmRing::wake(std::atomic<CtUInt32>& p_waiting, std::atomic<CtUInt32>& p_signal) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (p_waiting.load(std::memory_order_relaxed) != 0) {
+        p_signal.fetch_add(1, std::memory_order_release);
+        syscall(SYS_futex, (CtUInt32*)&p_signal, FUTEX_WAKE, 1, nullptr, nullptr, 0);
+    }
+}
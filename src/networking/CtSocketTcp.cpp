@@ -0,0 +1,364 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtSocketTcp.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "networking/CtSocketTcp.hpp"
+
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <linux/errqueue.h>
+#include <algorithm>
+#include <cerrno>
+
+/**
+ * @brief Maximum number of segments of a CtSharedData sent with one call.
+ * 
+ */
+#define CT_TCP_MAX_SEGMENTS     64u
+
+/**
+ * @brief Size of the control buffer used to read zero-copy completions.
+ * 
+ */
+#define CT_TCP_CONTROL_SIZE     128u
+
+CtSocketTcp::CtSocketTcp(CtNetFamily p_family) {
+    m_socket = -1;
+    m_family = (p_family == CtNetFamily::Ipv4) ? AF_INET : AF_INET6;
+    reset(socket(m_family, SOCK_STREAM | SOCK_CLOEXEC, IPPROTO_TCP));
+    if (m_socket == -1) {
+        throw CtSocketError("Socket cannot be assigned.");
+    }
+    if (m_family == AF_INET6) {
+        setOption(IPPROTO_IPV6, IPV6_V6ONLY, (p_family == CtNetFamily::Ipv6) ? 1 : 0, "IPV6_V6ONLY");
+    }
+}
+
+CtSocketTcp::~CtSocketTcp() {
+    reset(-1);
+}
+
+void CtSocketTcp::setNonBlocking(CtBool p_enable) {
+    CtInt32 s_flags = fcntl(m_socket, F_GETFL, 0);
+    if (s_flags == -1) {
+        throw CtSocketError("Socket flags cannot be read.");
+    }
+    s_flags = p_enable ? (s_flags | O_NONBLOCK) : (s_flags & ~O_NONBLOCK);
+    if (fcntl(m_socket, F_SETFL, s_flags) == -1) {
+        throw CtSocketError("Socket flags cannot be set.");
+    }
+}
+
+void CtSocketTcp::setNoDelay(CtBool p_enable) {
+    setOption(IPPROTO_TCP, TCP_NODELAY, p_enable ? 1 : 0, "TCP_NODELAY");
+}
+
+void CtSocketTcp::setCork(CtBool p_enable) {
+    setOption(IPPROTO_TCP, TCP_CORK, p_enable ? 1 : 0, "TCP_CORK");
+}
+
+void CtSocketTcp::setZeroCopy(CtBool p_enable) {
+    setOption(SOL_SOCKET, SO_ZEROCOPY, p_enable ? 1 : 0, "SO_ZEROCOPY");
+}
+
+void CtSocketTcp::listen(const CtString& p_interfaceName, CtUInt16 p_port, CtInt32 p_backlog) {
+    setOption(SOL_SOCKET, SO_REUSEADDR, 1, "SO_REUSEADDR");
+
+    CtInt32 s_v6only = 1;
+    socklen_t s_length = sizeof(s_v6only);
+    if (m_family == AF_INET6) {
+        getsockopt(m_socket, IPPROTO_IPV6, IPV6_V6ONLY, &s_v6only, &s_length);
+    }
+
+    CtString s_addr;
+    if (s_v6only) {
+        s_addr = CtSocketHelpers::interfaceToAddress(p_interfaceName, m_family);
+    } else {
+        // a dual-stack socket cannot bind to one address of each family, so it is bound to the device
+        if (setsockopt(m_socket, SOL_SOCKET, SO_BINDTODEVICE, p_interfaceName.c_str(), p_interfaceName.size()) == -1) {
+            throw CtSocketBindError(CtString("Socket bind to interface ") + p_interfaceName + CtString(" failed."));
+        }
+        s_addr = "::";
+    }
+
+    CtNetAddress s_address = toSocketFamily(s_addr, p_port);
+    if (bind(m_socket, s_address.getSockAddr(), s_address.getSockLength()) == -1) {
+        throw CtSocketBindError(CtString("Socket bind to port ") + ToCtString(p_port) + CtString(" failed."));
+    }
+    if (::listen(m_socket, p_backlog) == -1) {
+        throw CtSocketBindError(CtString("Socket listen on port ") + ToCtString(p_port) + CtString(" failed."));
+    }
+}
+
+CtBool CtSocketTcp::accept(CtSocketTcp* p_client, CtNetAddress* p_address) {
+    socklen_t s_addressLength = sizeof(sockaddr_in6);
+    CtInt32 s_socket = accept4(m_socket, (p_address != nullptr) ? p_address->getSockAddr() : nullptr,
+                               (p_address != nullptr) ? &s_addressLength : nullptr, SOCK_CLOEXEC);
+    if (s_socket == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return CT_FALSE;
+        }
+        throw CtSocketError("Socket accept failed.");
+    }
+
+    p_client->reset(s_socket);
+    p_client->m_family = m_family;
+    return CT_TRUE;
+}
+
+CtBool CtSocketTcp::connect(CtUInt16 p_port, const CtString& p_addr) {
+    CtNetAddress s_address = toSocketFamily(p_addr, p_port);
+    if (::connect(m_socket, s_address.getSockAddr(), s_address.getSockLength()) == -1) {
+        if (errno == EINPROGRESS) {
+            return CT_FALSE;
+        }
+        throw CtSocketError(CtString("Socket connect to ") + p_addr + CtString(":") + ToCtString(p_port) + CtString(" failed."));
+    }
+    return CT_TRUE;
+}
+
+void CtSocketTcp::finishConnect() {
+    CtInt32 s_error = 0;
+    socklen_t s_length = sizeof(s_error);
+    if (getsockopt(m_socket, SOL_SOCKET, SO_ERROR, &s_error, &s_length) == -1 || s_error != 0) {
+        throw CtSocketError("Socket connect failed.");
+    }
+}
+
+CtUInt16 CtSocketTcp::getPort() {
+    CtNetAddress s_address;
+    socklen_t s_length = sizeof(sockaddr_in6);
+    if (getsockname(m_socket, s_address.getSockAddr(), &s_length) == -1) {
+        throw CtSocketError("Socket address cannot be read.");
+    }
+    return s_address.getPort();
+}
+
+CtBool CtSocketTcp::pollRead() {
+    struct pollfd s_poll = {m_socket, POLLIN, 0};
+    CtInt32 pollResult = poll(&s_poll, 1, CtSocketHelpers::socketTimeout);
+    if (pollResult < 0) {
+        throw CtSocketPollError("Socket polling-in failed.");
+    }
+    return pollResult > 0;
+}
+
+CtBool CtSocketTcp::pollWrite() {
+    struct pollfd s_poll = {m_socket, POLLOUT, 0};
+    CtInt32 pollResult = poll(&s_poll, 1, CtSocketHelpers::socketTimeout);
+    if (pollResult < 0) {
+        throw CtSocketPollError("Socket polling-out failed.");
+    }
+    return pollResult > 0;
+}
+
+CtUInt32 CtSocketTcp::send(const CtRawDataView& p_data) {
+    CtInt32 s_sent = ::send(m_socket, p_data.get(), p_data.size(), MSG_NOSIGNAL);
+    if (s_sent == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return 0;
+        }
+        throw CtSocketWriteError("Sending data via socket failed.");
+    }
+    return s_sent;
+}
+
+CtUInt32 CtSocketTcp::sendGather(const CtRawDataView* p_data, CtUInt32 p_count) {
+    if (m_iovs.size() < p_count) {
+        m_iovs.resize(p_count);
+    }
+    for (CtUInt32 idx = 0; idx < p_count; idx++) {
+        m_iovs[idx].iov_base = (void*)p_data[idx].get();
+        m_iovs[idx].iov_len = p_data[idx].size();
+    }
+
+    struct msghdr s_msg;
+    memset(&s_msg, 0, sizeof(s_msg));
+    s_msg.msg_iov = m_iovs.data();
+    s_msg.msg_iovlen = p_count;
+    return sendMessage(&s_msg, MSG_NOSIGNAL);
+}
+
+CtUInt32 CtSocketTcp::send(const CtSharedData& p_data) {
+    struct iovec s_iov[CT_TCP_MAX_SEGMENTS];
+    if (p_data.segments() > CT_TCP_MAX_SEGMENTS) {
+        throw CtSocketWriteError("Too many segments to send.");
+    }
+    for (CtUInt32 idx = 0; idx < p_data.segments(); idx++) {
+        CtRawDataView s_segment = p_data.segment(idx);
+        s_iov[idx].iov_base = (void*)s_segment.get();
+        s_iov[idx].iov_len = s_segment.size();
+    }
+
+    struct msghdr s_msg;
+    memset(&s_msg, 0, sizeof(s_msg));
+    s_msg.msg_iov = s_iov;
+    s_msg.msg_iovlen = p_data.segments();
+    return sendMessage(&s_msg, MSG_NOSIGNAL);
+}
+
+CtUInt32 CtSocketTcp::sendZeroCopy(const CtRawDataView& p_data) {
+    CtInt32 s_sent = ::send(m_socket, p_data.get(), p_data.size(), MSG_NOSIGNAL | MSG_ZEROCOPY);
+    if (s_sent == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+            return 0;
+        }
+        throw CtSocketWriteError("Sending data via socket failed.");
+    }
+    m_zcSent++;
+    return s_sent;
+}
+
+CtUInt32 CtSocketTcp::getZeroCopyPending() {
+    while (m_zcDone != m_zcSent) {
+        CtUInt8 s_control[CT_TCP_CONTROL_SIZE];
+        struct msghdr s_msg;
+        memset(&s_msg, 0, sizeof(s_msg));
+        s_msg.msg_control = s_control;
+        s_msg.msg_controllen = sizeof(s_control);
+        if (recvmsg(m_socket, &s_msg, MSG_ERRQUEUE | MSG_DONTWAIT) == -1) {
+            break;
+        }
+        for (struct cmsghdr* s_cmsg = CMSG_FIRSTHDR(&s_msg); s_cmsg != nullptr; s_cmsg = CMSG_NXTHDR(&s_msg, s_cmsg)) {
+            // IPv6 and dual-stack sockets report the completions with the IPv6 level
+            if (!(s_cmsg->cmsg_level == SOL_IP && s_cmsg->cmsg_type == IP_RECVERR) &&
+                !(s_cmsg->cmsg_level == SOL_IPV6 && s_cmsg->cmsg_type == IPV6_RECVERR)) {
+                continue;
+            }
+            struct sock_extended_err s_error;
+            memcpy(&s_error, CMSG_DATA(s_cmsg), sizeof(s_error));
+            if (s_error.ee_errno == 0 && s_error.ee_origin == SO_EE_ORIGIN_ZEROCOPY) {
+                m_zcDone += s_error.ee_data - s_error.ee_info + 1;
+            }
+        }
+    }
+    return m_zcSent - m_zcDone;
+}
+
+CtUInt32 CtSocketTcp::receive(CtRawData* p_message) {
+    CtInt32 s_received = recv(m_socket, p_message->get(), p_message->maxSize(), 0);
+    if (s_received == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            p_message->resize(0);
+            return 0;
+        }
+        throw CtSocketReadError("Receiving data via socket failed.");
+    }
+    m_closed = (s_received == 0 && p_message->maxSize() > 0);
+    p_message->resize(s_received);
+    return s_received;
+}
+
+CtUInt32 CtSocketTcp::receiveScatter(CtRawData* p_messages, CtUInt32 p_count) {
+    if (m_iovs.size() < p_count) {
+        m_iovs.resize(p_count);
+    }
+    CtUInt32 s_capacity = 0;
+    for (CtUInt32 idx = 0; idx < p_count; idx++) {
+        m_iovs[idx].iov_base = p_messages[idx].get();
+        m_iovs[idx].iov_len = p_messages[idx].maxSize();
+        s_capacity += p_messages[idx].maxSize();
+    }
+
+    CtInt32 s_received = readv(m_socket, m_iovs.data(), p_count);
+    if (s_received == -1) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            throw CtSocketReadError("Receiving data via socket failed.");
+        }
+        s_received = 0;
+    } else {
+        m_closed = (s_received == 0 && s_capacity > 0);
+    }
+
+    CtUInt32 s_left = s_received;
+    for (CtUInt32 idx = 0; idx < p_count; idx++) {
+        CtUInt32 s_size = std::min<CtUInt32>(s_left, p_messages[idx].maxSize());
+        p_messages[idx].resize(s_size);
+        s_left -= s_size;
+    }
+    return s_received;
+}
+
+CtBool CtSocketTcp::isClosed() {
+    return m_closed;
+}
+
+void CtSocketTcp::shutdown() {
+    ::shutdown(m_socket, SHUT_WR);
+}
+
+CtInt32 CtSocketTcp::getFd() {
+    return m_socket;
+}
+
+void CtSocketTcp::setOption(CtInt32 p_level, CtInt32 p_option, CtInt32 p_value, const CtString& p_name) {
+    if (setsockopt(m_socket, p_level, p_option, &p_value, sizeof(p_value)) == -1) {
+        throw CtSocketError("Socket option " + p_name + " cannot be set.");
+    }
+}
+
+CtNetAddress CtSocketTcp::toSocketFamily(const CtString& p_addr, CtUInt16 p_port) {
+    CtNetAddress s_address;
+    try {
+        s_address = CtNetAddress(p_addr, p_port);
+    } catch (const CtTypeParseError&) {
+        throw CtSocketError("Invalid address given.");
+    }
+    if (m_family == AF_INET6) {
+        return s_address.toIpv6();
+    }
+    if (s_address.getFamily() == AF_INET6) {
+        throw CtSocketError("IPv6 address used with an IPv4 socket.");
+    }
+    return s_address;
+}
+
+void CtSocketTcp::reset(CtInt32 p_socket) {
+    if (m_socket != -1) {
+        close(m_socket);
+    }
+    m_socket = p_socket;
+    m_closed = CT_FALSE;
+    m_zcSent = 0;
+    m_zcDone = 0;
+}
+
+CtUInt32 CtSocketTcp::sendMessage(struct msghdr* p_msg, CtInt32 p_flags) {
+    CtInt32 s_sent = sendmsg(m_socket, p_msg, p_flags);
+    if (s_sent == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return 0;
+        }
+        throw CtSocketWriteError("Sending data via socket failed.");
+    }
+    return s_sent;
+}
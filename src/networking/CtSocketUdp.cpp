@@ -31,13 +31,42 @@ SOFTWARE.
 
 #include "networking/CtSocketUdp.hpp"
 
-CtSocketUdp::CtSocketUdp() {
-    m_addrType = AF_INET;
+#include <sys/uio.h>
+#include <netinet/udp.h>
+#include <net/if.h>
+#include <algorithm>
+#include <cerrno>
+
+/**
+ * @brief Maximum number of segments of a CtSharedData sent as one datagram.
+ * 
+ */
+#define CT_UDP_MAX_SEGMENTS     64u
+
+/**
+ * @brief Maximum number of datagrams passed to the kernel with one segmented send.
+ * 
+ */
+#define CT_UDP_GSO_SEGMENTS     64u
+
+/**
+ * @brief Maximum number of bytes passed to the kernel with one segmented send.
+ *      The payload of a UDP/IPv4 datagram is limited to 65507 bytes.
+ * 
+ */
+#define CT_UDP_GSO_BYTES        65000u
+
+CtSocketUdp::CtSocketUdp(CtNetFamily p_family) {
+    m_addrType = (p_family == CtNetFamily::Ipv4) ? AF_INET : AF_INET6;
     m_port = 0;
+    m_drops = 0;
     m_socket = socket(m_addrType, SOCK_DGRAM, IPPROTO_UDP);
     if (m_socket == -1) {
         throw CtSocketError("Socket cannot be assigned.");
     }
+    if (m_addrType == AF_INET6) {
+        setOption(IPPROTO_IPV6, IPV6_V6ONLY, (p_family == CtNetFamily::Ipv6) ? 1 : 0, "IPV6_V6ONLY");
+    }
     m_pollin_sockets[0].fd = m_socket;
     m_pollin_sockets[0].events = POLLIN;
 
@@ -49,22 +78,139 @@ CtSocketUdp::~CtSocketUdp() {
     close(m_socket);
 }
 
+void CtSocketUdp::setReusePort(CtBool p_enable) {
+    setOption(SOL_SOCKET, SO_REUSEPORT, p_enable ? 1 : 0, "SO_REUSEPORT");
+}
+
+void CtSocketUdp::setReceiveBuffer(CtUInt32 p_size, CtBool p_force) {
+    setOption(SOL_SOCKET, p_force ? SO_RCVBUFFORCE : SO_RCVBUF, p_size, p_force ? "SO_RCVBUFFORCE" : "SO_RCVBUF");
+}
+
+CtUInt32 CtSocketUdp::getReceiveBuffer() {
+    return getOption(SOL_SOCKET, SO_RCVBUF);
+}
+
+void CtSocketUdp::setSendBuffer(CtUInt32 p_size, CtBool p_force) {
+    setOption(SOL_SOCKET, p_force ? SO_SNDBUFFORCE : SO_SNDBUF, p_size, p_force ? "SO_SNDBUFFORCE" : "SO_SNDBUF");
+}
+
+CtUInt32 CtSocketUdp::getSendBuffer() {
+    return getOption(SOL_SOCKET, SO_SNDBUF);
+}
+
+void CtSocketUdp::setBusyPoll(CtUInt32 p_usec) {
+    setOption(SOL_SOCKET, SO_BUSY_POLL, p_usec, "SO_BUSY_POLL");
+}
+
+void CtSocketUdp::setTos(CtUInt8 p_tos) {
+    if (m_addrType == AF_INET) {
+        setOption(IPPROTO_IP, IP_TOS, p_tos, "IP_TOS");
+        return;
+    }
+    setOption(IPPROTO_IPV6, IPV6_TCLASS, p_tos, "IPV6_TCLASS");
+    if (getOption(IPPROTO_IPV6, IPV6_V6ONLY) == 0) {
+        // IPv4 peers of a dual-stack socket get the type of service from IP_TOS
+        setOption(IPPROTO_IP, IP_TOS, p_tos, "IP_TOS");
+    }
+}
+
+void CtSocketUdp::setTimestamps(CtBool p_enable) {
+    setOption(SOL_SOCKET, SO_TIMESTAMPNS, p_enable ? 1 : 0, "SO_TIMESTAMPNS");
+}
+
+void CtSocketUdp::setDropCounter(CtBool p_enable) {
+    setOption(SOL_SOCKET, SO_RXQ_OVFL, p_enable ? 1 : 0, "SO_RXQ_OVFL");
+}
+
+CtUInt32 CtSocketUdp::getDrops() {
+    return m_drops;
+}
+
 void CtSocketUdp::setSub(const CtString& p_interfaceName, CtUInt16 p_port) {
-    memset(&m_subAddress, 0, sizeof(m_subAddress));
-    m_subAddress.sin_family = m_addrType;
-    m_subAddress.sin_addr.s_addr = CtSocketHelpers::getAddressAsUInt(CtSocketHelpers::interfaceToAddress(p_interfaceName));
-    m_subAddress.sin_port = htons(p_port);
+    if (m_addrType == AF_INET) {
+        setSub(CtNetAddress(CtSocketHelpers::interfaceToAddress(p_interfaceName), p_port));
+        return;
+    }
+
+    CtInt32 s_v6only = 0;
+    socklen_t s_length = sizeof(s_v6only);
+    getsockopt(m_socket, IPPROTO_IPV6, IPV6_V6ONLY, &s_v6only, &s_length);
+    if (s_v6only) {
+        setSub(CtNetAddress(CtSocketHelpers::interfaceToAddress(p_interfaceName, AF_INET6), p_port));
+        return;
+    }
 
-    if (bind(m_socket, (struct sockaddr*)&m_subAddress, sizeof(m_subAddress)) == -1) {
-        throw CtSocketBindError(CtString("Socket bind to port ") + ToCtString(p_port) + CtString(" failed."));
+    // a dual-stack socket cannot bind to one address of each family, so it is bound to the device
+    if (setsockopt(m_socket, SOL_SOCKET, SO_BINDTODEVICE, p_interfaceName.c_str(), p_interfaceName.size()) == -1) {
+        throw CtSocketBindError(CtString("Socket bind to interface ") + p_interfaceName + CtString(" failed."));
+    }
+    setSub(CtNetAddress("::", p_port));
+}
+
+void CtSocketUdp::setSub(const CtNetAddress& p_address) {
+    m_subAddress = toSocketFamily(p_address);
+    if (bind(m_socket, m_subAddress.getSockAddr(), m_subAddress.getSockLength()) == -1) {
+        throw CtSocketBindError(CtString("Socket bind to port ") + ToCtString(p_address.getPort()) + CtString(" failed."));
     }
 }
 
 void CtSocketUdp::setPub(CtUInt16 p_port, const CtString& p_addr) {
-    memset(&m_pubAddress, 0, sizeof(m_pubAddress));
-    m_pubAddress.sin_family = m_addrType;
-    m_pubAddress.sin_addr.s_addr = CtSocketHelpers::getAddressAsUInt(p_addr);
-    m_pubAddress.sin_port = htons(p_port);
+    try {
+        setPub(CtNetAddress(p_addr, p_port));
+    } catch (const CtTypeParseError&) {
+        throw CtSocketError("Invalid address given.");
+    }
+}
+
+void CtSocketUdp::setPub(const CtNetAddress& p_address) {
+    m_pubAddress = toSocketFamily(p_address);
+}
+
+void CtSocketUdp::joinGroup(const CtString& p_group, const CtString& p_interfaceName) {
+    setMembership(MCAST_JOIN_GROUP, p_group, "", p_interfaceName);
+}
+
+void CtSocketUdp::leaveGroup(const CtString& p_group, const CtString& p_interfaceName) {
+    setMembership(MCAST_LEAVE_GROUP, p_group, "", p_interfaceName);
+}
+
+void CtSocketUdp::joinSourceGroup(const CtString& p_group, const CtString& p_source, const CtString& p_interfaceName) {
+    setMembership(MCAST_JOIN_SOURCE_GROUP, p_group, p_source, p_interfaceName);
+}
+
+void CtSocketUdp::leaveSourceGroup(const CtString& p_group, const CtString& p_source, const CtString& p_interfaceName) {
+    setMembership(MCAST_LEAVE_SOURCE_GROUP, p_group, p_source, p_interfaceName);
+}
+
+void CtSocketUdp::setMulticastLoop(CtBool p_enable) {
+    if (m_addrType == AF_INET6) {
+        setOption(IPPROTO_IPV6, IPV6_MULTICAST_LOOP, p_enable ? 1 : 0, "IPV6_MULTICAST_LOOP");
+    }
+    setOption(IPPROTO_IP, IP_MULTICAST_LOOP, p_enable ? 1 : 0, "IP_MULTICAST_LOOP");
+}
+
+void CtSocketUdp::setMulticastTtl(CtUInt8 p_ttl) {
+    if (m_addrType == AF_INET6) {
+        setOption(IPPROTO_IPV6, IPV6_MULTICAST_HOPS, p_ttl, "IPV6_MULTICAST_HOPS");
+    }
+    setOption(IPPROTO_IP, IP_MULTICAST_TTL, p_ttl, "IP_MULTICAST_TTL");
+}
+
+void CtSocketUdp::setMulticastInterface(const CtString& p_interfaceName) {
+    CtUInt32 s_index = if_nametoindex(p_interfaceName.c_str());
+    if (s_index == 0) {
+        throw CtSocketError("Not valid interface found.");
+    }
+    if (m_addrType == AF_INET6) {
+        setOption(IPPROTO_IPV6, IPV6_MULTICAST_IF, s_index, "IPV6_MULTICAST_IF");
+    }
+
+    struct ip_mreqn s_request;
+    memset(&s_request, 0, sizeof(s_request));
+    s_request.imr_ifindex = s_index;
+    if (setsockopt(m_socket, IPPROTO_IP, IP_MULTICAST_IF, &s_request, sizeof(s_request)) == -1) {
+        throw CtSocketError("Socket option IP_MULTICAST_IF cannot be set.");
+    }
 }
 
 CtBool CtSocketUdp::pollRead() {
@@ -91,35 +237,425 @@ CtBool CtSocketUdp::pollWrite() {
 }
 
 void CtSocketUdp::send(CtUInt8* p_data, CtUInt32 p_size) {
-    if (sendto(m_socket, p_data, p_size, MSG_DONTWAIT, (struct sockaddr*)&m_pubAddress, sizeof(m_pubAddress)) == -1) {
+    if (sendto(m_socket, p_data, p_size, MSG_DONTWAIT, m_pubAddress.getSockAddr(), m_pubAddress.getSockLength()) == -1) {
         throw CtSocketWriteError("Sending data via socket failed.");
     }
 }
 
 void CtSocketUdp::send(CtRawData& p_message) {
-    send(p_message.get(), p_message.size());
+    send(p_message.view());
 }
 
-void CtSocketUdp::receive(CtUInt8* p_data, CtUInt32 p_size, CtNetAddress* p_client) {
-    sockaddr_in s_clientAddress_in;
-    socklen_t s_clientAddressLength = sizeof(s_clientAddress_in);
-    CtInt32 bytesRead = recvfrom(m_socket, p_data, p_size, MSG_DONTWAIT, (struct sockaddr*)&s_clientAddress_in, &s_clientAddressLength);
+void CtSocketUdp::send(const CtRawDataView& p_data) {
+    if (sendto(m_socket, p_data.get(), p_data.size(), MSG_DONTWAIT, m_pubAddress.getSockAddr(), m_pubAddress.getSockLength()) == -1) {
+        throw CtSocketWriteError("Sending data via socket failed.");
+    }
+}
+
+void CtSocketUdp::send(const CtSharedData& p_data) {
+    struct iovec s_iov[CT_UDP_MAX_SEGMENTS];
+    if (p_data.segments() > CT_UDP_MAX_SEGMENTS) {
+        throw CtSocketWriteError("Too many segments to send.");
+    }
+    for (CtUInt32 idx = 0; idx < p_data.segments(); idx++) {
+        CtRawDataView s_segment = p_data.segment(idx);
+        s_iov[idx].iov_base = (void*)s_segment.get();
+        s_iov[idx].iov_len = s_segment.size();
+    }
+
+    struct msghdr s_msg;
+    memset(&s_msg, 0, sizeof(s_msg));
+    s_msg.msg_name = m_pubAddress.getSockAddr();
+    s_msg.msg_namelen = m_pubAddress.getSockLength();
+    s_msg.msg_iov = s_iov;
+    s_msg.msg_iovlen = p_data.segments();
+    if (sendmsg(m_socket, &s_msg, MSG_DONTWAIT) == -1) {
+        throw CtSocketWriteError("Sending data via socket failed.");
+    }
+}
+
+CtUInt32 CtSocketUdp::receive(CtUInt8* p_data, CtUInt32 p_size, CtNetAddress* p_client) {
+    socklen_t s_clientAddressLength = sizeof(sockaddr_in6);
+    CtInt32 bytesRead = recvfrom(m_socket, p_data, p_size, MSG_DONTWAIT,
+                                 (p_client != nullptr) ? p_client->getSockAddr() : nullptr,
+                                 (p_client != nullptr) ? &s_clientAddressLength : nullptr);
 
     if (bytesRead == -1) {
         throw CtSocketReadError("Receiving data via socket failed.");
     }
 
+    if ((CtUInt32)bytesRead < p_size) {
+        p_data[bytesRead] = '\0';
+    }
+    return bytesRead;
+}
+
+CtUInt32 CtSocketUdp::receive(CtRawData* p_message, CtNetAddress* p_client) {
+    socklen_t s_clientAddressLength = sizeof(sockaddr_in6);
+    CtInt32 bytesRead = recvfrom(m_socket, p_message->get(), p_message->maxSize(), MSG_DONTWAIT,
+                                 (p_client != nullptr) ? p_client->getSockAddr() : nullptr,
+                                 (p_client != nullptr) ? &s_clientAddressLength : nullptr);
+
+    if (bytesRead == -1) {
+        throw CtSocketReadError("Receiving data via socket failed.");
+    }
+
+    p_message->resize(bytesRead);
+    return bytesRead;
+}
+
+CtUInt32 CtSocketUdp::receive(CtRawData* p_message, CtNetAddress* p_client, CtUdpRxInfo* p_info) {
+    union {
+        CtUInt8 buffer[CT_UDP_CONTROL_SIZE];
+        struct cmsghdr align;
+    } s_control;
+    struct iovec s_iov;
+    s_iov.iov_base = p_message->get();
+    s_iov.iov_len = p_message->maxSize();
+
+    struct msghdr s_msg;
+    memset(&s_msg, 0, sizeof(s_msg));
     if (p_client != nullptr) {
-        p_client->addr = (CtString)CtSocketHelpers::getAddressAsString(*(CtUInt32*)(&s_clientAddress_in.sin_addr));
-        p_client->port = s_clientAddress_in.sin_port;
+        s_msg.msg_name = p_client->getSockAddr();
+        s_msg.msg_namelen = sizeof(sockaddr_in6);
+    }
+    s_msg.msg_iov = &s_iov;
+    s_msg.msg_iovlen = 1;
+    if (p_info != nullptr) {
+        s_msg.msg_control = s_control.buffer;
+        s_msg.msg_controllen = sizeof(s_control.buffer);
+    }
+
+    CtInt32 bytesRead = recvmsg(m_socket, &s_msg, MSG_DONTWAIT);
+    if (bytesRead == -1) {
+        throw CtSocketReadError("Receiving data via socket failed.");
+    }
+
+    p_message->resize(std::min<CtUInt32>(bytesRead, p_message->maxSize()));
+    if (p_info != nullptr) {
+        parseControl(&s_msg, p_info);
+    }
+    return bytesRead;
+}
+
+CtUInt32 CtSocketUdp::receiveBatch(CtRawData* p_messages, CtUInt32 p_count, CtNetAddress* p_clients, CtUdpRxInfo* p_infos) {
+    reserveBatch(p_count);
+    if (p_infos != nullptr && m_control.size() < p_count * CT_UDP_CONTROL_SIZE) {
+        m_control.resize(p_count * CT_UDP_CONTROL_SIZE);
+    }
+    for (CtUInt32 idx = 0; idx < p_count; idx++) {
+        m_iovs[idx].iov_base = p_messages[idx].get();
+        m_iovs[idx].iov_len = p_messages[idx].maxSize();
+        memset(&m_msgs[idx].msg_hdr, 0, sizeof(m_msgs[idx].msg_hdr));
+        m_msgs[idx].msg_hdr.msg_iov = &m_iovs[idx];
+        m_msgs[idx].msg_hdr.msg_iovlen = 1;
+        if (p_clients != nullptr) {
+            m_msgs[idx].msg_hdr.msg_name = p_clients[idx].getSockAddr();
+            m_msgs[idx].msg_hdr.msg_namelen = sizeof(sockaddr_in6);
+        }
+        if (p_infos != nullptr) {
+            m_msgs[idx].msg_hdr.msg_control = &m_control[idx * CT_UDP_CONTROL_SIZE];
+            m_msgs[idx].msg_hdr.msg_controllen = CT_UDP_CONTROL_SIZE;
+        }
+    }
+
+    CtInt32 s_received = recvmmsg(m_socket, m_msgs.data(), p_count, MSG_DONTWAIT, nullptr);
+    if (s_received == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return 0;
+        }
+        throw CtSocketReadError("Receiving data via socket failed.");
     }
 
-    p_data[bytesRead] = '\0';
+    for (CtInt32 idx = 0; idx < s_received; idx++) {
+        p_messages[idx].resize(std::min<CtUInt32>(m_msgs[idx].msg_len, p_messages[idx].maxSize()));
+        if (p_infos != nullptr) {
+            parseControl(&m_msgs[idx].msg_hdr, &p_infos[idx]);
+        }
+    }
+    return s_received;
+}
+
+CtUInt32 CtSocketUdp::sendBatch(const CtRawDataView* p_messages, CtUInt32 p_count) {
+    reserveBatch(p_count);
+    for (CtUInt32 idx = 0; idx < p_count; idx++) {
+        m_iovs[idx].iov_base = (void*)p_messages[idx].get();
+        m_iovs[idx].iov_len = p_messages[idx].size();
+    }
+    return sendPrepared(p_count);
+}
+
+CtUInt32 CtSocketUdp::sendBatch(CtRawData* p_messages, CtUInt32 p_count) {
+    reserveBatch(p_count);
+    for (CtUInt32 idx = 0; idx < p_count; idx++) {
+        m_iovs[idx].iov_base = p_messages[idx].get();
+        m_iovs[idx].iov_len = p_messages[idx].size();
+    }
+    return sendPrepared(p_count);
 }
 
-void CtSocketUdp::receive(CtRawData* p_message, CtNetAddress* p_client) {
-    CtUInt8* s_buffer = new CtUInt8[p_message->maxSize()];
-    receive(s_buffer, p_message->maxSize(), p_client);
-    p_message->clone(s_buffer, p_message->maxSize());
-    delete[] s_buffer;
+CtUInt32 CtSocketUdp::sendSegmented(const CtRawDataView& p_data, CtUInt16 p_segmentSize) {
+    if (p_segmentSize == 0) {
+        throw CtSocketWriteError("Segment size cannot be zero.");
+    }
+    reserveBatch(1);
+    CtUInt32 s_chunk = std::max<CtUInt32>(1, std::min<CtUInt32>(CT_UDP_GSO_SEGMENTS, CT_UDP_GSO_BYTES / p_segmentSize)) * p_segmentSize;
+    CtUInt32 s_sent = 0;
+    for (CtUInt32 s_offset = 0; s_offset < p_data.size(); s_offset += s_chunk) {
+        CtUInt32 s_size = std::min<CtUInt32>(s_chunk, p_data.size() - s_offset);
+        m_iovs[0].iov_base = (void*)(p_data.get() + s_offset);
+        m_iovs[0].iov_len = s_size;
+        if (!sendGathered(1, p_segmentSize)) {
+            break;
+        }
+        s_sent += (s_size + p_segmentSize - 1) / p_segmentSize;
+    }
+    return s_sent;
+}
+
+CtUInt32 CtSocketUdp::sendSegmented(const CtRawDataView* p_messages, CtUInt32 p_count) {
+    reserveBatch(std::min<CtUInt32>(p_count, CT_UDP_GSO_SEGMENTS));
+    CtUInt32 s_sent = 0;
+    while (s_sent < p_count) {
+        CtUInt32 s_segmentSize = p_messages[s_sent].size();
+        CtUInt32 s_group = 0;
+        CtUInt32 s_bytes = 0;
+        while (s_sent + s_group < p_count && s_group < CT_UDP_GSO_SEGMENTS) {
+            const CtRawDataView& s_message = p_messages[s_sent + s_group];
+            if (s_group > 0 && (s_message.size() > s_segmentSize || s_bytes + s_message.size() > CT_UDP_GSO_BYTES)) {
+                break;
+            }
+            m_iovs[s_group].iov_base = (void*)s_message.get();
+            m_iovs[s_group].iov_len = s_message.size();
+            s_bytes += s_message.size();
+            s_group++;
+            if (s_segmentSize == 0 || s_message.size() < s_segmentSize) {
+                break;
+            }
+        }
+        if (!sendGathered(s_group, (s_group > 1) ? s_segmentSize : 0)) {
+            break;
+        }
+        s_sent += s_group;
+    }
+    return s_sent;
+}
+
+void CtSocketUdp::setGro(CtBool p_enable) {
+    setOption(SOL_UDP, UDP_GRO, p_enable ? 1 : 0, "UDP_GRO");
+}
+
+CtUInt32 CtSocketUdp::receiveSegmented(CtRawData* p_buffer, CtVector<CtRawDataView>* p_segments, CtNetAddress* p_client) {
+    union {
+        CtUInt8 buffer[CMSG_SPACE(sizeof(CtInt32))];
+        struct cmsghdr align;
+    } s_control;
+    struct iovec s_iov;
+    s_iov.iov_base = p_buffer->get();
+    s_iov.iov_len = p_buffer->maxSize();
+
+    struct msghdr s_msg;
+    memset(&s_msg, 0, sizeof(s_msg));
+    if (p_client != nullptr) {
+        s_msg.msg_name = p_client->getSockAddr();
+        s_msg.msg_namelen = sizeof(sockaddr_in6);
+    }
+    s_msg.msg_iov = &s_iov;
+    s_msg.msg_iovlen = 1;
+    s_msg.msg_control = s_control.buffer;
+    s_msg.msg_controllen = sizeof(s_control.buffer);
+
+    p_segments->clear();
+    CtInt32 s_received = recvmsg(m_socket, &s_msg, MSG_DONTWAIT);
+    if (s_received == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return 0;
+        }
+        throw CtSocketReadError("Receiving data via socket failed.");
+    }
+    p_buffer->resize(std::min<CtUInt32>(s_received, p_buffer->maxSize()));
+
+    CtUInt32 s_segmentSize = p_buffer->size();
+    for (struct cmsghdr* s_cmsg = CMSG_FIRSTHDR(&s_msg); s_cmsg != nullptr; s_cmsg = CMSG_NXTHDR(&s_msg, s_cmsg)) {
+        if (s_cmsg->cmsg_level == SOL_UDP && s_cmsg->cmsg_type == UDP_GRO) {
+            CtInt32 s_gso;
+            memcpy(&s_gso, CMSG_DATA(s_cmsg), sizeof(s_gso));
+            if (s_gso > 0) {
+                s_segmentSize = s_gso;
+            }
+        }
+    }
+
+    if (s_segmentSize == 0) {
+        p_segments->emplace_back(p_buffer->get(), 0);
+    }
+    for (CtUInt32 s_offset = 0; s_offset < p_buffer->size(); s_offset += s_segmentSize) {
+        p_segments->emplace_back(p_buffer->get() + s_offset, std::min<CtUInt32>(s_segmentSize, p_buffer->size() - s_offset));
+    }
+    return p_segments->size();
+}
+
+CtInt32 CtSocketUdp::getFd() {
+    return m_socket;
+}
+
+void CtSocketUdp::reserveBatch(CtUInt32 p_count) {
+    if (m_msgs.size() < p_count) {
+        m_msgs.resize(p_count);
+        m_iovs.resize(p_count);
+    }
+}
+
+CtUInt32 CtSocketUdp::sendPrepared(CtUInt32 p_count) {
+    for (CtUInt32 idx = 0; idx < p_count; idx++) {
+        memset(&m_msgs[idx].msg_hdr, 0, sizeof(m_msgs[idx].msg_hdr));
+        m_msgs[idx].msg_hdr.msg_name = m_pubAddress.getSockAddr();
+        m_msgs[idx].msg_hdr.msg_namelen = m_pubAddress.getSockLength();
+        m_msgs[idx].msg_hdr.msg_iov = &m_iovs[idx];
+        m_msgs[idx].msg_hdr.msg_iovlen = 1;
+    }
+
+    CtUInt32 s_sent = 0;
+    while (s_sent < p_count) {
+        CtInt32 s_res = sendmmsg(m_socket, &m_msgs[s_sent], p_count - s_sent, MSG_DONTWAIT);
+        if (s_res == -1) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+            throw CtSocketWriteError("Sending data via socket failed.");
+        }
+        s_sent += s_res;
+    }
+    return s_sent;
+}
+
+CtBool CtSocketUdp::sendGathered(CtUInt32 p_count, CtUInt16 p_segmentSize) {
+    union {
+        CtUInt8 buffer[CMSG_SPACE(sizeof(CtUInt16))];
+        struct cmsghdr align;
+    } s_control;
+
+    struct msghdr s_msg;
+    memset(&s_msg, 0, sizeof(s_msg));
+    s_msg.msg_name = m_pubAddress.getSockAddr();
+    s_msg.msg_namelen = m_pubAddress.getSockLength();
+    s_msg.msg_iov = m_iovs.data();
+    s_msg.msg_iovlen = p_count;
+    if (p_segmentSize > 0) {
+        s_msg.msg_control = s_control.buffer;
+        s_msg.msg_controllen = sizeof(s_control.buffer);
+        struct cmsghdr* s_cmsg = CMSG_FIRSTHDR(&s_msg);
+        s_cmsg->cmsg_level = SOL_UDP;
+        s_cmsg->cmsg_type = UDP_SEGMENT;
+        s_cmsg->cmsg_len = CMSG_LEN(sizeof(CtUInt16));
+        memcpy(CMSG_DATA(s_cmsg), &p_segmentSize, sizeof(p_segmentSize));
+    }
+
+    if (sendmsg(m_socket, &s_msg, MSG_DONTWAIT) == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return CT_FALSE;
+        }
+        throw CtSocketWriteError("Sending data via socket failed.");
+    }
+    return CT_TRUE;
+}
+
+void CtSocketUdp::setOption(CtInt32 p_level, CtInt32 p_option, CtInt32 p_value, const CtString& p_name) {
+    if (setsockopt(m_socket, p_level, p_option, &p_value, sizeof(p_value)) == -1) {
+        throw CtSocketError("Socket option " + p_name + " cannot be set.");
+    }
+}
+
+CtInt32 CtSocketUdp::getOption(CtInt32 p_level, CtInt32 p_option) {
+    CtInt32 s_value = 0;
+    socklen_t s_length = sizeof(s_value);
+    if (getsockopt(m_socket, p_level, p_option, &s_value, &s_length) == -1) {
+        throw CtSocketError("Socket option cannot be read.");
+    }
+    return s_value;
+}
+
+void CtSocketUdp::parseControl(struct msghdr* p_msg, CtUdpRxInfo* p_info) {
+    p_info->timestamp = 0;
+    p_info->drops = m_drops;
+    for (struct cmsghdr* s_cmsg = CMSG_FIRSTHDR(p_msg); s_cmsg != nullptr; s_cmsg = CMSG_NXTHDR(p_msg, s_cmsg)) {
+        if (s_cmsg->cmsg_level != SOL_SOCKET) {
+            continue;
+        }
+        if (s_cmsg->cmsg_type == SO_TIMESTAMPNS) {
+            struct timespec s_time;
+            memcpy(&s_time, CMSG_DATA(s_cmsg), sizeof(s_time));
+            p_info->timestamp = (CtUInt64)s_time.tv_sec * 1000000000ull + s_time.tv_nsec;
+        } else if (s_cmsg->cmsg_type == SO_RXQ_OVFL) {
+            memcpy(&m_drops, CMSG_DATA(s_cmsg), sizeof(m_drops));
+            p_info->drops = m_drops;
+        }
+    }
+}
+
+void CtSocketUdp::setMembership(CtInt32 p_option, const CtString& p_group, const CtString& p_source, const CtString& p_interfaceName) {
+    CtNetAddress s_group;
+    CtNetAddress s_source;
+    try {
+        s_group = CtNetAddress(p_group, 0);
+        if (!p_source.empty()) {
+            s_source = CtNetAddress(p_source, 0);
+        }
+    } catch (const CtTypeParseError&) {
+        throw CtSocketError("Invalid address given.");
+    }
+    if (m_addrType == AF_INET && s_group.getFamily() == AF_INET6) {
+        throw CtSocketError("IPv6 group used with an IPv4 socket.");
+    }
+    if (!p_source.empty() && s_source.getFamily() != s_group.getFamily()) {
+        throw CtSocketError("Source and group address families differ.");
+    }
+
+    CtUInt32 s_index = 0;
+    if (!p_interfaceName.empty()) {
+        s_index = if_nametoindex(p_interfaceName.c_str());
+        if (s_index == 0) {
+            throw CtSocketError("Not valid interface found.");
+        }
+    }
+
+    // deliver only the groups joined by this socket, not all groups joined on the host
+    if (p_option == MCAST_JOIN_GROUP || p_option == MCAST_JOIN_SOURCE_GROUP) {
+        if (s_group.getFamily() == AF_INET6) {
+            setOption(IPPROTO_IPV6, IPV6_MULTICAST_ALL, 0, "IPV6_MULTICAST_ALL");
+        } else {
+            setOption(IPPROTO_IP, IP_MULTICAST_ALL, 0, "IP_MULTICAST_ALL");
+        }
+    }
+
+    // IPv4 groups are handled by the IPv4 layer, also for dual-stack sockets
+    CtInt32 s_level = (s_group.getFamily() == AF_INET) ? IPPROTO_IP : IPPROTO_IPV6;
+    CtInt32 s_result;
+    if (p_source.empty()) {
+        struct group_req s_request;
+        memset(&s_request, 0, sizeof(s_request));
+        s_request.gr_interface = s_index;
+        memcpy(&s_request.gr_group, s_group.getSockAddr(), s_group.getSockLength());
+        s_result = setsockopt(m_socket, s_level, p_option, &s_request, sizeof(s_request));
+    } else {
+        struct group_source_req s_request;
+        memset(&s_request, 0, sizeof(s_request));
+        s_request.gsr_interface = s_index;
+        memcpy(&s_request.gsr_group, s_group.getSockAddr(), s_group.getSockLength());
+        memcpy(&s_request.gsr_source, s_source.getSockAddr(), s_source.getSockLength());
+        s_result = setsockopt(m_socket, s_level, p_option, &s_request, sizeof(s_request));
+    }
+    if (s_result == -1) {
+        throw CtSocketError(CtString("Membership of multicast group ") + p_group + CtString(" cannot be changed."));
+    }
+}
+
+CtNetAddress CtSocketUdp::toSocketFamily(const CtNetAddress& p_address) {
+    if (m_addrType == AF_INET6) {
+        return p_address.toIpv6();
+    }
+    if (p_address.getFamily() == AF_INET6) {
+        throw CtSocketError("IPv6 address used with an IPv4 socket.");
+    }
+    return p_address;
 }
@@ -0,0 +1,171 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtSocketUdpSharded.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "networking/CtSocketUdpSharded.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+#include <linux/filter.h>
+#include <thread>
+
+CtSocketUdpSharded::CtSocketUdpSharded(CtUInt32 p_shards) : m_steering(CT_FALSE), m_running(CT_FALSE) {
+    if (p_shards == 0) {
+        p_shards = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (CtUInt32 idx = 0; idx < p_shards; idx++) {
+        m_shards.push_back(std::make_unique<CtShard>());
+        m_shards.back()->received = 0;
+        m_shards.back()->errors = 0;
+        m_shards.back()->socket.setReusePort(CT_TRUE);
+    }
+}
+
+CtSocketUdpSharded::~CtSocketUdpSharded() {
+    stopShards();
+}
+
+void CtSocketUdpSharded::setCpuSteering(CtBool p_enable) {
+    m_steering = p_enable;
+}
+
+void CtSocketUdpSharded::setSub(const CtString& p_interfaceName, CtUInt16 p_port) {
+    for (auto& s_shard : m_shards) {
+        s_shard->socket.setSub(p_interfaceName, p_port);
+    }
+    if (m_steering) {
+        attachSteering();
+    }
+}
+
+void CtSocketUdpSharded::runShards(const CtShardCallback& p_callback, CtBool p_pin) {
+    if (m_running.load()) {
+        throw CtThreadError("Shards already running.");
+    }
+    if (p_pin) {
+        cpu_set_t s_allowed;
+        CPU_ZERO(&s_allowed);
+        if (sched_getaffinity(0, sizeof(s_allowed), &s_allowed) == -1) {
+            throw CtThreadError("CPU affinity of the process cannot be read.");
+        }
+        for (CtUInt32 idx = 0; idx < m_shards.size(); idx++) {
+            if (!CPU_ISSET(shardCpu(idx), &s_allowed)) {
+                throw CtThreadError("CPU " + std::to_string(shardCpu(idx)) + " of shard " + std::to_string(idx) + " is not available.");
+            }
+        }
+    }
+    m_callback = p_callback;
+    m_running.store(CT_TRUE);
+    for (CtUInt32 idx = 0; idx < m_shards.size(); idx++) {
+        m_shards[idx]->worker.setTaskFunc([this, idx, p_pin]() {
+            shardLoop(idx, p_pin);
+        });
+        m_shards[idx]->worker.runTask();
+    }
+}
+
+void CtSocketUdpSharded::stopShards() {
+    m_running.store(CT_FALSE);
+    for (auto& s_shard : m_shards) {
+        s_shard->worker.joinTask();
+    }
+}
+
+CtUInt32 CtSocketUdpSharded::shards() {
+    return m_shards.size();
+}
+
+CtUInt64 CtSocketUdpSharded::getReceived(CtUInt32 p_shard) {
+    if (p_shard >= m_shards.size()) {
+        throw CtOutOfRangeError("Shard index is out of range.");
+    }
+    return m_shards[p_shard]->received.load();
+}
+
+CtUInt64 CtSocketUdpSharded::getErrors(CtUInt32 p_shard) {
+    if (p_shard >= m_shards.size()) {
+        throw CtOutOfRangeError("Shard index is out of range.");
+    }
+    return m_shards[p_shard]->errors.load();
+}
+
+void CtSocketUdpSharded::shardLoop(CtUInt32 p_idx, CtBool p_pin) {
+    CtShard& s_shard = *m_shards[p_idx];
+    if (p_pin) {
+        cpu_set_t s_cpus;
+        CPU_ZERO(&s_cpus);
+        CPU_SET(shardCpu(p_idx), &s_cpus);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(s_cpus), &s_cpus) != 0) {
+            s_shard.errors++;
+        }
+    }
+
+    CtRawData s_messages[CT_SHARD_BATCH];
+    struct pollfd s_poll;
+    s_poll.fd = s_shard.socket.getFd();
+    s_poll.events = POLLIN;
+
+    while (m_running.load()) {
+        if (::poll(&s_poll, 1, CT_SHARD_TIMEOUT) <= 0) {
+            continue;
+        }
+        try {
+            CtUInt32 s_count;
+            while ((s_count = s_shard.socket.receiveBatch(s_messages, CT_SHARD_BATCH)) > 0) {
+                s_shard.received += s_count;
+                m_callback(p_idx, s_messages, s_count);
+            }
+        } catch (...) {
+            s_shard.errors++;
+        }
+    }
+}
+
+CtUInt32 CtSocketUdpSharded::shardCpu(CtUInt32 p_idx) {
+    return p_idx % std::max(1u, std::thread::hardware_concurrency());
+}
+
+void CtSocketUdpSharded::attachSteering() {
+    struct sock_filter s_code[] = {
+        /* A = id of the CPU that handles the packet */
+        { BPF_LD | BPF_W | BPF_ABS, 0, 0, (CtUInt32)(SKF_AD_OFF + SKF_AD_CPU) },
+        /* A = A % number of sockets */
+        { BPF_ALU | BPF_MOD | BPF_K, 0, 0, (CtUInt32)m_shards.size() },
+        /* return A as the index of the socket in the reuseport group */
+        { BPF_RET | BPF_A, 0, 0, 0 },
+    };
+    struct sock_fprog s_prog;
+    s_prog.len = sizeof(s_code) / sizeof(s_code[0]);
+    s_prog.filter = s_code;
+
+    if (setsockopt(m_shards[0]->socket.getFd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &s_prog, sizeof(s_prog)) == -1) {
+        throw CtSocketError("CPU steering program cannot be attached.");
+    }
+}
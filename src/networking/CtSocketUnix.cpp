@@ -0,0 +1,256 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtSocketUnix.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "networking/CtSocketUnix.hpp"
+
+#include <sys/uio.h>
+#include <cerrno>
+#include <cstddef>
+
+CtSocketUnix::CtSocketUnix(Type p_type) : m_type(p_type), m_socket(-1), m_pubLength(0) {
+    reset(socket(AF_UNIX, ((m_type == Type::Stream) ? SOCK_STREAM : SOCK_DGRAM) | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
+    if (m_socket == -1) {
+        throw CtSocketError("Socket cannot be assigned.");
+    }
+    memset(&m_pubAddress, 0, sizeof(m_pubAddress));
+}
+
+CtSocketUnix::~CtSocketUnix() {
+    reset(-1);
+    if (!m_path.empty()) {
+        unlink(m_path.c_str());
+    }
+}
+
+void CtSocketUnix::setSub(const CtString& p_path) {
+    bindPath(p_path);
+}
+
+void CtSocketUnix::setPub(const CtString& p_path) {
+    m_pubLength = toAddress(p_path, &m_pubAddress);
+}
+
+void CtSocketUnix::listen(const CtString& p_path, CtInt32 p_backlog) {
+    bindPath(p_path);
+    if (::listen(m_socket, p_backlog) == -1) {
+        throw CtSocketBindError(CtString("Socket listen on ") + p_path + CtString(" failed."));
+    }
+}
+
+CtBool CtSocketUnix::accept(CtSocketUnix* p_client) {
+    CtInt32 s_socket = accept4(m_socket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (s_socket == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return CT_FALSE;
+        }
+        throw CtSocketError("Socket accept failed.");
+    }
+    p_client->m_type = Type::Stream;
+    p_client->reset(s_socket);
+    return CT_TRUE;
+}
+
+CtBool CtSocketUnix::connect(const CtString& p_path) {
+    sockaddr_un s_address;
+    socklen_t s_length = toAddress(p_path, &s_address);
+    if (::connect(m_socket, (struct sockaddr*)&s_address, s_length) == -1) {
+        if (errno == EAGAIN) {
+            return CT_FALSE;
+        }
+        throw CtSocketError(CtString("Socket connect to ") + p_path + CtString(" failed."));
+    }
+    return CT_TRUE;
+}
+
+CtBool CtSocketUnix::pollRead() {
+    struct pollfd s_poll = {m_socket, POLLIN, 0};
+    CtInt32 pollResult = poll(&s_poll, 1, CtSocketHelpers::socketTimeout);
+    if (pollResult < 0) {
+        throw CtSocketPollError("Socket polling-in failed.");
+    }
+    return pollResult > 0;
+}
+
+CtBool CtSocketUnix::pollWrite() {
+    struct pollfd s_poll = {m_socket, POLLOUT, 0};
+    CtInt32 pollResult = poll(&s_poll, 1, CtSocketHelpers::socketTimeout);
+    if (pollResult < 0) {
+        throw CtSocketPollError("Socket polling-out failed.");
+    }
+    return pollResult > 0;
+}
+
+CtUInt32 CtSocketUnix::send(const CtRawDataView& p_data) {
+    CtInt32 s_sent;
+    if (m_type == Type::Datagram && m_pubLength > 0) {
+        s_sent = sendto(m_socket, p_data.get(), p_data.size(), MSG_NOSIGNAL, (struct sockaddr*)&m_pubAddress, m_pubLength);
+    } else {
+        s_sent = ::send(m_socket, p_data.get(), p_data.size(), MSG_NOSIGNAL);
+    }
+    if (s_sent == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return 0;
+        }
+        throw CtSocketWriteError("Sending data via socket failed.");
+    }
+    return s_sent;
+}
+
+CtUInt32 CtSocketUnix::receive(CtRawData* p_message) {
+    CtInt32 s_received = recv(m_socket, p_message->get(), p_message->maxSize(), 0);
+    if (s_received == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            p_message->resize(0);
+            return 0;
+        }
+        throw CtSocketReadError("Receiving data via socket failed.");
+    }
+    m_closed = (m_type == Type::Stream && s_received == 0 && p_message->maxSize() > 0);
+    p_message->resize(s_received);
+    return s_received;
+}
+
+CtBool CtSocketUnix::sendFd(CtInt32 p_fd, const CtRawDataView& p_data) {
+    union {
+        CtUInt8 buffer[CMSG_SPACE(sizeof(CtInt32))];
+        struct cmsghdr align;
+    } s_control;
+    CtUInt8 s_byte = 0;
+    struct iovec s_iov;
+    s_iov.iov_base = p_data.empty() ? &s_byte : (void*)p_data.get();
+    s_iov.iov_len = p_data.empty() ? 1 : p_data.size();
+
+    struct msghdr s_msg;
+    memset(&s_msg, 0, sizeof(s_msg));
+    if (m_type == Type::Datagram && m_pubLength > 0) {
+        s_msg.msg_name = &m_pubAddress;
+        s_msg.msg_namelen = m_pubLength;
+    }
+    s_msg.msg_iov = &s_iov;
+    s_msg.msg_iovlen = 1;
+    s_msg.msg_control = s_control.buffer;
+    s_msg.msg_controllen = sizeof(s_control.buffer);
+
+    struct cmsghdr* s_cmsg = CMSG_FIRSTHDR(&s_msg);
+    s_cmsg->cmsg_level = SOL_SOCKET;
+    s_cmsg->cmsg_type = SCM_RIGHTS;
+    s_cmsg->cmsg_len = CMSG_LEN(sizeof(CtInt32));
+    memcpy(CMSG_DATA(s_cmsg), &p_fd, sizeof(p_fd));
+
+    if (sendmsg(m_socket, &s_msg, MSG_NOSIGNAL) == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return CT_FALSE;
+        }
+        throw CtSocketWriteError("Sending descriptor via socket failed.");
+    }
+    return CT_TRUE;
+}
+
+CtInt32 CtSocketUnix::receiveFd(CtRawData* p_message) {
+    union {
+        CtUInt8 buffer[CMSG_SPACE(sizeof(CtInt32))];
+        struct cmsghdr align;
+    } s_control;
+    CtUInt8 s_byte;
+    struct iovec s_iov;
+    s_iov.iov_base = (p_message != nullptr) ? p_message->get() : &s_byte;
+    s_iov.iov_len = (p_message != nullptr) ? p_message->maxSize() : 1;
+
+    struct msghdr s_msg;
+    memset(&s_msg, 0, sizeof(s_msg));
+    s_msg.msg_iov = &s_iov;
+    s_msg.msg_iovlen = 1;
+    s_msg.msg_control = s_control.buffer;
+    s_msg.msg_controllen = sizeof(s_control.buffer);
+
+    CtInt32 s_received = recvmsg(m_socket, &s_msg, MSG_CMSG_CLOEXEC);
+    if (s_received == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return -1;
+        }
+        throw CtSocketReadError("Receiving descriptor via socket failed.");
+    }
+    if (p_message != nullptr) {
+        p_message->resize(s_received);
+    }
+
+    CtInt32 s_fd = -1;
+    for (struct cmsghdr* s_cmsg = CMSG_FIRSTHDR(&s_msg); s_cmsg != nullptr; s_cmsg = CMSG_NXTHDR(&s_msg, s_cmsg)) {
+        if (s_cmsg->cmsg_level == SOL_SOCKET && s_cmsg->cmsg_type == SCM_RIGHTS) {
+            memcpy(&s_fd, CMSG_DATA(s_cmsg), sizeof(s_fd));
+        }
+    }
+    return s_fd;
+}
+
+CtBool CtSocketUnix::isClosed() {
+    return m_closed;
+}
+
+CtInt32 CtSocketUnix::getFd() {
+    return m_socket;
+}
+
+socklen_t CtSocketUnix::toAddress(const CtString& p_path, sockaddr_un* p_address) {
+    memset(p_address, 0, sizeof(*p_address));
+    p_address->sun_family = AF_UNIX;
+    if (p_path.empty() || p_path.size() >= sizeof(p_address->sun_path)) {
+        throw CtSocketError(CtString("Invalid socket path ") + p_path + CtString("."));
+    }
+    memcpy(p_address->sun_path, p_path.data(), p_path.size());
+    if (p_path[0] == '@') {
+        p_address->sun_path[0] = '\0';
+        return offsetof(sockaddr_un, sun_path) + p_path.size();
+    }
+    return sizeof(*p_address);
+}
+
+void CtSocketUnix::bindPath(const CtString& p_path) {
+    sockaddr_un s_address;
+    socklen_t s_length = toAddress(p_path, &s_address);
+    if (p_path[0] != '@') {
+        unlink(p_path.c_str());
+    }
+    if (bind(m_socket, (struct sockaddr*)&s_address, s_length) == -1) {
+        throw CtSocketBindError(CtString("Socket bind to ") + p_path + CtString(" failed."));
+    }
+    if (p_path[0] != '@') {
+        m_path = p_path;
+    }
+}
+
+void CtSocketUnix::reset(CtInt32 p_socket) {
+    if (m_socket != -1) {
+        close(m_socket);
+    }
+    m_socket = p_socket;
+    m_closed = CT_FALSE;
+}
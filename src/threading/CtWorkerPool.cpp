@@ -52,6 +52,12 @@ void CtWorkerPool::addTask(const CtTask& task) {
     }
 }
 
+void CtWorkerPool::addTask(const CtTask& task, const CtLogContext& context) {
+    CtTask s_task(task);
+    s_task.setTaskFunc(context.wrap(s_task.getTaskFunc()));
+    addTask(s_task);
+}
+
 void CtWorkerPool::join() {
     CtThread::join();
 }
@@ -30,16 +30,24 @@ SOFTWARE.
  */
 
 #include "utils/CtConfig.hpp"
+#include "utils/CtConfigParser.hpp"
+#include "utils/CtConfigSnapshot.hpp"
 
-CtConfig::CtConfig(const CtString& configFile) : m_configFile(configFile) {
-    m_source = nullptr;
+#include <algorithm>
+#include <filesystem>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+CtConfig::CtConfig(const CtString& configFile) : m_configFile(configFile), m_configValues(std::make_shared<const CtConfigMap>()), m_inotify(-1) {
     m_sink = nullptr;
+    registerEvent(CtConfig::Events::RELOADED);
+    registerEvent(CtConfig::Events::RELOAD_FAILED);
 }
 
 CtConfig::~CtConfig() {
-    if (m_source != nullptr) {
-        delete m_source;
-    }
+    unwatch();
+    waitPendingEvents();
     if (m_sink != nullptr) {
         delete m_sink;
     }
@@ -47,102 +55,108 @@ CtConfig::~CtConfig() {
 
 void CtConfig::read() {
     std::scoped_lock lock(m_mtx_control);
-    m_source = new CtFileInput(m_configFile);
-    m_source->setDelimiter("\n", 1);
+    auto values = std::make_shared<CtConfigMap>(*m_configValues.load());
+    load(values.get());
+    publish(std::move(values));
+}
 
-    CtRawData data(512);
+void CtConfig::load(CtConfigMap* p_values) {
+    CtConfigParser parser(p_values);
+    parser.parseFile(m_configFile);
+}
 
-    while(m_source->read(&data)) {
-        parseLine(CtString((CtChar*)data.get(), data.size()));
-        data.reset();
+void CtConfig::readCompiled(const CtString& p_snapshotFile) {
+    std::scoped_lock lock(m_mtx_control);
+    auto values = std::make_shared<CtConfigMap>(*m_configValues.load());
+    try {
+        CtConfigSnapshot snapshot(p_snapshotFile);
+        if (!snapshot.isStale()) {
+            snapshot.load(values.get());
+            publish(std::move(values));
+            return;
+        }
+    } catch (const CtException& e) {
+        // missing or invalid, compiled again below
+    }
+    CtConfigMap fileValues;
+    CtConfigParser parser(&fileValues);
+    parser.parseFile(m_configFile);
+    try {
+        CtConfigSnapshot::compile(fileValues, p_snapshotFile, parser.files());
+    } catch (const CtFileWriteError& e) {
+        // the snapshot is only a cache, the parsed values are published without it
     }
+    for (auto& [key, value] : fileValues) {
+        values->insert_or_assign(key, std::move(value));
+    }
+    publish(std::move(values));
+}
 
-    delete m_source;
-    m_source = nullptr;
+void CtConfig::compile(const CtString& p_snapshotFile) {
+    std::scoped_lock lock(m_mtx_control);
+    CtConfigSnapshot::compile(*m_configValues.load(), p_snapshotFile, { m_configFile });
 }
 
 void CtConfig::write() {
     std::scoped_lock lock(m_mtx_control);
+    std::shared_ptr<const CtConfigMap> values = m_configValues.load();
     m_sink = new CtFileOutput(m_configFile, CtFileOutput::WriteMode::Truncate);
-    m_sink->setDelimiter("\n", 1);
-    CtMap<CtString, CtString>::iterator iter;
 
-    CtRawData data(512);
-    for (iter = m_configValues.begin(); iter != m_configValues.end(); ++iter) {
-        CtString line = iter->first + CtString(" = ") + iter->second;
-        data.clone((CtUInt8*)line.c_str(), line.size());
+    // sorted, so that the file does not depend on the order of the hash map
+    std::vector<const CtConfigMap::value_type*> entries;
+    entries.reserve(values->size());
+    for (const auto& entry : *values) {
+        entries.push_back(&entry);
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+
+    CtString text;
+    for (const auto* entry : entries) {
+        text.append(entry->first).append(" = ");
+        CtConfigParser::quote(&text, entry->second.asString());
+        text.push_back('\n');
+    }
+    if (!text.empty()) {
+        CtRawData data((CtUInt32)text.size());
+        data.clone((CtUInt8*)text.data(), (CtUInt32)text.size());
         m_sink->write(&data);
-        data.reset();
     }
 
     delete m_sink;
     m_sink = nullptr;
 }
 
-void CtConfig::parseLine(const CtString& line) {
-    size_t separatorPos = line.find('=');
-    size_t commentPos = line.find('#');
-    size_t eol = line.size();
-    CtBool hasComment = commentPos != CtString::npos;
-    CtBool hasSeparator = separatorPos != CtString::npos;
-
-    if (hasSeparator && hasComment) {
-        if (separatorPos > commentPos) {
-            throw CtFileParseError("Invalid comment.");
-        } else {
-            eol = commentPos;
-        }
-    } else if (!hasSeparator && !hasComment) {
-        throw CtFileParseError("Invalid line entry.");
-    } else if (!hasSeparator && hasComment) {
-        return;
-    }
-
-    CtString key = line.substr(0, separatorPos);
-    CtString value = line.substr(separatorPos + 1, eol - (separatorPos + 1));
-
-    key.erase(0, key.find_first_not_of(" \t\r\n"));
-    key.erase(key.find_last_not_of(" \t\r\n") + 1);
-    value.erase(0, value.find_first_not_of(" \t\r\n"));
-    value.erase(value.find_last_not_of(" \t\r\n") + 1);
-
-    m_configValues[key] = value;
-}
-
-CtInt32 CtConfig::parseAsInt(const CtString& key) {
-    CtString str_value = getValue(key);
-    return CtStringHelpers::StrToInt(str_value);
+CtInt32 CtConfig::parseAsInt(std::string_view key) {
+    return getValue(*m_configValues.load(), key).asInt();
 }
 
-CtUInt32 CtConfig::parseAsUInt(const CtString& key) {
-    CtString str_value = getValue(key);
-    return CtStringHelpers::StrToUInt(str_value);
+CtUInt32 CtConfig::parseAsUInt(std::string_view key) {
+    return getValue(*m_configValues.load(), key).asUInt();
 }
 
-CtFloat CtConfig::parseAsFloat(const CtString& key) {
-    CtString str_value = getValue(key);
-    return CtStringHelpers::StrToFloat(str_value);
+CtFloat CtConfig::parseAsFloat(std::string_view key) {
+    return getValue(*m_configValues.load(), key).asFloat();
 }
 
-CtDouble CtConfig::parseAsDouble(const CtString& key) {
-    CtString str_value = getValue(key);
-    return CtStringHelpers::StrToDouble(str_value);
+CtDouble CtConfig::parseAsDouble(std::string_view key) {
+    return getValue(*m_configValues.load(), key).asDouble();
 }
 
-CtString CtConfig::parseAsString(const CtString& key) {
-    return getValue(key);
+CtString CtConfig::parseAsString(std::string_view key) {
+    return getValue(*m_configValues.load(), key).asString();
 }
 
 void CtConfig::reset() {
-    m_configValues.clear();
+    std::scoped_lock lock(m_mtx_control);
+    publish(std::make_shared<const CtConfigMap>());
 }
 
-CtString CtConfig::getValue(const CtString& key) {
-    if (m_configValues.find(key) != m_configValues.end()) {
-        return m_configValues[key];
-    } else {
-        throw CtKeyNotFoundError(CtString("Key <") + key + CtString("> not found."));
+const CtConfigValue& CtConfig::getValue(const CtConfigMap& values, std::string_view key) {
+    auto iter = values.find(key);
+    if (iter == values.end()) {
+        throw CtKeyNotFoundError(CtString("Key <") + CtString(key) + CtString("> not found."));
     }
+    return iter->second;
 }
 
 void CtConfig::writeInt(const CtString& p_key, const CtInt32& p_value) {
@@ -162,5 +176,99 @@ void CtConfig::writeDouble(const CtString& p_key, const CtDouble& p_value) {
 }
 
 void CtConfig::writeString(const CtString& p_key, const CtString& p_value) {
-    m_configValues[p_key] = p_value;
+    std::scoped_lock lock(m_mtx_control);
+    auto values = std::make_shared<CtConfigMap>(*m_configValues.load());
+    values->insert_or_assign(p_key, CtConfigValue(p_value));
+    publish(std::move(values));
+}
+
+void CtConfig::watch() {
+    std::scoped_lock lock(m_mtx_control);
+    if (m_inotify >= 0) {
+        return;
+    }
+    std::filesystem::path path(m_configFile);
+    CtString directory = path.has_parent_path() ? path.parent_path().string() : CtString(".");
+    m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotify < 0) {
+        throw CtFileReadError("Cannot watch " + m_configFile + ".");
+    }
+    // the directory is watched, editors and deployments often replace the file with a rename
+    if (inotify_add_watch(m_inotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        close(m_inotify);
+        m_inotify = -1;
+        throw CtFileReadError("Cannot watch " + m_configFile + ".");
+    }
+    start();
+}
+
+void CtConfig::unwatch() {
+    stop();
+    std::scoped_lock lock(m_mtx_control);
+    if (m_inotify >= 0) {
+        close(m_inotify);
+        m_inotify = -1;
+    }
+}
+
+CtUInt32 CtConfig::watchKey(std::string_view p_key) {
+    std::scoped_lock lock(m_mtx_control);
+    auto iter = m_keyEvents.find(p_key);
+    if (iter != m_keyEvents.end()) {
+        return iter->second;
+    }
+    CtUInt32 s_event = CT_CONFIG_KEY_EVENTS + (CtUInt32)m_keyEvents.size();
+    registerEvent(s_event);
+    m_keyEvents.emplace(CtString(p_key), s_event);
+    return s_event;
+}
+
+std::shared_ptr<const CtConfigMap> CtConfig::snapshot() const {
+    return m_configValues.load();
+}
+
+void CtConfig::publish(std::shared_ptr<const CtConfigMap> p_values) {
+    std::shared_ptr<const CtConfigMap> s_previous = m_configValues.exchange(p_values);
+    for (const auto& [s_key, s_event] : m_keyEvents) {
+        auto s_old = s_previous->find(s_key);
+        auto s_new = p_values->find(s_key);
+        CtBool s_hadKey = s_old != s_previous->end();
+        CtBool s_hasKey = s_new != p_values->end();
+        if (s_hadKey != s_hasKey || (s_hasKey && s_old->second.asString() != s_new->second.asString())) {
+            triggerEvent(s_event);
+        }
+    }
+}
+
+void CtConfig::loop() {
+    struct pollfd s_poll = { m_inotify, POLLIN, 0 };
+    if (poll(&s_poll, 1, CT_CONFIG_WATCH_INTERVAL) <= 0) {
+        return;
+    }
+    alignas(struct inotify_event) char s_buffer[4096];
+    CtString s_name = std::filesystem::path(m_configFile).filename().string();
+    CtBool s_changed = CT_FALSE;
+    ssize_t s_length;
+    while ((s_length = ::read(m_inotify, s_buffer, sizeof(s_buffer))) > 0) {
+        for (char* s_ptr = s_buffer; s_ptr < s_buffer + s_length;) {
+            const struct inotify_event* s_event = reinterpret_cast<const struct inotify_event*>(s_ptr);
+            if (s_event->len > 0 && s_name == s_event->name) {
+                s_changed = CT_TRUE;
+            }
+            s_ptr += sizeof(struct inotify_event) + s_event->len;
+        }
+    }
+    if (!s_changed) {
+        return;
+    }
+    std::scoped_lock lock(m_mtx_control);
+    try {
+        auto s_values = std::make_shared<CtConfigMap>();
+        load(s_values.get());
+        publish(std::move(s_values));
+    } catch (const CtException& e) {
+        triggerEvent(CtConfig::Events::RELOAD_FAILED);
+        return;
+    }
+    triggerEvent(CtConfig::Events::RELOADED);
 }
@@ -0,0 +1,249 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtConfigParser.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "utils/CtConfigParser.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <filesystem>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr std::string_view s_whitespace = " \t\r";
+
+std::string_view trim(std::string_view p_text) {
+    size_t s_begin = p_text.find_first_not_of(s_whitespace);
+    if (s_begin == std::string_view::npos) {
+        return std::string_view();
+    }
+    size_t s_end = p_text.find_last_not_of(s_whitespace);
+    return p_text.substr(s_begin, s_end - s_begin + 1);
+}
+
+CtFileParseError parseError(const CtString& p_reason, const CtString& p_fileName, CtUInt32 p_line) {
+    return CtFileParseError(p_reason + " at " + p_fileName + ":" + ToCtString(p_line) + ".");
+}
+
+} // namespace
+
+CtConfigParser::CtConfigParser(CtConfigMap* p_values) : m_values(p_values) {
+}
+
+void CtConfigParser::parseFile(const CtString& p_fileName) {
+    parseFile(p_fileName, 0);
+}
+
+void CtConfigParser::parse(std::string_view p_text) {
+    parseText(p_text, "<text>", 0);
+}
+
+const std::vector<CtString>& CtConfigParser::files() const {
+    return m_files;
+}
+
+void CtConfigParser::parseFile(const CtString& p_fileName, CtUInt32 p_depth) {
+    int s_fd = open(p_fileName.c_str(), O_RDONLY | O_CLOEXEC);
+    if (s_fd < 0) {
+        throw CtFileReadError("File cannot open.");
+    }
+    m_files.push_back(p_fileName);
+    struct stat s_stat;
+    if (fstat(s_fd, &s_stat) != 0) {
+        close(s_fd);
+        throw CtFileReadError("File cannot open.");
+    }
+    /* Read into a private buffer: a mapping would fault with SIGBUS if the file is truncated
+       while it is parsed, e.g. when it is rewritten during a reload. */
+    CtString s_text((size_t)s_stat.st_size + 1, '\0');
+    size_t s_size = 0;
+    for (;;) {
+        if (s_size == s_text.size()) {
+            s_text.resize(s_text.size() * 2);
+        }
+        ssize_t s_read = read(s_fd, &s_text[s_size], s_text.size() - s_size);
+        if (s_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (s_read < 0) {
+            close(s_fd);
+            throw CtFileReadError("File cannot be read.");
+        }
+        if (s_read == 0) {
+            break;
+        }
+        s_size += (size_t)s_read;
+    }
+    close(s_fd);
+    s_text.resize(s_size);
+    m_values->reserve(m_values->size() + std::count(s_text.begin(), s_text.end(), '\n') + 1);
+    parseText(s_text, p_fileName, p_depth);
+}
+
+void CtConfigParser::parseText(std::string_view p_text, const CtString& p_fileName, CtUInt32 p_depth) {
+    CtUInt32 s_line = 0;
+    while (!p_text.empty()) {
+        size_t s_eol = p_text.find('\n');
+        std::string_view s_text = trim(p_text.substr(0, s_eol));
+        p_text.remove_prefix(s_eol == std::string_view::npos ? p_text.size() : s_eol + 1);
+        s_line++;
+
+        if (s_text.empty() || s_text[0] == '#') {
+            continue;
+        }
+        if (s_text[0] == '[') {
+            s_text = trim(s_text.substr(0, s_text.find('#')));
+            if (s_text.back() != ']') {
+                throw parseError("Invalid section", p_fileName, s_line);
+            }
+            std::string_view s_name = trim(s_text.substr(1, s_text.size() - 2));
+            m_section.assign(s_name);
+            if (!s_name.empty()) {
+                m_section.push_back('.');
+            }
+            continue;
+        }
+        if (s_text.substr(0, 8) == "@include") {
+            std::string_view s_path = parseValue(s_text.substr(8), p_fileName, s_line);
+            if (s_path.empty()) {
+                throw parseError("Invalid include", p_fileName, s_line);
+            }
+            if (p_depth + 1 >= CT_CONFIG_MAX_INCLUDE_DEPTH) {
+                throw parseError("Too many nested includes", p_fileName, s_line);
+            }
+            std::filesystem::path s_include(s_path);
+            if (s_include.is_relative()) {
+                s_include = std::filesystem::path(p_fileName).parent_path() / s_include;
+            }
+            CtString s_section;
+            s_section.swap(m_section);
+            parseFile(s_include.string(), p_depth + 1);
+            m_section.swap(s_section);
+            continue;
+        }
+
+        size_t s_separator = s_text.find('=');
+        size_t s_comment = s_text.find('#');
+        if (s_separator == std::string_view::npos) {
+            throw parseError("Invalid line entry", p_fileName, s_line);
+        }
+        if (s_comment < s_separator) {
+            throw parseError("Invalid comment", p_fileName, s_line);
+        }
+        std::string_view s_key = trim(s_text.substr(0, s_separator));
+        if (s_key.empty()) {
+            throw parseError("Empty key", p_fileName, s_line);
+        }
+        std::string_view s_value = parseValue(s_text.substr(s_separator + 1), p_fileName, s_line);
+        m_key.assign(m_section).append(s_key);
+        m_values->insert_or_assign(m_key, CtConfigValue(s_value));
+    }
+}
+
+std::string_view CtConfigParser::parseValue(std::string_view p_text, const CtString& p_fileName, CtUInt32 p_line) {
+    p_text = trim(p_text);
+    if (p_text.empty() || p_text[0] != '"') {
+        return trim(p_text.substr(0, p_text.find('#')));
+    }
+    m_value.clear();
+    size_t s_begin = 1;
+    for (size_t idx = 1; idx < p_text.size(); idx++) {
+        char s_char = p_text[idx];
+        if (s_char == '"') {
+            m_value.append(p_text.substr(s_begin, idx - s_begin));
+            std::string_view s_rest = trim(p_text.substr(idx + 1));
+            if (!s_rest.empty() && s_rest[0] != '#') {
+                throw parseError("Text after quoted value", p_fileName, p_line);
+            }
+            return m_value;
+        }
+        if (s_char != '\\') {
+            continue;
+        }
+        if (idx + 1 >= p_text.size()) {
+            break;
+        }
+        m_value.append(p_text.substr(s_begin, idx - s_begin));
+        switch (p_text[++idx]) {
+            case 'n':
+                m_value.push_back('\n');
+                break;
+            case 'r':
+                m_value.push_back('\r');
+                break;
+            case 't':
+                m_value.push_back('\t');
+                break;
+            case '"':
+            case '\\':
+            case '#':
+                m_value.push_back(p_text[idx]);
+                break;
+            default:
+                throw parseError("Invalid escape", p_fileName, p_line);
+        }
+        s_begin = idx + 1;
+    }
+    throw parseError("Unterminated quoted value", p_fileName, p_line);
+}
+
+void CtConfigParser::quote(CtString* p_out, std::string_view p_value) {
+    CtBool s_quoted = !p_value.empty() && (p_value != trim(p_value) || p_value[0] == '"' ||
+                      p_value.find_first_of("#\n\r") != std::string_view::npos);
+    if (!s_quoted) {
+        p_out->append(p_value);
+        return;
+    }
+    p_out->push_back('"');
+    for (char s_char : p_value) {
+        switch (s_char) {
+            case '\n':
+                p_out->append("\\n");
+                break;
+            case '\r':
+                p_out->append("\\r");
+                break;
+            case '\t':
+                p_out->append("\\t");
+                break;
+            case '"':
+            case '\\':
+                p_out->push_back('\\');
+                p_out->push_back(s_char);
+                break;
+            default:
+                p_out->push_back(s_char);
+                break;
+        }
+    }
+    p_out->push_back('"');
+}
@@ -0,0 +1,284 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file CtConfigSnapshot.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "utils/CtConfigSnapshot.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define CT_CONFIG_SNAPSHOT_MAGIC    0x50414e5347464354ull   /* "TCFGSNAP" */
+
+namespace {
+
+CtInt64 modificationTime(const struct stat& p_stat) {
+    return (CtInt64)p_stat.st_mtim.tv_sec * 1000000000 + p_stat.st_mtim.tv_nsec;
+}
+
+} // namespace
+
+CtConfigSnapshot::CtConfigSnapshot(const CtString& p_fileName) {
+    int s_fd = open(p_fileName.c_str(), O_RDONLY | O_CLOEXEC);
+    if (s_fd < 0) {
+        throw CtFileReadError("File cannot open.");
+    }
+    struct stat s_stat;
+    if (fstat(s_fd, &s_stat) != 0) {
+        close(s_fd);
+        throw CtFileReadError("File cannot open.");
+    }
+    m_size = (size_t)s_stat.st_size;
+    m_time = modificationTime(s_stat);
+    if (m_size < sizeof(CtConfigSnapshotHeader)) {
+        close(s_fd);
+        throw CtFileParseError("Invalid snapshot " + p_fileName + ".");
+    }
+    void* s_data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, s_fd, 0);
+    close(s_fd);
+    if (s_data == MAP_FAILED) {
+        throw CtFileReadError("File cannot be read.");
+    }
+    m_data = static_cast<const CtUInt8*>(s_data);
+    m_header = reinterpret_cast<const CtConfigSnapshotHeader*>(m_data);
+    m_entries = reinterpret_cast<const CtConfigSnapshotEntry*>(m_data + sizeof(CtConfigSnapshotHeader));
+    m_sources = reinterpret_cast<const CtConfigSnapshotSource*>(m_entries + m_header->count);
+
+    // the checksum covers the whole file, the bounds make sure a colliding one cannot read outside of it
+    CtUInt64 s_tables = sizeof(CtConfigSnapshotHeader) + (CtUInt64)m_header->count * sizeof(CtConfigSnapshotEntry) +
+                        (CtUInt64)m_header->sources * sizeof(CtConfigSnapshotSource);
+    CtBool s_valid = m_header->magic == CT_CONFIG_SNAPSHOT_MAGIC && m_header->version == CT_CONFIG_SNAPSHOT_VERSION &&
+                     m_header->size == m_size && s_tables <= m_size && m_header->checksum == checksum(m_data, m_size);
+    for (CtUInt32 i = 0; s_valid && i < m_header->count; i++) {
+        s_valid = (CtUInt64)m_entries[i].key + m_entries[i].keyLength <= m_size &&
+                  (CtUInt64)m_entries[i].text + m_entries[i].textLength <= m_size;
+    }
+    for (CtUInt32 i = 0; s_valid && i < m_header->sources; i++) {
+        s_valid = (CtUInt64)m_sources[i].path + m_sources[i].pathLength <= m_size;
+    }
+    if (!s_valid) {
+        munmap(s_data, m_size);
+        throw CtFileParseError("Invalid snapshot " + p_fileName + ".");
+    }
+    madvise(s_data, m_size, MADV_RANDOM);
+}
+
+CtConfigSnapshot::~CtConfigSnapshot() {
+    munmap(const_cast<CtUInt8*>(m_data), m_size);
+}
+
+void CtConfigSnapshot::compile(const CtConfigMap& p_values, const CtString& p_fileName, const std::vector<CtString>& p_sources) {
+    std::vector<const CtConfigMap::value_type*> s_values;
+    s_values.reserve(p_values.size());
+    for (const auto& s_value : p_values) {
+        s_values.push_back(&s_value);
+    }
+    std::sort(s_values.begin(), s_values.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+
+    size_t s_size = sizeof(CtConfigSnapshotHeader) + s_values.size() * sizeof(CtConfigSnapshotEntry) +
+                    p_sources.size() * sizeof(CtConfigSnapshotSource);
+    for (const auto* s_value : s_values) {
+        s_size += s_value->first.size() + s_value->second.m_text.size();
+    }
+    for (const auto& s_source : p_sources) {
+        s_size += s_source.size();
+    }
+    if (s_size > std::numeric_limits<CtUInt32>::max()) {
+        throw CtFileWriteError("Snapshot " + p_fileName + " is too large.");
+    }
+
+    std::vector<CtUInt8> s_data(s_size);
+    auto* s_header = reinterpret_cast<CtConfigSnapshotHeader*>(s_data.data());
+    auto* s_entries = reinterpret_cast<CtConfigSnapshotEntry*>(s_data.data() + sizeof(CtConfigSnapshotHeader));
+    auto* s_sources = reinterpret_cast<CtConfigSnapshotSource*>(s_entries + s_values.size());
+    CtUInt32 s_offset = (CtUInt32)(reinterpret_cast<CtUInt8*>(s_sources + p_sources.size()) - s_data.data());
+    auto put = [&](std::string_view p_text) {
+        std::memcpy(s_data.data() + s_offset, p_text.data(), p_text.size());
+        s_offset += (CtUInt32)p_text.size();
+        return s_offset - (CtUInt32)p_text.size();
+    };
+
+    s_header->magic = CT_CONFIG_SNAPSHOT_MAGIC;
+    s_header->version = CT_CONFIG_SNAPSHOT_VERSION;
+    s_header->count = (CtUInt32)s_values.size();
+    s_header->sources = (CtUInt32)p_sources.size();
+    s_header->reserved = 0;
+    s_header->size = s_size;
+    for (size_t i = 0; i < s_values.size(); i++) {
+        const CtConfigValue& s_value = s_values[i]->second;
+        s_entries[i].keyLength = (CtUInt32)s_values[i]->first.size();
+        s_entries[i].key = put(s_values[i]->first);
+        s_entries[i].textLength = (CtUInt32)s_value.m_text.size();
+        s_entries[i].text = put(s_value.m_text);
+        s_entries[i].doubleValue = s_value.m_double;
+        s_entries[i].intValue = s_value.m_int;
+        s_entries[i].uintValue = s_value.m_uint;
+        s_entries[i].floatValue = s_value.m_float;
+        s_entries[i].types = s_value.m_types;
+    }
+    for (size_t i = 0; i < p_sources.size(); i++) {
+        s_sources[i].pathLength = (CtUInt32)p_sources[i].size();
+        s_sources[i].path = put(p_sources[i]);
+    }
+    s_header->checksum = checksum(s_data.data(), s_size);
+
+    // written beside and renamed, so readers see either the old or the new snapshot
+    CtString s_temporary = p_fileName + "." + ToCtString((CtInt32)getpid()) + ".tmp";
+    int s_fd = open(s_temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (s_fd < 0) {
+        throw CtFileWriteError("Snapshot " + p_fileName + " cannot be written.");
+    }
+    size_t s_written = 0;
+    while (s_written < s_size) {
+        ssize_t s_result = ::write(s_fd, s_data.data() + s_written, s_size - s_written);
+        if (s_result <= 0) {
+            break;
+        }
+        s_written += (size_t)s_result;
+    }
+    if (close(s_fd) != 0 || s_written < s_size || rename(s_temporary.c_str(), p_fileName.c_str()) != 0) {
+        unlink(s_temporary.c_str());
+        throw CtFileWriteError("Snapshot " + p_fileName + " cannot be written.");
+    }
+}
+
+CtBool CtConfigSnapshot::isStale() const {
+    for (CtUInt32 i = 0; i < m_header->sources; i++) {
+        CtString s_path(string(m_sources[i].path, m_sources[i].pathLength));
+        struct stat s_stat;
+        // file times are coarse, a source changed in the same tick as the snapshot counts as newer
+        if (stat(s_path.c_str(), &s_stat) != 0 || modificationTime(s_stat) >= m_time) {
+            return CT_TRUE;
+        }
+    }
+    return CT_FALSE;
+}
+
+CtUInt32 CtConfigSnapshot::size() const {
+    return m_header->count;
+}
+
+CtBool CtConfigSnapshot::contains(std::string_view p_key) const {
+    return findEntry(p_key) != nullptr;
+}
+
+CtInt32 CtConfigSnapshot::parseAsInt(std::string_view p_key) const {
+    const CtConfigSnapshotEntry& s_entry = getEntry(p_key);
+    if (!(s_entry.types & CtConfigValue::Type::Int)) {
+        throw CtTypeParseError(CtString(string(s_entry.text, s_entry.textLength)) + CtString(" can not be parsed as int."));
+    }
+    return s_entry.intValue;
+}
+
+CtUInt32 CtConfigSnapshot::parseAsUInt(std::string_view p_key) const {
+    const CtConfigSnapshotEntry& s_entry = getEntry(p_key);
+    if (!(s_entry.types & CtConfigValue::Type::UInt)) {
+        throw CtTypeParseError(CtString(string(s_entry.text, s_entry.textLength)) + CtString(" can not be parsed as uint."));
+    }
+    return s_entry.uintValue;
+}
+
+CtFloat CtConfigSnapshot::parseAsFloat(std::string_view p_key) const {
+    const CtConfigSnapshotEntry& s_entry = getEntry(p_key);
+    if (!(s_entry.types & CtConfigValue::Type::Float)) {
+        throw CtTypeParseError(CtString(string(s_entry.text, s_entry.textLength)) + CtString(" can not be parsed as CtFloat."));
+    }
+    return s_entry.floatValue;
+}
+
+CtDouble CtConfigSnapshot::parseAsDouble(std::string_view p_key) const {
+    const CtConfigSnapshotEntry& s_entry = getEntry(p_key);
+    if (!(s_entry.types & CtConfigValue::Type::Double)) {
+        throw CtTypeParseError(CtString(string(s_entry.text, s_entry.textLength)) + CtString(" can not be parsed as CtDouble."));
+    }
+    return s_entry.doubleValue;
+}
+
+std::string_view CtConfigSnapshot::parseAsString(std::string_view p_key) const {
+    const CtConfigSnapshotEntry& s_entry = getEntry(p_key);
+    return string(s_entry.text, s_entry.textLength);
+}
+
+void CtConfigSnapshot::load(CtConfigMap* p_values) const {
+    p_values->reserve(p_values->size() + m_header->count);
+    for (CtUInt32 i = 0; i < m_header->count; i++) {
+        const CtConfigSnapshotEntry& s_entry = m_entries[i];
+        CtConfigValue s_value;
+        s_value.m_text.assign(string(s_entry.text, s_entry.textLength));
+        s_value.m_int = s_entry.intValue;
+        s_value.m_uint = s_entry.uintValue;
+        s_value.m_float = s_entry.floatValue;
+        s_value.m_double = s_entry.doubleValue;
+        s_value.m_types = (CtUInt8)s_entry.types;
+        p_values->insert_or_assign(CtString(string(s_entry.key, s_entry.keyLength)), std::move(s_value));
+    }
+}
+
+const CtConfigSnapshot::CtConfigSnapshotEntry& CtConfigSnapshot::getEntry(std::string_view p_key) const {
+    const CtConfigSnapshotEntry* s_entry = findEntry(p_key);
+    if (s_entry == nullptr) {
+        throw CtKeyNotFoundError(CtString("Key <") + CtString(p_key) + CtString("> not found."));
+    }
+    return *s_entry;
+}
+
+const CtConfigSnapshot::CtConfigSnapshotEntry* CtConfigSnapshot::findEntry(std::string_view p_key) const {
+    const CtConfigSnapshotEntry* s_end = m_entries + m_header->count;
+    const CtConfigSnapshotEntry* s_entry = std::lower_bound(m_entries, s_end, p_key, [this](const CtConfigSnapshotEntry& p_entry, std::string_view p_key) {
+        return string(p_entry.key, p_entry.keyLength) < p_key;
+    });
+    if (s_entry == s_end || string(s_entry->key, s_entry->keyLength) != p_key) {
+        return nullptr;
+    }
+    return s_entry;
+}
+
+CtUInt64 CtConfigSnapshot::checksum(const CtUInt8* p_data, size_t p_size) {
+    constexpr size_t s_field = offsetof(CtConfigSnapshotHeader, checksum);
+    CtUInt64 s_hash = 0xcbf29ce484222325ull;
+    auto hash = [&s_hash](const CtUInt8* p_bytes, size_t p_length) {
+        for (; p_length >= sizeof(CtUInt64); p_bytes += sizeof(CtUInt64), p_length -= sizeof(CtUInt64)) {
+            CtUInt64 s_word;
+            std::memcpy(&s_word, p_bytes, sizeof(s_word));
+            s_hash = (s_hash ^ s_word) * 0x100000001b3ull;
+        }
+        for (; p_length > 0; p_bytes++, p_length--) {
+            s_hash = (s_hash ^ *p_bytes) * 0x100000001b3ull;
+        }
+    };
+    hash(p_data, s_field);
+    hash(p_data + s_field + sizeof(CtUInt64), p_size - s_field - sizeof(CtUInt64));
+    return s_hash;
+}
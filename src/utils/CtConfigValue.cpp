@@ -0,0 +1,98 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtConfigValue.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "utils/CtConfigValue.hpp"
+
+#include <charconv>
+
+namespace {
+
+template <typename T>
+CtBool parseNumber(std::string_view p_text, T* p_value) {
+    size_t s_begin = p_text.find_first_not_of(" \t\r\n");
+    if (s_begin == std::string_view::npos) {
+        return CT_FALSE;
+    }
+    p_text.remove_prefix(s_begin);
+    if (p_text.size() > 1 && p_text[0] == '+' && p_text[1] != '-') {
+        p_text.remove_prefix(1);
+    }
+    std::from_chars_result s_result = std::from_chars(p_text.data(), p_text.data() + p_text.size(), *p_value);
+    return s_result.ec == std::errc() && s_result.ptr != p_text.data();
+}
+
+} // namespace
+
+CtConfigValue::CtConfigValue(std::string_view p_text) : m_text(p_text), m_int(0), m_uint(0), m_float(0), m_double(0), m_types(0) {
+    if (parseNumber(m_text, &m_int)) {
+        m_types |= Type::Int;
+    }
+    if (parseNumber(m_text, &m_uint)) {
+        m_types |= Type::UInt;
+    }
+    if (parseNumber(m_text, &m_float)) {
+        m_types |= Type::Float;
+    }
+    if (parseNumber(m_text, &m_double)) {
+        m_types |= Type::Double;
+    }
+}
+
+CtInt32 CtConfigValue::asInt() const {
+    if (!(m_types & Type::Int)) {
+        throw CtTypeParseError(m_text + CtString(" can not be parsed as int."));
+    }
+    return m_int;
+}
+
+CtUInt32 CtConfigValue::asUInt() const {
+    if (!(m_types & Type::UInt)) {
+        throw CtTypeParseError(m_text + CtString(" can not be parsed as uint."));
+    }
+    return m_uint;
+}
+
+CtFloat CtConfigValue::asFloat() const {
+    if (!(m_types & Type::Float)) {
+        throw CtTypeParseError(m_text + CtString(" can not be parsed as CtFloat."));
+    }
+    return m_float;
+}
+
+CtDouble CtConfigValue::asDouble() const {
+    if (!(m_types & Type::Double)) {
+        throw CtTypeParseError(m_text + CtString(" can not be parsed as CtDouble."));
+    }
+    return m_double;
+}
+
+const CtString& CtConfigValue::asString() const {
+    return m_text;
+}
@@ -0,0 +1,391 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogBackend.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "utils/CtLogBackend.hpp"
+#include "utils/CtLogBinary.hpp"
+#include "utils/CtLogger.hpp"
+#include "utils/CtLogSink.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#define CT_LOG_WRAP     0xFFFFFFFFu
+
+namespace {
+
+/**
+ * @brief Owner of the queue of a thread; retires the queue when the thread exits.
+ */
+struct CtLogQueueHolder {
+    std::shared_ptr<CtLogQueue> queue;
+
+    ~CtLogQueueHolder() {
+        if (queue) {
+            queue->retire();
+        }
+    }
+};
+
+thread_local CtLogQueueHolder t_queue;
+
+CtUInt32 recordSize(CtUInt32 p_length) {
+    return (sizeof(CtLogRecord) + p_length + 7u) & ~7u;
+}
+
+} // namespace
+
+CtLogQueue::CtLogQueue(CtUInt32 p_capacity) :
+    m_capacity(std::bit_ceil(std::max<CtUInt64>(p_capacity, 2 * sizeof(CtLogRecord)))),
+    m_tail(0), m_headCache(0), m_pending(0), m_dropped(0), m_retired(CT_FALSE), m_head(0), m_tailCache(0) {
+    m_storage.resize(m_capacity / sizeof(CtUInt64));
+    m_data = reinterpret_cast<CtUInt8*>(m_storage.data());
+}
+
+CtUInt32 CtLogQueue::maxLength() const {
+    return (CtUInt32)(m_capacity / 2 - sizeof(CtLogRecord));
+}
+
+CtLogRecord* CtLogQueue::reserve(CtUInt32 p_length) {
+    CtUInt64 s_size = recordSize(p_length);
+    CtUInt64 s_tail = m_tail.load(std::memory_order_relaxed);
+    CtUInt64 s_offset = s_tail & (m_capacity - 1);
+    CtUInt64 s_skip = (m_capacity - s_offset < s_size) ? m_capacity - s_offset : 0;
+    if (s_tail + s_skip + s_size - m_headCache > m_capacity) {
+        m_headCache = m_head.load(std::memory_order_acquire);
+        if (s_tail + s_skip + s_size - m_headCache > m_capacity) {
+            return nullptr;
+        }
+    }
+    if (s_skip != 0) {
+        *reinterpret_cast<CtUInt32*>(m_data + s_offset) = CT_LOG_WRAP;
+        s_tail += s_skip;
+    }
+    m_pending = s_tail + s_size;
+    CtLogRecord* s_record = reinterpret_cast<CtLogRecord*>(m_data + (s_tail & (m_capacity - 1)));
+    s_record->size = (CtUInt32)s_size;
+    s_record->length = p_length;
+    return s_record;
+}
+
+void CtLogQueue::commit() {
+    m_tail.store(m_pending, std::memory_order_release);
+}
+
+const CtLogRecord* CtLogQueue::front() {
+    CtUInt64 s_head = m_head.load(std::memory_order_relaxed);
+    while (CT_TRUE) {
+        if (s_head == m_tailCache) {
+            m_tailCache = m_tail.load(std::memory_order_acquire);
+            if (s_head == m_tailCache) {
+                return nullptr;
+            }
+        }
+        CtUInt64 s_offset = s_head & (m_capacity - 1);
+        const CtLogRecord* s_record = reinterpret_cast<const CtLogRecord*>(m_data + s_offset);
+        if (s_record->size != CT_LOG_WRAP) {
+            return s_record;
+        }
+        s_head += m_capacity - s_offset;
+        m_head.store(s_head, std::memory_order_release);
+    }
+}
+
+void CtLogQueue::pop() {
+    CtUInt64 s_head = m_head.load(std::memory_order_relaxed);
+    const CtLogRecord* s_record = reinterpret_cast<const CtLogRecord*>(m_data + (s_head & (m_capacity - 1)));
+    m_head.store(s_head + s_record->size, std::memory_order_release);
+}
+
+void CtLogQueue::retire() {
+    m_retired.store(CT_TRUE, std::memory_order_release);
+}
+
+CtBool CtLogQueue::isRetired() const {
+    return m_retired.load(std::memory_order_acquire);
+}
+
+void CtLogQueue::addDropped() {
+    m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+CtUInt64 CtLogQueue::getDropped() const {
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+CtLogBackend& CtLogBackend::instance() {
+    // never destroyed, loggers and thread exits may still use it during static destruction
+    static CtLogBackend* s_instance = []() {
+        CtLogBackend* s_backend = new CtLogBackend();
+        std::atexit([]() { CtLogBackend::instance().shutdown(); });
+        return s_backend;
+    }();
+    return *s_instance;
+}
+
+CtLogBackend::CtLogBackend() :
+    m_hasNewQueues(CT_FALSE), m_reported(0), m_retiredDrops(0), m_queueSize(CT_LOG_QUEUE_SIZE),
+    m_overflow(CtLogBackend::Overflow::Drop), m_active(CT_TRUE), m_flushRequest(0), m_flushDone(0) {
+    m_buffer.reserve(2 * CT_LOG_BATCH_SIZE);
+    start();
+}
+
+void CtLogBackend::setQueueSize(CtUInt32 p_size) {
+    m_queueSize.store(p_size);
+}
+
+void CtLogBackend::setOverflow(CtLogBackend::Overflow p_overflow) {
+    m_overflow.store(p_overflow);
+}
+
+CtUInt64 CtLogBackend::getDropped() {
+    std::scoped_lock lock(m_mtx_drain, m_mtx_queues);
+    CtUInt64 s_dropped = m_retiredDrops;
+    for (const auto& s_queue : m_queues) {
+        s_dropped += s_queue->getDropped();
+    }
+    for (const auto& s_queue : m_newQueues) {
+        s_dropped += s_queue->getDropped();
+    }
+    return s_dropped;
+}
+
+CtBool CtLogBackend::isActive() {
+    return m_active.load(std::memory_order_relaxed);
+}
+
+CtLogQueue* CtLogBackend::localQueue() {
+    if (!t_queue.queue) {
+        t_queue.queue = std::make_shared<CtLogQueue>(m_queueSize.load());
+        std::scoped_lock lock(m_mtx_queues);
+        m_newQueues.push_back(t_queue.queue);
+        m_hasNewQueues.store(CT_TRUE, std::memory_order_release);
+    }
+    return t_queue.queue.get();
+}
+
+CtUInt32 CtLogBackend::maxLength() {
+    return localQueue()->maxLength();
+}
+
+CtLogRecord* CtLogBackend::reserve(CtUInt32 p_length) {
+    CtLogQueue* s_queue = localQueue();
+    CtLogRecord* s_record = s_queue->reserve(p_length);
+    while (s_record == nullptr) {
+        if (m_overflow.load(std::memory_order_relaxed) == CtLogBackend::Overflow::Drop || !isActive()) {
+            s_queue->addDropped();
+            return nullptr;
+        }
+        m_cv_wake.notify_one();
+        std::this_thread::yield();
+        s_record = s_queue->reserve(p_length);
+    }
+    return s_record;
+}
+
+void CtLogBackend::commit() {
+    t_queue.queue->commit();
+}
+
+void CtLogBackend::flush() {
+    if (!isActive()) {
+        std::scoped_lock lock(m_mtx_drain);
+        while (!drain());
+        return;
+    }
+    std::unique_lock lock(m_mtx_flush);
+    CtUInt64 s_request = m_flushRequest.load() + 1;
+    m_flushRequest.store(s_request);
+    m_cv_wake.notify_one();
+    while (m_flushDone < s_request && isActive()) {
+        m_cv_flushed.wait_for(lock, std::chrono::milliseconds(CT_LOG_POLL_INTERVAL));
+    }
+    if (m_flushDone < s_request) {
+        // shut down meanwhile, the records are written by whoever drains first
+        lock.unlock();
+        std::scoped_lock drainLock(m_mtx_drain);
+        while (!drain());
+    }
+}
+
+void CtLogBackend::shutdown() {
+    if (m_active.exchange(CT_FALSE)) {
+        {
+            std::scoped_lock lock(m_mtx_flush);
+            m_cv_wake.notify_one();
+            m_cv_flushed.notify_all();
+        }
+        stop();
+        std::scoped_lock lock(m_mtx_drain);
+        while (!drain());
+    }
+}
+
+void CtLogBackend::loop() {
+    CtUInt64 s_request = m_flushRequest.load();
+    CtBool s_empty;
+    {
+        std::scoped_lock lock(m_mtx_drain);
+        s_empty = drain();
+    }
+    if (!s_empty) {
+        return;
+    }
+    std::unique_lock lock(m_mtx_flush);
+    if (m_flushDone < s_request) {
+        m_flushDone = s_request;
+        m_cv_flushed.notify_all();
+    }
+    m_cv_wake.wait_for(lock, std::chrono::milliseconds(CT_LOG_POLL_INTERVAL), [&]() {
+        return m_flushRequest.load() != s_request || !isActive();
+    });
+}
+
+CtBool CtLogBackend::drain() {
+    if (m_hasNewQueues.load(std::memory_order_acquire)) {
+        std::scoped_lock lock(m_mtx_queues);
+        m_queues.insert(m_queues.end(), m_newQueues.begin(), m_newQueues.end());
+        m_newQueues.clear();
+        m_hasNewQueues.store(CT_FALSE, std::memory_order_relaxed);
+    }
+
+    m_heads.resize(m_queues.size());
+    for (CtUInt32 idx = 0; idx < m_queues.size(); idx++) {
+        m_heads[idx] = m_queues[idx]->front();
+    }
+    CtBool s_empty = CT_TRUE;
+    CtUInt32 s_batch = 0;
+    while (CT_TRUE) {
+        CtInt32 s_next = -1;
+        for (CtUInt32 idx = 0; idx < m_heads.size(); idx++) {
+            if (m_heads[idx] != nullptr && (s_next < 0 || m_heads[idx]->time < m_heads[s_next]->time)) {
+                s_next = idx;
+            }
+        }
+        if (s_next < 0) {
+            break;
+        }
+        const CtLogRecord* s_record = m_heads[s_next];
+        const CtLogger* s_logger = s_record->logger;
+        CtLogger::Level s_level = (CtLogger::Level)s_record->level;
+        CtLogBinaryWriter* s_binary = s_logger->m_binaryOutput.get();
+        if (s_binary != nullptr) {
+            if (s_binary->pending() == 0) {
+                m_binaryOutputs.push_back(s_binary);
+            }
+            s_binary->append(*s_record);
+            s_batch += s_record->length;
+        } else {
+            const CtUInt8* s_data = reinterpret_cast<const CtUInt8*>(s_record + 1);
+            std::string_view s_format(s_record->format, s_record->formatLength);
+            m_message.clear();
+            CtLogFormatter::format(&m_message, s_format, s_record->types, s_record->count, s_data);
+            CtString* s_out = &m_buffer;
+            if (!s_logger->m_sinks.empty()) {
+                m_line.clear();
+                s_out = &m_line;
+            }
+            size_t s_size = s_out->size();
+            if (s_logger->m_encoding == CtLogger::Encoding::Text) {
+                CtLogger::generateLoggerMsg(s_out, s_level, s_logger->m_componentName, m_message, s_record->time, s_logger->timestamp());
+            } else {
+                s_logger->generateStructuredMsg(s_out, s_level, s_record->time, s_record->thread, m_message, s_format, s_record->types,
+                                                s_record->count, s_data,
+                                                std::string_view(reinterpret_cast<const char*>(s_data + s_record->length), s_record->context));
+            }
+            if (s_logger->m_sinks.empty()) {
+                m_buffer.push_back('\n');
+                s_batch += m_buffer.size() - s_size;
+            } else {
+                for (const auto& s_sink : s_logger->m_sinks) {
+                    if (s_sink->isEnabled(s_level)) {
+                        s_sink->log(s_level, s_record->time, m_line);
+                        if (std::find(m_sinks.begin(), m_sinks.end(), s_sink.get()) == m_sinks.end()) {
+                            m_sinks.push_back(s_sink.get());
+                        }
+                    }
+                }
+                s_batch += m_line.size();
+            }
+        }
+        m_queues[s_next]->pop();
+        m_heads[s_next] = m_queues[s_next]->front();
+        if (s_batch >= CT_LOG_BATCH_SIZE) {
+            s_empty = CT_FALSE;
+            break;
+        }
+    }
+
+    CtUInt64 s_dropped = m_retiredDrops;
+    for (CtUInt32 idx = 0; idx < m_queues.size();) {
+        s_dropped += m_queues[idx]->getDropped();
+        // retired is checked first, all records of a retired queue are visible afterwards
+        if (m_queues[idx]->isRetired() && m_queues[idx]->front() == nullptr) {
+            m_retiredDrops += m_queues[idx]->getDropped();
+            m_queues.erase(m_queues.begin() + idx);
+        } else {
+            idx++;
+        }
+    }
+    if (s_dropped > m_reported) {
+        CtUInt64 s_now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        CtLogger::generateLoggerMsg(&m_buffer, CtLogger::Level::WARNING, "CtLogBackend",
+                                    std::to_string(s_dropped - m_reported) + " messages dropped", s_now,
+                                    CtLogTimestamp::local());
+        m_buffer.push_back('\n');
+        m_reported = s_dropped;
+    }
+    write();
+    return s_empty;
+}
+
+void CtLogBackend::write() {
+    if (!m_buffer.empty()) {
+        std::cout.write(m_buffer.data(), m_buffer.size());
+        std::cout.flush();
+        m_buffer.clear();
+    }
+    for (CtLogBinaryWriter* s_binary : m_binaryOutputs) {
+        try {
+            s_binary->write();
+        } catch (const CtFileWriteError&) {
+            // the backend thread has nobody to report to, the records are lost
+        }
+    }
+    m_binaryOutputs.clear();
+    for (CtLogSink* s_sink : m_sinks) {
+        s_sink->flush();
+    }
+    m_sinks.clear();
+}
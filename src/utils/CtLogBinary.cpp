@@ -0,0 +1,233 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogBinary.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "utils/CtLogBinary.hpp"
+#include "utils/CtLogger.hpp"
+
+#include <fstream>
+#include <iterator>
+
+#define CT_LOG_BINARY_MAGIC     "CTLOGBIN"
+#define CT_LOG_BINARY_VERSION   1u
+#define CT_LOG_BINARY_FORMAT    'F'
+#define CT_LOG_BINARY_RECORD    'R'
+
+namespace {
+
+// check that the binary arguments of the given types fit in p_length bytes
+CtBool argsFit(const std::vector<CtLogArgType>& p_types, const CtUInt8* p_data, CtUInt32 p_length) {
+    CtUInt64 s_pos = 0;
+    for (CtLogArgType s_type : p_types) {
+        switch (s_type) {
+            case CtLogArgType::Bool:
+            case CtLogArgType::Char:
+            case CtLogArgType::Int8:
+            case CtLogArgType::UInt8:
+                s_pos += 1;
+                break;
+            case CtLogArgType::Int16:
+            case CtLogArgType::UInt16:
+                s_pos += 2;
+                break;
+            case CtLogArgType::Int32:
+            case CtLogArgType::UInt32:
+            case CtLogArgType::Float:
+                s_pos += 4;
+                break;
+            case CtLogArgType::String: {
+                CtUInt32 s_size = 0;
+                if (s_pos + sizeof(s_size) > p_length) {
+                    return CT_FALSE;
+                }
+                std::memcpy(&s_size, p_data + s_pos, sizeof(s_size));
+                s_pos += sizeof(s_size) + s_size;
+                break;
+            }
+            default:
+                s_pos += 8;
+                break;
+        }
+        if (s_pos > p_length) {
+            return CT_FALSE;
+        }
+    }
+    return CT_TRUE;
+}
+
+} // namespace
+
+CtLogBinaryWriter::CtLogBinaryWriter(const CtString& p_fileName, const CtString& p_component) :
+    m_file(p_fileName, CtFileOutput::WriteMode::Truncate) {
+    CtUInt32 s_version = CT_LOG_BINARY_VERSION;
+    CtUInt32 s_length = (CtUInt32)p_component.size();
+    put(CT_LOG_BINARY_MAGIC, 8);
+    put(&s_version, sizeof(s_version));
+    put(&s_length, sizeof(s_length));
+    put(p_component.data(), s_length);
+}
+
+CtLogBinaryWriter::~CtLogBinaryWriter() {
+    try {
+        write();
+        m_file.flush();
+    } catch (const CtFileWriteError&) {
+        // nothing to report to from a destructor
+    }
+}
+
+void CtLogBinaryWriter::append(const CtLogRecord& p_record) {
+    auto s_key = std::make_pair(p_record.format, p_record.types);
+    auto s_format = m_formats.find(s_key);
+    if (s_format == m_formats.end()) {
+        CtUInt32 s_id = (CtUInt32)m_formats.size();
+        s_format = m_formats.emplace(s_key, s_id).first;
+        m_buffer.push_back(CT_LOG_BINARY_FORMAT);
+        put(&s_id, sizeof(s_id));
+        put(&p_record.formatLength, sizeof(p_record.formatLength));
+        put(p_record.format, p_record.formatLength);
+        put(&p_record.count, sizeof(p_record.count));
+        put(p_record.types, p_record.count);
+    }
+    m_buffer.push_back(CT_LOG_BINARY_RECORD);
+    put(&s_format->second, sizeof(CtUInt32));
+    put(&p_record.level, sizeof(p_record.level));
+    put(&p_record.time, sizeof(p_record.time));
+    put(&p_record.length, sizeof(p_record.length));
+    put(&p_record + 1, p_record.length);
+}
+
+CtUInt32 CtLogBinaryWriter::pending() const {
+    return (CtUInt32)m_buffer.size();
+}
+
+void CtLogBinaryWriter::write() {
+    if (!m_buffer.empty()) {
+        m_file.writePart(CtRawDataView(reinterpret_cast<const CtUInt8*>(m_buffer.data()), (CtUInt32)m_buffer.size()));
+        m_buffer.clear();
+    }
+}
+
+void CtLogBinaryWriter::put(const void* p_data, CtUInt32 p_size) {
+    m_buffer.append(reinterpret_cast<const char*>(p_data), p_size);
+}
+
+CtLogBinaryReader::CtLogBinaryReader(const CtString& p_fileName) : m_pos(0) {
+    std::ifstream s_file(p_fileName, std::ios::binary);
+    if (!s_file.is_open()) {
+        throw CtFileReadError("File cannot open.");
+    }
+    m_data.assign(std::istreambuf_iterator<char>(s_file), std::istreambuf_iterator<char>());
+
+    char s_magic[8];
+    CtUInt32 s_version;
+    CtUInt32 s_length;
+    if (!get(s_magic, sizeof(s_magic)) || std::memcmp(s_magic, CT_LOG_BINARY_MAGIC, sizeof(s_magic)) != 0 ||
+        !get(&s_version, sizeof(s_version)) || s_version != CT_LOG_BINARY_VERSION || !get(&s_length, sizeof(s_length))) {
+        throw CtFileParseError("File is not a binary log.");
+    }
+    m_component.resize(s_length);
+    if (!get(m_component.data(), s_length)) {
+        throw CtFileParseError("File is not a binary log.");
+    }
+}
+
+const CtString& CtLogBinaryReader::getComponent() const {
+    return m_component;
+}
+
+CtBool CtLogBinaryReader::read(CtString* p_line) {
+    CtUInt8 s_tag;
+    while (get(&s_tag, sizeof(s_tag))) {
+        CtUInt32 s_id;
+        if (!get(&s_id, sizeof(s_id))) {
+            return CT_FALSE;
+        }
+        if (s_tag == CT_LOG_BINARY_FORMAT) {
+            CtLogBinaryFormat s_format;
+            CtUInt32 s_length;
+            CtUInt32 s_count;
+            if (!get(&s_length, sizeof(s_length))) {
+                return CT_FALSE;
+            }
+            s_format.format.resize(s_length);
+            if (!get(s_format.format.data(), s_length) || !get(&s_count, sizeof(s_count))) {
+                return CT_FALSE;
+            }
+            s_format.types.resize(s_count);
+            if (!get(s_format.types.data(), s_count)) {
+                return CT_FALSE;
+            }
+            for (CtLogArgType s_type : s_format.types) {
+                if (s_type > CtLogArgType::Pointer) {
+                    throw CtFileParseError("Unknown argument type in binary log.");
+                }
+            }
+            if (s_id != m_formats.size()) {
+                throw CtFileParseError("Unexpected format id in binary log.");
+            }
+            m_formats.push_back(std::move(s_format));
+        } else if (s_tag == CT_LOG_BINARY_RECORD) {
+            CtUInt32 s_level;
+            CtUInt64 s_time;
+            CtUInt32 s_length;
+            if (!get(&s_level, sizeof(s_level)) || !get(&s_time, sizeof(s_time)) || !get(&s_length, sizeof(s_length))) {
+                return CT_FALSE;
+            }
+            if (m_pos + s_length > m_data.size()) {
+                return CT_FALSE;
+            }
+            if (s_id >= m_formats.size() || s_level > (CtUInt32)CtLogger::Level::CRITICAL) {
+                throw CtFileParseError("Unknown record in binary log.");
+            }
+            const CtLogBinaryFormat& s_format = m_formats[s_id];
+            if (!argsFit(s_format.types, m_data.data() + m_pos, s_length)) {
+                throw CtFileParseError("Corrupted record in binary log.");
+            }
+            m_message.clear();
+            CtLogFormatter::format(&m_message, s_format.format, s_format.types.data(), (CtUInt32)s_format.types.size(), m_data.data() + m_pos);
+            m_pos += s_length;
+            p_line->clear();
+            CtLogger::generateLoggerMsg(p_line, (CtLogger::Level)s_level, m_component, m_message, s_time, CtLogTimestamp::local());
+            return CT_TRUE;
+        } else {
+            throw CtFileParseError("Unknown entry in binary log.");
+        }
+    }
+    return CT_FALSE;
+}
+
+CtBool CtLogBinaryReader::get(void* p_data, CtUInt32 p_size) {
+    if (m_pos + p_size > m_data.size()) {
+        return CT_FALSE;
+    }
+    std::memcpy(p_data, m_data.data() + m_pos, p_size);
+    m_pos += p_size;
+    return CT_TRUE;
+}
@@ -0,0 +1,128 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogContext.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "utils/CtLogContext.hpp"
+#include "utils/CtLogFormat.hpp"
+
+#include <cstring>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+thread_local CtString t_context;        /**< The encoded context of the thread. */
+
+void appendEncoded(CtString* p_out, std::string_view p_text) {
+    CtUInt32 s_length = (CtUInt32)p_text.size();
+    p_out->append(reinterpret_cast<const char*>(&s_length), sizeof(s_length));
+    p_out->append(p_text);
+}
+
+CtBool readEncoded(std::string_view* p_data, std::string_view* p_text) {
+    CtUInt32 s_length;
+    if (p_data->size() < sizeof(s_length)) {
+        return CT_FALSE;
+    }
+    std::memcpy(&s_length, p_data->data(), sizeof(s_length));
+    if (p_data->size() - sizeof(s_length) < s_length) {
+        return CT_FALSE;
+    }
+    *p_text = p_data->substr(sizeof(s_length), s_length);
+    p_data->remove_prefix(sizeof(s_length) + s_length);
+    return CT_TRUE;
+}
+
+void appendLogfmtKey(CtString* p_out, std::string_view p_key) {
+    // logfmt keys cannot be quoted, the characters that would end the key are replaced
+    if (p_key.empty()) {
+        p_out->push_back('_');
+    }
+    for (char s_char : p_key) {
+        unsigned char s_byte = (unsigned char)s_char;
+        CtBool s_invalid = (s_byte <= ' ' || s_byte == '"' || s_byte == '=' || s_byte == '\\' || s_byte == 0x7F);
+        p_out->push_back(s_invalid ? '_' : s_char);
+    }
+}
+
+} // namespace
+
+CtLogContext::Scope::Scope(const CtLogContext& p_context) : m_previous(t_context) {
+    t_context = p_context.m_data;
+}
+
+CtLogContext::Scope::~Scope() {
+    t_context.swap(m_previous);
+}
+
+CtLogContext::CtLogContext() {
+}
+
+CtLogContext& CtLogContext::add(std::string_view p_key, std::string_view p_value) {
+    appendEncoded(&m_data, p_key);
+    appendEncoded(&m_data, p_value);
+    return *this;
+}
+
+std::string_view CtLogContext::data() const {
+    return m_data;
+}
+
+std::function<void()> CtLogContext::wrap(std::function<void()> p_func) const {
+    return [context = *this, func = std::move(p_func)]() {
+        CtLogContext::Scope s_scope(context);
+        func();
+    };
+}
+
+std::string_view CtLogContext::current() {
+    return t_context;
+}
+
+CtUInt32 CtLogContext::threadId() {
+    thread_local CtUInt32 t_id = (CtUInt32)syscall(SYS_gettid);
+    return t_id;
+}
+
+void CtLogContext::format(CtString* p_out, std::string_view p_data, CtBool p_json) {
+    std::string_view s_key;
+    std::string_view s_value;
+    while (readEncoded(&p_data, &s_key) && readEncoded(&p_data, &s_value)) {
+        if (p_json) {
+            p_out->push_back(',');
+            CtLogFormatter::appendString(p_out, s_key, CT_TRUE);
+            p_out->push_back(':');
+        } else {
+            p_out->push_back(' ');
+            appendLogfmtKey(p_out, s_key);
+            p_out->push_back('=');
+        }
+        CtLogFormatter::appendString(p_out, s_value, p_json);
+    }
+}
@@ -0,0 +1,296 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogFormat.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "utils/CtLogFormat.hpp"
+
+#include <charconv>
+#include <cmath>
+
+namespace {
+
+template <typename T>
+const CtUInt8* appendInteger(CtString* p_out, const CtUInt8* p_data, CtBool p_hex) {
+    T s_value;
+    std::memcpy(&s_value, p_data, sizeof(T));
+    char s_text[24];
+    std::to_chars_result s_result = p_hex ? std::to_chars(s_text, s_text + sizeof(s_text), s_value, 16)
+                                          : std::to_chars(s_text, s_text + sizeof(s_text), s_value);
+    p_out->append(s_text, s_result.ptr - s_text);
+    return p_data + sizeof(T);
+}
+
+template <typename T>
+const CtUInt8* appendFloating(CtString* p_out, const CtUInt8* p_data, CtInt32 p_precision) {
+    T s_value;
+    std::memcpy(&s_value, p_data, sizeof(T));
+    char s_text[64];
+    std::to_chars_result s_result = p_precision < 0
+        ? std::to_chars(s_text, s_text + sizeof(s_text), s_value)
+        : std::to_chars(s_text, s_text + sizeof(s_text), s_value, std::chars_format::fixed, p_precision);
+    if (s_result.ec == std::errc()) {
+        p_out->append(s_text, s_result.ptr - s_text);
+    } else {
+        p_out->append(std::to_string(s_value));
+    }
+    return p_data + sizeof(T);
+}
+
+const CtUInt8* appendArg(CtString* p_out, CtLogArgType p_type, const CtUInt8* p_data, std::string_view p_spec) {
+    CtBool s_hex = (p_spec == ":x");
+    CtInt32 s_precision = -1;
+    if (p_spec.size() > 2 && p_spec[1] == '.') {
+        std::from_chars(p_spec.data() + 2, p_spec.data() + p_spec.size(), s_precision);
+    }
+    switch (p_type) {
+        case CtLogArgType::Bool:
+            p_out->append(*p_data ? "true" : "false");
+            return p_data + 1;
+        case CtLogArgType::Char:
+            p_out->push_back((char)*p_data);
+            return p_data + 1;
+        case CtLogArgType::Int8:
+            return appendInteger<CtInt8>(p_out, p_data, s_hex);
+        case CtLogArgType::Int16:
+            return appendInteger<CtInt16>(p_out, p_data, s_hex);
+        case CtLogArgType::Int32:
+            return appendInteger<CtInt32>(p_out, p_data, s_hex);
+        case CtLogArgType::Int64:
+            return appendInteger<CtInt64>(p_out, p_data, s_hex);
+        case CtLogArgType::UInt8:
+            return appendInteger<CtUInt8>(p_out, p_data, s_hex);
+        case CtLogArgType::UInt16:
+            return appendInteger<CtUInt16>(p_out, p_data, s_hex);
+        case CtLogArgType::UInt32:
+            return appendInteger<CtUInt32>(p_out, p_data, s_hex);
+        case CtLogArgType::UInt64:
+            return appendInteger<CtUInt64>(p_out, p_data, s_hex);
+        case CtLogArgType::Float:
+            return appendFloating<CtFloat>(p_out, p_data, s_precision);
+        case CtLogArgType::Double:
+            return appendFloating<CtDouble>(p_out, p_data, s_precision);
+        case CtLogArgType::String: {
+            CtUInt32 s_length;
+            std::memcpy(&s_length, p_data, sizeof(s_length));
+            p_out->append(reinterpret_cast<const char*>(p_data + sizeof(s_length)), s_length);
+            return p_data + sizeof(s_length) + s_length;
+        }
+        case CtLogArgType::Pointer:
+            p_out->append("0x");
+            return appendInteger<CtUInt64>(p_out, p_data, CT_TRUE);
+    }
+    return p_data;
+}
+
+const CtUInt8* appendField(CtString* p_out, CtLogArgType p_type, const CtUInt8* p_data, std::string_view p_spec, CtBool p_json) {
+    CtBool s_quoted = p_json && (p_spec == ":x");
+    switch (p_type) {
+        case CtLogArgType::Char:
+            CtLogFormatter::appendString(p_out, std::string_view(reinterpret_cast<const char*>(p_data), 1), p_json);
+            return p_data + 1;
+        case CtLogArgType::String: {
+            CtUInt32 s_length;
+            std::memcpy(&s_length, p_data, sizeof(s_length));
+            CtLogFormatter::appendString(p_out, std::string_view(reinterpret_cast<const char*>(p_data + sizeof(s_length)), s_length), p_json);
+            return p_data + sizeof(s_length) + s_length;
+        }
+        case CtLogArgType::Float: {
+            CtFloat s_value;
+            std::memcpy(&s_value, p_data, sizeof(s_value));
+            s_quoted = p_json && !std::isfinite(s_value);
+            break;
+        }
+        case CtLogArgType::Double: {
+            CtDouble s_value;
+            std::memcpy(&s_value, p_data, sizeof(s_value));
+            s_quoted = p_json && !std::isfinite(s_value);
+            break;
+        }
+        case CtLogArgType::Pointer:
+            s_quoted = p_json;
+            break;
+        default:
+            break;
+    }
+    if (s_quoted) {
+        p_out->push_back('"');
+    }
+    p_data = appendArg(p_out, p_type, p_data, p_spec);
+    if (s_quoted) {
+        p_out->push_back('"');
+    }
+    return p_data;
+}
+
+const CtUInt8* skipArg(CtLogArgType p_type, const CtUInt8* p_data) {
+    switch (p_type) {
+        case CtLogArgType::Bool:
+        case CtLogArgType::Char:
+        case CtLogArgType::Int8:
+        case CtLogArgType::UInt8:
+            return p_data + 1;
+        case CtLogArgType::Int16:
+        case CtLogArgType::UInt16:
+            return p_data + 2;
+        case CtLogArgType::Int32:
+        case CtLogArgType::UInt32:
+        case CtLogArgType::Float:
+            return p_data + 4;
+        case CtLogArgType::Int64:
+        case CtLogArgType::UInt64:
+        case CtLogArgType::Double:
+        case CtLogArgType::Pointer:
+            return p_data + 8;
+        case CtLogArgType::String: {
+            CtUInt32 s_length;
+            std::memcpy(&s_length, p_data, sizeof(s_length));
+            return p_data + sizeof(s_length) + s_length;
+        }
+    }
+    return p_data;
+}
+
+} // namespace
+
+const CtUInt8* CtLogFormatter::format(CtString* p_out, std::string_view p_format, const CtLogArgType* p_types, CtUInt32 p_count, const CtUInt8* p_data) {
+    CtUInt32 s_arg = 0;
+    size_t s_begin = 0;
+    for (size_t idx = 0; idx < p_format.size(); idx++) {
+        char s_char = p_format[idx];
+        if (s_char != '{' && s_char != '}') {
+            continue;
+        }
+        p_out->append(p_format.substr(s_begin, idx - s_begin));
+        if (idx + 1 < p_format.size() && p_format[idx + 1] == s_char) {
+            p_out->push_back(s_char);
+            idx++;
+        } else {
+            size_t s_end = p_format.find('}', idx);
+            if (s_end == std::string_view::npos) {
+                s_end = p_format.size() - 1;
+            }
+            if (s_arg < p_count) {
+                std::string_view s_name;
+                std::string_view s_spec;
+                splitPlaceholder(p_format.substr(idx + 1, s_end - idx - 1), &s_name, &s_spec);
+                p_data = appendArg(p_out, p_types[s_arg], p_data, s_spec);
+                s_arg++;
+            }
+            idx = s_end;
+        }
+        s_begin = idx + 1;
+    }
+    if (s_begin < p_format.size()) {
+        p_out->append(p_format.substr(s_begin));
+    }
+    return p_data;
+}
+
+const CtUInt8* CtLogFormatter::formatFields(CtString* p_out, std::string_view p_format, const CtLogArgType* p_types, CtUInt32 p_count, const CtUInt8* p_data, CtBool p_json) {
+    CtUInt32 s_arg = 0;
+    for (size_t idx = 0; idx < p_format.size() && s_arg < p_count; idx++) {
+        if (p_format[idx] != '{') {
+            continue;
+        }
+        if (idx + 1 < p_format.size() && p_format[idx + 1] == '{') {
+            idx++;
+            continue;
+        }
+        size_t s_end = p_format.find('}', idx);
+        if (s_end == std::string_view::npos) {
+            break;
+        }
+        std::string_view s_name;
+        std::string_view s_spec;
+        splitPlaceholder(p_format.substr(idx + 1, s_end - idx - 1), &s_name, &s_spec);
+        if (s_name.empty()) {
+            p_data = skipArg(p_types[s_arg], p_data);
+        } else {
+            if (p_json) {
+                p_out->append(",\"");
+                p_out->append(s_name);
+                p_out->append("\":");
+            } else {
+                p_out->push_back(' ');
+                p_out->append(s_name);
+                p_out->push_back('=');
+            }
+            p_data = appendField(p_out, p_types[s_arg], p_data, s_spec, p_json);
+        }
+        s_arg++;
+        idx = s_end;
+    }
+    return p_data;
+}
+
+void CtLogFormatter::appendString(CtString* p_out, std::string_view p_value, CtBool p_json) {
+    CtBool s_quoted = p_json || p_value.empty();
+    for (size_t idx = 0; idx < p_value.size() && !s_quoted; idx++) {
+        unsigned char s_char = (unsigned char)p_value[idx];
+        s_quoted = (s_char <= ' ' || s_char == '"' || s_char == '=' || s_char == '\\' || s_char == 0x7F);
+    }
+    if (!s_quoted) {
+        p_out->append(p_value);
+        return;
+    }
+    static const char s_hex[] = "0123456789abcdef";
+    p_out->push_back('"');
+    size_t s_begin = 0;
+    for (size_t idx = 0; idx < p_value.size(); idx++) {
+        unsigned char s_char = (unsigned char)p_value[idx];
+        if (s_char >= 0x20 && s_char != '"' && s_char != '\\') {
+            continue;
+        }
+        p_out->append(p_value.substr(s_begin, idx - s_begin));
+        p_out->push_back('\\');
+        switch (s_char) {
+            case '"':
+            case '\\':
+                p_out->push_back((char)s_char);
+                break;
+            case '\n':
+                p_out->push_back('n');
+                break;
+            case '\r':
+                p_out->push_back('r');
+                break;
+            case '\t':
+                p_out->push_back('t');
+                break;
+            default:
+                p_out->append("u00");
+                p_out->push_back(s_hex[s_char >> 4]);
+                p_out->push_back(s_hex[s_char & 0xF]);
+                break;
+        }
+        s_begin = idx + 1;
+    }
+    p_out->append(p_value.substr(s_begin));
+    p_out->push_back('"');
+}
@@ -0,0 +1,319 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogSink.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "utils/CtLogSink.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <filesystem>
+#include <unistd.h>
+
+namespace {
+
+std::atomic<CtLogMemorySink*> s_memorySinks[CT_LOG_MEMORY_SINKS];
+
+void writeAll(CtInt32 p_fd, std::string_view p_data) {
+    while (!p_data.empty()) {
+        ssize_t s_written = ::write(p_fd, p_data.data(), p_data.size());
+        if (s_written <= 0) {
+            return;
+        }
+        p_data.remove_prefix(s_written);
+    }
+}
+
+void crashHandler(CtInt32 p_signal) {
+    writeAll(STDERR_FILENO, "---- log memory dump ----\n");
+    for (auto& s_slot : s_memorySinks) {
+        CtLogMemorySink* s_sink = s_slot.load();
+        if (s_sink != nullptr) {
+            s_sink->dump(STDERR_FILENO);
+        }
+    }
+    std::signal(p_signal, SIG_DFL);
+    std::raise(p_signal);
+}
+
+} // namespace
+
+CtLogSink::CtLogSink(CtLogger::Level p_level) : m_level(p_level) {
+}
+
+CtLogSink::~CtLogSink() {
+}
+
+void CtLogSink::setLevel(CtLogger::Level p_level) {
+    m_level.store(p_level);
+}
+
+CtBool CtLogSink::isEnabled(CtLogger::Level p_level) const {
+    return p_level >= m_level.load(std::memory_order_relaxed);
+}
+
+void CtLogSink::log(CtLogger::Level p_level, CtUInt64 p_time, std::string_view p_line) {
+    if (!isEnabled(p_level)) {
+        return;
+    }
+    std::scoped_lock lock(m_mtx_control);
+    try {
+        writeLine(p_level, p_time, p_line);
+    } catch (const CtException&) {
+        // logging never throws, the line is lost
+    }
+}
+
+void CtLogSink::flush() {
+    std::scoped_lock lock(m_mtx_control);
+    try {
+        flushLines();
+    } catch (const CtException&) {
+        // logging never throws, the lines are lost
+    }
+}
+
+void CtLogSink::flushLines() {
+}
+
+CtLogConsoleSink::CtLogConsoleSink(CtLogger::Level p_level, CtBool p_stderr) :
+    CtLogSink(p_level), m_stream(p_stderr ? std::cerr : std::cout) {
+}
+
+void CtLogConsoleSink::writeLine(CtLogger::Level p_level, CtUInt64 p_time, std::string_view p_line) {
+    (void)p_level;
+    (void)p_time;
+    m_stream.write(p_line.data(), p_line.size());
+    m_stream.put('\n');
+}
+
+void CtLogConsoleSink::flushLines() {
+    m_stream.flush();
+}
+
+CtLogFileSink::CtLogFileSink(const CtString& p_fileName, CtLogger::Level p_level) :
+    CtLogSink(p_level), m_fileName(p_fileName), m_size(0), m_opened(0), m_maxSize(0), m_maxAge(0), m_maxFiles(5) {
+    open(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+CtLogFileSink::~CtLogFileSink() {
+    try {
+        flushLines();
+    } catch (const CtException&) {
+        // nothing to report to from a destructor
+    }
+}
+
+void CtLogFileSink::setMaxSize(CtUInt64 p_size) {
+    m_maxSize.store(p_size);
+}
+
+void CtLogFileSink::setMaxAge(CtUInt32 p_seconds) {
+    m_maxAge.store((CtUInt64)p_seconds * 1000000000u);
+}
+
+void CtLogFileSink::setMaxFiles(CtUInt32 p_files) {
+    m_maxFiles.store(p_files);
+}
+
+void CtLogFileSink::writeLine(CtLogger::Level p_level, CtUInt64 p_time, std::string_view p_line) {
+    (void)p_level;
+    CtUInt64 s_maxSize = m_maxSize.load(std::memory_order_relaxed);
+    CtUInt64 s_maxAge = m_maxAge.load(std::memory_order_relaxed);
+    if ((s_maxSize != 0 && m_size != 0 && m_size + p_line.size() + 1 > s_maxSize) ||
+        (s_maxAge != 0 && p_time >= m_opened + s_maxAge)) {
+        rotate(p_time);
+    }
+    m_buffer.append(p_line);
+    m_buffer.push_back('\n');
+    m_size += p_line.size() + 1;
+}
+
+void CtLogFileSink::flushLines() {
+    if (!m_buffer.empty()) {
+        m_file->writePart(CtRawDataView(reinterpret_cast<const CtUInt8*>(m_buffer.data()), (CtUInt32)m_buffer.size()));
+        m_buffer.clear();
+    }
+}
+
+void CtLogFileSink::open(CtUInt64 p_time) {
+    m_file = std::make_unique<CtFileOutput>(m_fileName, CtFileOutput::WriteMode::Append);
+    std::error_code s_error;
+    m_size = std::filesystem::file_size(m_fileName, s_error);
+    if (s_error) {
+        m_size = 0;
+    }
+    m_opened = p_time;
+}
+
+void CtLogFileSink::rotate(CtUInt64 p_time) {
+    flushLines();
+    m_file.reset();
+    CtUInt32 s_files = m_maxFiles.load();
+    std::error_code s_error;
+    if (s_files == 0) {
+        std::filesystem::remove(m_fileName, s_error);
+    } else {
+        std::filesystem::remove(m_fileName + "." + std::to_string(s_files), s_error);
+        for (CtUInt32 idx = s_files - 1; idx > 0; idx--) {
+            std::filesystem::rename(m_fileName + "." + std::to_string(idx), m_fileName + "." + std::to_string(idx + 1), s_error);
+        }
+        std::filesystem::rename(m_fileName, m_fileName + ".1", s_error);
+    }
+    open(p_time);
+}
+
+CtLogUdpSink::CtLogUdpSink(const CtNetAddress& p_address, CtLogger::Level p_level, CtUInt8 p_facility) :
+    CtLogSink(p_level), m_socket(p_address.getFamily() == AF_INET6 ? CtNetFamily::Ipv6 : CtNetFamily::Ipv4), m_facility(p_facility) {
+    m_socket.setPub(p_address);
+}
+
+void CtLogUdpSink::writeLine(CtLogger::Level p_level, CtUInt64 p_time, std::string_view p_line) {
+    (void)p_time;
+    static const CtUInt32 s_severities[] = { 7, 6, 4, 3, 2 };
+    m_buffer.push_back('<');
+    m_buffer.append(std::to_string(m_facility * 8u + s_severities[(CtUInt32)p_level]));
+    m_buffer.push_back('>');
+    m_buffer.append(p_line.substr(0, CT_LOG_UDP_MAX_LINE));
+    m_ends.push_back((CtUInt32)m_buffer.size());
+}
+
+void CtLogUdpSink::flushLines() {
+    if (m_ends.empty()) {
+        return;
+    }
+    m_views.clear();
+    CtUInt32 s_begin = 0;
+    for (CtUInt32 s_end : m_ends) {
+        m_views.emplace_back(reinterpret_cast<const CtUInt8*>(m_buffer.data()) + s_begin, s_end - s_begin);
+        s_begin = s_end;
+    }
+    m_ends.clear();
+    CtUInt32 s_sent = 0;
+    try {
+        while (s_sent < m_views.size()) {
+            CtUInt32 s_count = m_socket.sendBatch(m_views.data() + s_sent, (CtUInt32)m_views.size() - s_sent);
+            if (s_count == 0) {
+                break;
+            }
+            s_sent += s_count;
+        }
+    } catch (const CtException&) {
+        m_buffer.clear();
+        throw;
+    }
+    m_buffer.clear();
+}
+
+CtLogMemorySink::CtLogMemorySink(CtUInt32 p_capacity, CtLogger::Level p_level) :
+    CtLogSink(p_level), m_data(std::max<CtUInt32>(p_capacity, 1)), m_written(0), m_dumpLevel(CtLogger::Level::CRITICAL) {
+    for (auto& s_slot : s_memorySinks) {
+        CtLogMemorySink* s_empty = nullptr;
+        if (s_slot.compare_exchange_strong(s_empty, this)) {
+            break;
+        }
+    }
+}
+
+CtLogMemorySink::~CtLogMemorySink() {
+    for (auto& s_slot : s_memorySinks) {
+        CtLogMemorySink* s_self = this;
+        s_slot.compare_exchange_strong(s_self, nullptr);
+    }
+}
+
+void CtLogMemorySink::setDumpLevel(CtLogger::Level p_level) {
+    m_dumpLevel.store(p_level);
+}
+
+CtString CtLogMemorySink::getLines() {
+    std::scoped_lock lock(m_mtx_control);
+    std::string_view s_first;
+    std::string_view s_second;
+    parts(&s_first, &s_second);
+    return CtString(s_first) + CtString(s_second);
+}
+
+void CtLogMemorySink::dump(CtInt32 p_fd) {
+    std::string_view s_first;
+    std::string_view s_second;
+    parts(&s_first, &s_second);
+    writeAll(p_fd, s_first);
+    writeAll(p_fd, s_second);
+}
+
+void CtLogMemorySink::installCrashHandler() {
+    for (CtInt32 s_signal : { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT }) {
+        std::signal(s_signal, crashHandler);
+    }
+}
+
+void CtLogMemorySink::writeLine(CtLogger::Level p_level, CtUInt64 p_time, std::string_view p_line) {
+    (void)p_time;
+    CtUInt64 s_capacity = m_data.size();
+    CtUInt64 s_written = m_written.load(std::memory_order_relaxed);
+    for (std::string_view s_part : { p_line, std::string_view("\n") }) {
+        if (s_part.size() > s_capacity) {
+            s_written += s_part.size() - s_capacity;
+            s_part.remove_prefix(s_part.size() - s_capacity);
+        }
+        CtUInt64 s_offset = s_written % s_capacity;
+        CtUInt64 s_head = std::min<CtUInt64>(s_part.size(), s_capacity - s_offset);
+        std::memcpy(m_data.data() + s_offset, s_part.data(), s_head);
+        std::memcpy(m_data.data(), s_part.data() + s_head, s_part.size() - s_head);
+        s_written += s_part.size();
+    }
+    m_written.store(s_written, std::memory_order_release);
+    if (p_level >= m_dumpLevel.load(std::memory_order_relaxed)) {
+        dump(STDERR_FILENO);
+    }
+}
+
+void CtLogMemorySink::parts(std::string_view* p_first, std::string_view* p_second) const {
+    CtUInt64 s_written = m_written.load(std::memory_order_acquire);
+    CtUInt64 s_capacity = m_data.size();
+    if (s_written <= s_capacity) {
+        *p_first = std::string_view(m_data.data(), s_written);
+        *p_second = std::string_view();
+        return;
+    }
+    CtUInt64 s_offset = s_written % s_capacity;
+    *p_first = std::string_view(m_data.data() + s_offset, s_capacity - s_offset);
+    *p_second = std::string_view(m_data.data(), s_offset);
+    // the oldest line was partly overwritten, start after its end
+    size_t s_end = p_first->find('\n');
+    if (s_end != std::string_view::npos) {
+        p_first->remove_prefix(s_end + 1);
+    } else {
+        s_end = p_second->find('\n');
+        *p_first = std::string_view();
+        p_second->remove_prefix(s_end == std::string_view::npos ? p_second->size() : s_end + 1);
+    }
+}
@@ -0,0 +1,168 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file CtLogTimestamp.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include "utils/CtLogTimestamp.hpp"
+
+#include <ctime>
+#include <limits>
+#include <optional>
+
+#define CT_LOG_OFFSET_PERIOD    900     /**< Seconds between two reads of the UTC offset; time zones change on quarters of an hour. */
+
+namespace {
+
+/**
+ * @brief Write a number as a fixed count of decimal digits.
+ */
+inline void writeDigits(char* p_dst, CtUInt32 p_value, CtUInt32 p_digits) {
+    for (CtUInt32 i = p_digits; i > 0; --i) {
+        p_dst[i - 1] = (char)('0' + p_value % 10);
+        p_value /= 10;
+    }
+}
+
+/**
+ * @brief Floor division, correct for times before the epoch.
+ */
+inline CtInt64 floorDiv(CtInt64 p_value, CtInt64 p_divisor) {
+    CtInt64 s_quotient = p_value / p_divisor;
+    return (p_value % p_divisor < 0) ? s_quotient - 1 : s_quotient;
+}
+
+} // namespace
+
+CtLogTimestamp::CtLogTimestamp(Precision p_precision, Zone p_zone, Style p_style)
+    : m_precision(p_precision), m_zone(p_zone), m_style(p_style), m_offset(0),
+      m_offsetUntil(std::numeric_limits<CtInt64>::min()),
+      m_minute(std::numeric_limits<CtInt64>::min()),
+      m_second(std::numeric_limits<CtInt64>::min()),
+      m_length(0), m_buffer{} {
+    if (m_zone == Zone::Utc) {
+        m_offsetUntil = std::numeric_limits<CtInt64>::max();
+    }
+}
+
+std::string_view CtLogTimestamp::format(CtUInt64 p_time) {
+    CtInt64 s_seconds = (CtInt64)(p_time / 1000000000u);
+    CtUInt32 s_nanoseconds = (CtUInt32)(p_time % 1000000000u);
+
+    if (s_seconds >= m_offsetUntil || s_seconds < m_offsetUntil - CT_LOG_OFFSET_PERIOD) {
+        updateOffset(s_seconds);
+    }
+
+    CtInt64 s_local = s_seconds + m_offset;
+    if (s_local != m_second) {
+        CtInt64 s_minute = floorDiv(s_local, 60);
+        if (s_minute != m_minute) {
+            updateMinute(s_minute);
+        }
+        writeDigits(m_buffer + 17, (CtUInt32)(s_local - s_minute * 60), 2);
+        m_second = s_local;
+    }
+
+    switch (m_precision) {
+        case Precision::Milliseconds:
+            writeDigits(m_buffer + 20, s_nanoseconds / 1000000u, 3);
+            break;
+        case Precision::Microseconds:
+            writeDigits(m_buffer + 20, s_nanoseconds / 1000u, 6);
+            break;
+        default:
+            break;
+    }
+    return std::string_view(m_buffer, m_length);
+}
+
+CtLogTimestamp& CtLogTimestamp::local(Precision p_precision, Zone p_zone, Style p_style) {
+    thread_local std::optional<CtLogTimestamp> s_cache[3][2][2];
+    std::optional<CtLogTimestamp>& s_timestamp = s_cache[(int)p_precision][(int)p_zone][(int)p_style];
+    if (!s_timestamp.has_value()) {
+        s_timestamp.emplace(p_precision, p_zone, p_style);
+    }
+    return *s_timestamp;
+}
+
+void CtLogTimestamp::updateOffset(CtInt64 p_seconds) {
+    std::time_t s_time = (std::time_t)p_seconds;
+    std::tm s_local;
+    CtInt64 s_offset = (localtime_r(&s_time, &s_local) != nullptr) ? (CtInt64)s_local.tm_gmtoff : 0;
+    m_offsetUntil = (floorDiv(p_seconds, CT_LOG_OFFSET_PERIOD) + 1) * CT_LOG_OFFSET_PERIOD;
+    if (s_offset != m_offset) {
+        m_offset = s_offset;
+        m_minute = std::numeric_limits<CtInt64>::min();
+        m_second = std::numeric_limits<CtInt64>::min();
+    }
+}
+
+void CtLogTimestamp::updateMinute(CtInt64 p_minute) {
+    /* Civil date from days since the epoch in the proleptic Gregorian calendar. */
+    CtInt64 s_days = floorDiv(p_minute, 1440);
+    CtUInt32 s_minuteOfDay = (CtUInt32)(p_minute - s_days * 1440);
+    CtInt64 s_shifted = s_days + 719468;
+    CtInt64 s_era = floorDiv(s_shifted, 146097);
+    CtUInt32 s_dayOfEra = (CtUInt32)(s_shifted - s_era * 146097);
+    CtUInt32 s_yearOfEra = (s_dayOfEra - s_dayOfEra / 1460 + s_dayOfEra / 36524 - s_dayOfEra / 146096) / 365;
+    CtUInt32 s_dayOfYear = s_dayOfEra - (365 * s_yearOfEra + s_yearOfEra / 4 - s_yearOfEra / 100);
+    CtUInt32 s_monthIndex = (5 * s_dayOfYear + 2) / 153;
+    CtUInt32 s_day = s_dayOfYear - (153 * s_monthIndex + 2) / 5 + 1;
+    CtUInt32 s_month = (s_monthIndex < 10) ? s_monthIndex + 3 : s_monthIndex - 9;
+    CtInt64 s_year = (CtInt64)s_yearOfEra + s_era * 400 + ((s_month <= 2) ? 1 : 0);
+
+    writeDigits(m_buffer, (CtUInt32)s_year, 4);
+    m_buffer[4] = '-';
+    writeDigits(m_buffer + 5, s_month, 2);
+    m_buffer[7] = '-';
+    writeDigits(m_buffer + 8, s_day, 2);
+    m_buffer[10] = (m_style == Style::Iso8601) ? 'T' : ' ';
+    writeDigits(m_buffer + 11, s_minuteOfDay / 60, 2);
+    m_buffer[13] = ':';
+    writeDigits(m_buffer + 14, s_minuteOfDay % 60, 2);
+    m_buffer[16] = ':';
+    m_length = 19;
+
+    if (m_precision != Precision::Seconds) {
+        m_buffer[m_length] = '.';
+        m_length += (m_precision == Precision::Milliseconds) ? 4 : 7;
+    }
+
+    if (m_style == Style::Iso8601) {
+        if (m_zone == Zone::Utc) {
+            m_buffer[m_length++] = 'Z';
+        } else {
+            CtInt64 s_offset = (m_offset < 0) ? -m_offset : m_offset;
+            m_buffer[m_length] = (m_offset < 0) ? '-' : '+';
+            writeDigits(m_buffer + m_length + 1, (CtUInt32)(s_offset / 3600), 2);
+            m_buffer[m_length + 3] = ':';
+            writeDigits(m_buffer + m_length + 4, (CtUInt32)(s_offset / 60 % 60), 2);
+            m_length += 6;
+        }
+    }
+    m_minute = p_minute;
+}
@@ -30,48 +30,175 @@ SOFTWARE.
  */
 
 #include "utils/CtLogger.hpp"
+#include "utils/CtLogSink.hpp"
 
-CtLogger::CtLogger(CtLogger::Level level, const CtString& componentName) : m_level(level), m_componentName(componentName) {
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+CtLogger::CtLogger(CtLogger::Level level, const CtString& componentName) : m_level(level), m_componentName(componentName), m_backend(nullptr),
+    m_timestampPrecision(CtLogTimestamp::Precision::Seconds), m_timestampZone(CtLogTimestamp::Zone::Local),
+    m_timestampStyle(CtLogTimestamp::Style::Classic), m_encoding(CtLogger::Encoding::Text) {
 }
 
 CtLogger::~CtLogger() {
+    if (m_backend.load() != nullptr) {
+        m_backend.load()->flush();
+    }
+}
+
+void CtLogger::setMode(CtLogger::Mode p_mode) {
+    CtLogBackend* previous = m_backend.exchange(p_mode == CtLogger::Mode::Async ? &CtLogBackend::instance() : nullptr);
+    // queued records point to this logger, they are written before it can be destroyed in synchronous mode
+    if (previous != nullptr && m_backend.load() == nullptr) {
+        previous->flush();
+    }
+}
+
+void CtLogger::setBinaryOutput(const CtString& p_fileName) {
+    m_binaryOutput = std::make_unique<CtLogBinaryWriter>(p_fileName, m_componentName);
+    setMode(CtLogger::Mode::Async);
+}
+
+void CtLogger::addSink(std::shared_ptr<CtLogSink> p_sink) {
+    m_sinks.push_back(std::move(p_sink));
+}
+
+void CtLogger::setEncoding(CtLogger::Encoding p_encoding) {
+    m_encoding = p_encoding;
+    if (p_encoding != CtLogger::Encoding::Text) {
+        setTimestamp(CtLogTimestamp::Precision::Microseconds, CtLogTimestamp::Zone::Utc, CtLogTimestamp::Style::Iso8601);
+    }
+}
+
+void CtLogger::setTimestamp(CtLogTimestamp::Precision p_precision, CtLogTimestamp::Zone p_zone, CtLogTimestamp::Style p_style) {
+    m_timestampPrecision = p_precision;
+    m_timestampZone = p_zone;
+    m_timestampStyle = p_style;
 }
 
 void CtLogger::log_debug(const CtString& message) {
-    log(CtLogger::Level::DEBUG, message);
+    log(CtLogger::Level::DEBUG, "{}", message);
 }
 
 void CtLogger::log_info(const CtString& message) {
-    log(CtLogger::Level::INFO, message);
+    log(CtLogger::Level::INFO, "{}", message);
 }
 
 void CtLogger::log_warning(const CtString& message) {
-    log(CtLogger::Level::WARNING, message);
+    log(CtLogger::Level::WARNING, "{}", message);
 }
 
 void CtLogger::log_error(const CtString& message) {
-    log(CtLogger::Level::ERROR, message);
+    log(CtLogger::Level::ERROR, "{}", message);
 }
 
 void CtLogger::log_critical(const CtString& message) {
-    log(CtLogger::Level::CRITICAL, message);
+    log(CtLogger::Level::CRITICAL, "{}", message);
 }
 
-void CtLogger::log(CtLogger::Level level, const CtString& message) {
-    std::scoped_lock lock(m_mtx_control);
-    if (level >= m_level) {
-        CtString logEntry = generateLoggerMsg(level, m_componentName, message);
-        std::cout << logEntry << std::endl;
+CtLogRecord* CtLogger::reserve(CtLogBackend* backend, CtLogger::Level level, std::string_view format, const CtLogArgType* types, CtUInt32 count, CtUInt32 length) {
+    std::string_view context;
+    if (m_encoding != CtLogger::Encoding::Text && m_binaryOutput == nullptr) {
+        context = CtLogContext::current();
+        if (length + context.size() > backend->maxLength()) {
+            context = std::string_view();
+        }
+    }
+    CtLogRecord* record = backend->reserve(length + (CtUInt32)context.size());
+    if (record != nullptr) {
+        record->length = length;
+        record->thread = CtLogContext::threadId();
+        record->context = (CtUInt32)context.size();
+        std::memcpy(reinterpret_cast<CtUInt8*>(record + 1) + length, context.data(), context.size());
+        record->time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        record->logger = this;
+        record->level = (CtUInt32)level;
+        record->count = count;
+        record->format = format.data();
+        record->formatLength = (CtUInt32)format.size();
+        record->types = types;
+    }
+    return record;
+}
+
+void CtLogger::logFormatted(CtLogger::Level level, std::string_view format, const CtLogArgType* types, CtUInt32 count, const CtUInt8* data) {
+    CtString message;
+    CtLogFormatter::format(&message, format, types, count, data);
+    CtLogBackend* backend = m_backend.load(std::memory_order_relaxed);
+    if (backend != nullptr && backend->isActive()) {
+        // too large for a record, queued as truncated text
+        std::string_view text(message);
+        log(level, "{}", text.substr(0, backend->maxLength() - sizeof(CtUInt32)));
+        return;
     }
+    CtUInt64 now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    CtString logEntry;
+    if (m_encoding == CtLogger::Encoding::Text) {
+        generateLoggerMsg(&logEntry, level, m_componentName, message, now, timestamp());
+    } else {
+        generateStructuredMsg(&logEntry, level, now, CtLogContext::threadId(), message, format, types, count, data,
+                              CtLogContext::current());
+    }
+    if (!m_sinks.empty()) {
+        for (const auto& sink : m_sinks) {
+            if (sink->isEnabled(level)) {
+                sink->log(level, now, logEntry);
+                sink->flush();
+            }
+        }
+        return;
+    }
+    std::scoped_lock lock(m_mtx_control);
+    std::cout << logEntry << std::endl;
 }
 
-const CtString CtLogger::generateLoggerMsg(CtLogger::Level level, const CtString& componentName, const CtString& message) {
-    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
-    std::time_t now_c = std::chrono::system_clock::to_time_t(now);
-    std::stringstream timestamp;
-    timestamp << std::put_time(std::localtime(&now_c), "%Y-%m-%d %X");
+void CtLogger::generateLoggerMsg(CtString* entry, CtLogger::Level level, const CtString& componentName, std::string_view message, CtUInt64 time, CtLogTimestamp& timestamp) {
+    entry->push_back('[');
+    entry->append(timestamp.format(time));
+    entry->append("] [");
+    entry->append(levelToString(level));
+    entry->append("] ");
+    entry->append(componentName);
+    entry->append(": ");
+    entry->append(message);
+}
 
-    return CtString("[" + timestamp.str() + "] [" + levelToString(level) + "] " + componentName + ": " + message);
+void CtLogger::generateStructuredMsg(CtString* entry, CtLogger::Level level, CtUInt64 time, CtUInt32 thread, std::string_view message,
+                                     std::string_view format, const CtLogArgType* types, CtUInt32 count, const CtUInt8* data,
+                                     std::string_view context) const {
+    CtBool json = (m_encoding == CtLogger::Encoding::Json);
+    char number[16];
+    std::to_chars_result result = std::to_chars(number, number + sizeof(number), thread);
+    if (json) {
+        entry->append("{\"time\":\"");
+        entry->append(timestamp().format(time));
+        entry->append("\",\"level\":\"");
+        entry->append(levelToString(level));
+        entry->append("\",\"component\":");
+        CtLogFormatter::appendString(entry, m_componentName, CT_TRUE);
+        entry->append(",\"thread\":");
+        entry->append(number, result.ptr - number);
+        entry->append(",\"msg\":");
+    } else {
+        entry->append("time=");
+        entry->append(timestamp().format(time));
+        entry->append(" level=");
+        entry->append(levelToString(level));
+        entry->append(" component=");
+        CtLogFormatter::appendString(entry, m_componentName, CT_FALSE);
+        entry->append(" thread=");
+        entry->append(number, result.ptr - number);
+        entry->append(" msg=");
+    }
+    CtLogFormatter::appendString(entry, message, json);
+    CtLogFormatter::formatFields(entry, format, types, count, data, json);
+    CtLogContext::format(entry, context, json);
+    if (json) {
+        entry->push_back('}');
+    }
 }
 
 const CtString CtLogger::levelToString(CtLogger::Level level) {
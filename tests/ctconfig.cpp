@@ -32,7 +32,11 @@ SOFTWARE.
 #include <gtest/gtest.h>
 #include "cpptoolkit.hpp"
 
+#include <atomic>
+#include <cstdio>
 #include <cstdlib>
+#include <filesystem>
+#include <fstream>
 
 /**************************** Helper definitions ****************************/
 #define CT_CONFIG_FILE      "test.txt"
@@ -235,4 +239,298 @@ TEST(CtConfig, CtConfigTest07) {
             config.read();
         }, CtFileReadError);
     }
-}
\ No newline at end of file
+}
+/**
+ * @brief CtConfigTest08
+ * 
+ * @details
+ * Test the values parsed once into their types.
+ * 
+ * @ref FR-004-001-015
+ * 
+ */
+TEST(CtConfig, CtConfigTest08) {
+    CtConfigValue number("+42");
+    ASSERT_EQ(number.asInt(), 42);
+    ASSERT_EQ(number.asUInt(), 42u);
+    ASSERT_EQ(number.asFloat(), 42.0f);
+    ASSERT_EQ(number.asDouble(), 42.0);
+    ASSERT_EQ(number.asString(), "+42");
+
+    CtConfigValue negative("-7");
+    ASSERT_EQ(negative.asInt(), -7);
+    EXPECT_THROW(negative.asUInt(), CtTypeParseError);
+
+    CtConfigValue real("2.5e3 ms");
+    ASSERT_EQ(real.asInt(), 2);
+    ASSERT_EQ(real.asDouble(), 2500.0);
+
+    CtConfigValue large("5000000000");
+    EXPECT_THROW(large.asInt(), CtTypeParseError);
+    EXPECT_THROW(large.asUInt(), CtTypeParseError);
+    ASSERT_EQ(large.asDouble(), 5e9);
+
+    CtConfigValue text("text");
+    EXPECT_THROW(text.asInt(), CtTypeParseError);
+    EXPECT_THROW(text.asDouble(), CtTypeParseError);
+
+    CtConfig config(CT_CONFIG_FILE);
+    config.writeInt(INT_KEY, INT_VALUE);
+    std::string_view key(INT_KEY);
+    ASSERT_EQ(config.parseAsInt(key), INT_VALUE);
+    config.writeString(INT_KEY, STRING_VALUE);
+    EXPECT_THROW(config.parseAsInt(key), CtTypeParseError);
+}
+
+/**
+ * @brief CtConfigTest09
+ * 
+ * @details
+ * Test reloading a watched file with events and immutable snapshots.
+ * 
+ * @ref FR-004-001-016
+ * 
+ */
+TEST(CtConfig, CtConfigTest09) {
+    auto writeFile = [](const char* p_content) {
+        {
+            std::ofstream file(CT_CONFIG_FILE ".new");
+            file << p_content;
+        }
+        std::rename(CT_CONFIG_FILE ".new", CT_CONFIG_FILE);
+    };
+    auto waitFor = [](const std::atomic<CtUInt32>& p_counter, CtUInt32 p_value) {
+        for (CtUInt32 idx = 0; idx < 300 && p_counter.load() < p_value; idx++) {
+            CtThread::sleepFor(10);
+        }
+        return p_counter.load() >= p_value;
+    };
+    writeFile("a = 1\nb = 2\n");
+    std::atomic<CtUInt32> reloaded(0);
+    std::atomic<CtUInt32> failed(0);
+    std::atomic<CtUInt32> changedA(0);
+    std::atomic<CtUInt32> changedB(0);
+    {
+        CtConfig config(CT_CONFIG_FILE);
+        config.read();
+        ASSERT_EQ(config.watchKey("a"), config.watchKey("a"));
+        config.connectEvent(config.watchKey("a"), [&changedA]() { changedA++; });
+        config.connectEvent(config.watchKey("b"), [&changedB]() { changedB++; });
+        config.connectEvent(CtConfig::RELOADED, [&reloaded]() { reloaded++; });
+        config.connectEvent(CtConfig::RELOAD_FAILED, [&failed]() { failed++; });
+        config.watch();
+        std::shared_ptr<const CtConfigMap> before = config.snapshot();
+
+        writeFile("a = 5\nc = 3\n");
+        ASSERT_TRUE(waitFor(reloaded, 1));
+        config.waitPendingEvents();
+        ASSERT_EQ(config.parseAsInt("a"), 5);
+        ASSERT_EQ(config.parseAsInt("c"), 3);
+        EXPECT_THROW(config.parseAsInt("b"), CtKeyNotFoundError);
+        ASSERT_EQ(before->at("a").asInt(), 1);
+        ASSERT_EQ(changedA.load(), 1u);
+        ASSERT_EQ(changedB.load(), 1u);
+
+        writeFile("invalid\n");
+        ASSERT_TRUE(waitFor(failed, 1));
+        ASSERT_EQ(config.parseAsInt("a"), 5);
+
+        config.writeInt("a", 6);
+        config.waitPendingEvents();
+        ASSERT_EQ(changedA.load(), 2u);
+        config.unwatch();
+    }
+    std::remove(CT_CONFIG_FILE);
+}
+
+/**
+ * @brief CtConfigTest10
+ * 
+ * @details
+ * Test sections, quoted values, escapes, includes and long lines.
+ * 
+ * @ref FR-004-001-017
+ * 
+ */
+TEST(CtConfig, CtConfigTest10) {
+    CtString longValue(2000, 'x');
+    {
+        std::ofstream file(CT_CONFIG_FILE ".inc");
+        file << "[net]\nport = 80\n";
+    }
+    {
+        std::ofstream file(CT_CONFIG_FILE);
+        file << "# header\n\n"
+             << "plain = some value   # comment\r\n"
+             << "quoted = \"  a \\\"b\\\" # c\\n\"  # comment\n"
+             << "long = " << longValue << "\n"
+             << "[db]\n"
+             << "host = localhost\n"
+             << "@include \"" CT_CONFIG_FILE ".inc\"\n"
+             << "user = admin\n"
+             << "[]\n"
+             << "top = 1\n";
+    }
+    CtConfig config(CT_CONFIG_FILE);
+    config.read();
+    ASSERT_EQ(config.parseAsString("plain"), "some value");
+    ASSERT_EQ(config.parseAsString("quoted"), "  a \"b\" # c\n");
+    ASSERT_EQ(config.parseAsString("long"), longValue);
+    ASSERT_EQ(config.parseAsString("db.host"), "localhost");
+    ASSERT_EQ(config.parseAsInt("net.port"), 80);
+    ASSERT_EQ(config.parseAsString("db.user"), "admin");
+    ASSERT_EQ(config.parseAsInt("top"), 1);
+
+    // values are written back so that they are read unchanged
+    config.write();
+    CtConfig copy(CT_CONFIG_FILE);
+    copy.read();
+    ASSERT_EQ(copy.parseAsString("quoted"), "  a \"b\" # c\n");
+    ASSERT_EQ(copy.parseAsString("db.user"), "admin");
+    ASSERT_EQ(copy.snapshot()->size(), 7u);
+
+    CtConfigMap values;
+    CtConfigParser parser(&values);
+    try {
+        parser.parse("a = 1\nb = \"unterminated\n");
+        FAIL();
+    } catch (const CtFileParseError& e) {
+        ASSERT_NE(CtString(e.what()).find(":2"), CtString::npos);
+    }
+    EXPECT_THROW(parser.parse("[section\n"), CtFileParseError);
+    EXPECT_THROW(parser.parse("a = \"x\" y\n"), CtFileParseError);
+    EXPECT_THROW(parser.parse(" = 1\n"), CtFileParseError);
+    std::remove(CT_CONFIG_FILE ".inc");
+    std::remove(CT_CONFIG_FILE);
+}
+
+/**
+ * @brief CtConfigTest11
+ * 
+ * @details
+ * Test parsing a large generated file.
+ * 
+ * @ref FR-004-001-017
+ * 
+ */
+TEST(CtConfig, CtConfigTest11) {
+    {
+        std::ofstream file(CT_CONFIG_FILE);
+        for (CtUInt32 idx = 0; idx < 100000; idx++) {
+            if (idx % 1000 == 0) {
+                file << "[group" << idx / 1000 << "]\n";
+            }
+            file << "key" << idx << " = " << idx << "\n";
+        }
+    }
+    CtConfig config(CT_CONFIG_FILE);
+    config.read();
+    ASSERT_EQ(config.snapshot()->size(), 100000u);
+    ASSERT_EQ(config.parseAsUInt("group0.key0"), 0u);
+    ASSERT_EQ(config.parseAsUInt("group99.key99999"), 99999u);
+    std::remove(CT_CONFIG_FILE);
+}
+
+/**
+ * @brief CtConfigTest12
+ * 
+ * @details
+ * Test compiling, querying and rebuilding binary snapshots.
+ * 
+ * @ref FR-004-001-018
+ * 
+ */
+TEST(CtConfig, CtConfigTest12) {
+    const CtString bin = CT_CONFIG_FILE ".bin";
+    auto age = [](const CtString& path) {
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now() - std::chrono::hours(1));
+    };
+    {
+        std::ofstream file(CT_CONFIG_FILE);
+        file << "name = \"two words\"\n[server]\nport = 8080\nratio = 0.5\n@include \"" CT_CONFIG_FILE ".inc\"\n";
+        std::ofstream include(CT_CONFIG_FILE ".inc");
+        include << "level = -3\n";
+    }
+    CtConfig config(CT_CONFIG_FILE);
+    config.readCompiled(bin);
+    ASSERT_EQ(config.parseAsUInt("server.port"), 8080u);
+    ASSERT_EQ(config.parseAsInt("level"), -3);
+
+    {
+        CtConfigSnapshot snapshot(bin);
+        ASSERT_EQ(snapshot.size(), 4u);
+        ASSERT_TRUE(snapshot.contains("server.ratio"));
+        ASSERT_FALSE(snapshot.contains("server"));
+        ASSERT_EQ(snapshot.parseAsString("name"), "two words");
+        ASSERT_EQ(snapshot.parseAsUInt("server.port"), 8080u);
+        ASSERT_EQ(snapshot.parseAsInt("level"), -3);
+        ASSERT_EQ(snapshot.parseAsFloat("server.ratio"), 0.5f);
+        ASSERT_EQ(snapshot.parseAsDouble("server.ratio"), 0.5);
+        EXPECT_THROW(snapshot.parseAsUInt("level"), CtTypeParseError);
+        EXPECT_THROW(snapshot.parseAsInt("name"), CtTypeParseError);
+        EXPECT_THROW(snapshot.parseAsInt("missing"), CtKeyNotFoundError);
+    }
+
+    // an older text is not parsed again, the snapshot is used
+    {
+        std::ofstream file(CT_CONFIG_FILE);
+        file << "name = changed\n";
+    }
+    age(CT_CONFIG_FILE);
+    age(CT_CONFIG_FILE ".inc");
+    {
+        CtConfigSnapshot snapshot(bin);
+        ASSERT_FALSE(snapshot.isStale());
+    }
+    CtConfig cached(CT_CONFIG_FILE);
+    cached.readCompiled(bin);
+    ASSERT_EQ(cached.parseAsString("name"), "two words");
+    ASSERT_EQ(cached.parseAsUInt("server.port"), 8080u);
+
+    // a newer include rebuilds the snapshot
+    {
+        std::ofstream include(CT_CONFIG_FILE ".inc");
+        include << "level = 7\n";
+    }
+    CtConfig rebuilt(CT_CONFIG_FILE);
+    rebuilt.readCompiled(bin);
+    ASSERT_EQ(rebuilt.parseAsString("name"), "changed");
+    EXPECT_THROW(rebuilt.parseAsUInt("server.port"), CtKeyNotFoundError);
+    {
+        CtConfigSnapshot snapshot(bin);
+        ASSERT_EQ(snapshot.size(), 1u);
+    }
+
+    // a corrupted snapshot is rejected and rebuilt
+    {
+        std::fstream file(bin, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-1, std::ios::end);
+        file.put('#');
+    }
+    EXPECT_THROW(CtConfigSnapshot snapshot(bin), CtFileParseError);
+    CtConfig repaired(CT_CONFIG_FILE);
+    repaired.readCompiled(bin);
+    ASSERT_EQ(repaired.parseAsString("name"), "changed");
+    ASSERT_NO_THROW(CtConfigSnapshot snapshot(bin));
+
+    // values written in memory are compiled too
+    rebuilt.writeDouble("scale", 2.5);
+    rebuilt.compile(bin);
+    {
+        CtConfigSnapshot snapshot(bin);
+        ASSERT_EQ(snapshot.parseAsDouble("scale"), 2.5);
+        CtConfigMap values;
+        snapshot.load(&values);
+        ASSERT_EQ(values.size(), 2u);
+        ASSERT_EQ(values.at("scale").asFloat(), 2.5f);
+    }
+    EXPECT_THROW(CtConfigSnapshot snapshot("missing.bin"), CtFileReadError);
+
+    // a snapshot that cannot be written does not prevent the values from being read
+    CtConfig unwritable(CT_CONFIG_FILE);
+    ASSERT_NO_THROW(unwritable.readCompiled("missing/dir/config.bin"));
+    ASSERT_EQ(unwritable.parseAsString("name"), "changed");
+    std::remove(bin.c_str());
+    std::remove(CT_CONFIG_FILE ".inc");
+    std::remove(CT_CONFIG_FILE);
+}
@@ -317,3 +317,367 @@ TEST(CtFileIO, CtFileIOTest07) {
         ASSERT_EQ(data.size(), 20000);
     }
 }
+
+/**
+ * @brief CtFileIOTest08
+ * 
+ * @details
+ * Test async mode of CtFileOutput. All the queued data must be written in order after flush.
+ * 
+ * @ref FR-002-002-011
+ * @ref FR-002-002-012
+ * @ref FR-002-002-013
+ * @ref FR-002-002-014
+ * 
+ */
+TEST(CtFileIO, CtFileIOTest08) {
+    int status = system("rm -f test.txt");
+    ASSERT_NE(status, -1);
+    const CtUInt32 records = 1000;
+    {
+        CtRawData data;
+        CtFileOutput fileOut(CT_FILENAME, CtFileOutput::WriteMode::Truncate);
+        fileOut.setDelimiter(CT_DEL, sizeof(CT_DEL));
+        fileOut.setAsync(16, CtFileOutput::OverflowPolicy::Block);
+        EXPECT_THROW({
+            fileOut.setAsync();
+        }, CtFileWriteError);
+
+        for (CtUInt32 idx = 0; idx < records; idx++) {
+            CtString record = "Record" + ToCtString(idx);
+            data.clone((CtUInt8*)record.c_str(), record.size());
+            fileOut.write(&data);
+        }
+        fileOut.flush();
+        ASSERT_EQ(fileOut.getDroppedWrites(), 0);
+    }
+    {
+        CtRawData data;
+        CtFileInput fileIn(CT_FILENAME);
+        fileIn.setDelimiter(CT_DEL, sizeof(CT_DEL));
+
+        for (CtUInt32 idx = 0; idx < records; idx++) {
+            CtString record = "Record" + ToCtString(idx);
+            ASSERT_EQ(fileIn.read(&data), CT_TRUE);
+            ASSERT_EQ(CtString((CtChar*)data.get(), data.size()), record);
+        }
+        ASSERT_EQ(fileIn.read(&data), CT_FALSE);
+    }
+}
+
+/**
+ * @brief CtFileIOTest09
+ * 
+ * @details
+ * Test async mode of CtFileOutput with drop policy. Every write is either written or counted as dropped.
+ * 
+ * @ref FR-002-002-013
+ * @ref FR-002-002-014
+ * 
+ */
+TEST(CtFileIO, CtFileIOTest09) {
+    int status = system("rm -f test.txt");
+    ASSERT_NE(status, -1);
+    const CtUInt32 records = 5000;
+    CtUInt64 dropped = 0;
+    {
+        CtRawData data;
+        CtFileOutput fileOut(CT_FILENAME, CtFileOutput::WriteMode::Truncate);
+        fileOut.setDelimiter(CT_DEL, sizeof(CT_DEL));
+        fileOut.setAsync(2, CtFileOutput::OverflowPolicy::Drop);
+
+        data.clone((CtUInt8*)"HelloTest09", 11);
+        for (CtUInt32 idx = 0; idx < records; idx++) {
+            fileOut.write(&data);
+        }
+        fileOut.flush();
+        dropped = fileOut.getDroppedWrites();
+    }
+    {
+        CtRawData data;
+        CtFileInput fileIn(CT_FILENAME);
+        fileIn.setDelimiter(CT_DEL, sizeof(CT_DEL));
+
+        CtUInt32 written = 0;
+        while (fileIn.read(&data)) {
+            written++;
+        }
+        ASSERT_EQ(written + dropped, records);
+    }
+}
+
+/**
+ * @brief CtFileIOTest10
+ * 
+ * @details
+ * Test io_uring mode of CtFileOutput and CtFileInput. The data cross several io_uring blocks.
+ * 
+ * @ref FR-002-001-012
+ * @ref FR-002-002-016
+ * 
+ */
+TEST(CtFileIO, CtFileIOTest10) {
+    if (!CtIoUring::isSupported()) {
+        GTEST_SKIP() << "io_uring is not supported.";
+    }
+    int status = system("rm -f test.txt");
+    ASSERT_NE(status, -1);
+    const CtUInt32 records = 20000;
+    {
+        CtRawData data;
+        CtFileOutput fileOut(CT_FILENAME, CtFileOutput::WriteMode::Truncate);
+        fileOut.setDelimiter(CT_DEL, sizeof(CT_DEL));
+        ASSERT_EQ(fileOut.useIoUring(), CT_TRUE);
+        ASSERT_THROW(fileOut.useIoUring(), CtFileWriteError);
+
+        for (CtUInt32 idx = 0; idx < records; idx++) {
+            CtString record = "Record" + ToCtString(idx);
+            data.clone((CtUInt8*)record.c_str(), record.size());
+            fileOut.write(&data);
+        }
+        fileOut.flush();
+    }
+    {
+        CtRawData data;
+        CtFileInput fileIn(CT_FILENAME);
+        fileIn.setDelimiter(CT_DEL, sizeof(CT_DEL));
+        // io_uring continues on the opened file, not on a file found by name
+        std::remove(CT_FILENAME);
+        ASSERT_EQ(fileIn.useIoUring(), CT_TRUE);
+        ASSERT_THROW(fileIn.useIoUring(), CtFileReadError);
+
+        for (CtUInt32 idx = 0; idx < records; idx++) {
+            CtString record = "Record" + ToCtString(idx);
+            ASSERT_EQ(fileIn.read(&data), CT_TRUE);
+            ASSERT_EQ(CtString((CtChar*)data.get(), data.size()), record);
+        }
+        ASSERT_EQ(fileIn.read(&data), CT_FALSE);
+    }
+}
+
+/**
+ * @brief CtFileIOTest11
+ * 
+ * @details
+ * Test io_uring in async mode and a CtIoUring shared by two input files. The input buffer is smaller
+ * than the records so that reading moves back across io_uring blocks.
+ * 
+ * @ref FR-002-001-012
+ * @ref FR-002-002-016
+ * @ref FR-002-003-001
+ * 
+ */
+TEST(CtFileIO, CtFileIOTest11) {
+    if (!CtIoUring::isSupported()) {
+        GTEST_SKIP() << "io_uring is not supported.";
+    }
+    const CtString files[] = {"test_uring1.txt", "test_uring2.txt"};
+    const CtUInt32 records = 10000;
+    CtString record(25, 'a');
+    {
+        CtIoUring ring;
+        CtRawData data;
+        CtFileOutput fileOut1(files[0], CtFileOutput::WriteMode::Truncate);
+        CtFileOutput fileOut2(files[1], CtFileOutput::WriteMode::Truncate);
+        fileOut1.setDelimiter(CT_DEL, sizeof(CT_DEL));
+        fileOut2.setDelimiter(CT_DEL, sizeof(CT_DEL));
+        fileOut1.setAsync();
+        fileOut2.setAsync();
+        ASSERT_EQ(fileOut1.useIoUring(&ring), CT_TRUE);
+
+        data.clone((CtUInt8*)record.c_str(), record.size());
+        for (CtUInt32 idx = 0; idx < records; idx++) {
+            fileOut1.write(&data);
+            fileOut2.write(&data);
+        }
+        fileOut1.flush();
+        fileOut2.flush();
+    }
+    {
+        CtIoUring ring;
+        CtRawData data(20);
+        CtFileInput fileIn1(files[0]);
+        CtFileInput fileIn2(files[1]);
+        ASSERT_EQ(fileIn1.useIoUring(&ring), CT_TRUE);
+        ASSERT_EQ(fileIn2.useIoUring(&ring), CT_TRUE);
+
+        CtString s_data1;
+        CtString s_data2;
+        while (fileIn1.read(&data)) {
+            s_data1.append((CtChar*)data.get(), data.size());
+        }
+        while (fileIn2.read(&data)) {
+            s_data2.append((CtChar*)data.get(), data.size());
+        }
+        ASSERT_EQ(s_data1.size(), records * (record.size() + sizeof(CT_DEL)));
+        ASSERT_EQ(s_data1, s_data2);
+    }
+    for (const CtString& file : files) {
+        std::remove(file.c_str());
+    }
+}
+
+/**
+ * @brief CtFileIOTest12
+ * 
+ * @details
+ * Test CtIoUring requests at explicit offsets.
+ * 
+ * @ref FR-002-003-001
+ * @ref FR-002-003-002
+ * @ref FR-002-003-003
+ * @ref FR-002-003-004
+ * @ref FR-002-003-005
+ * @ref FR-002-003-006
+ * 
+ */
+TEST(CtFileIO, CtFileIOTest12) {
+    if (!CtIoUring::isSupported()) {
+        GTEST_SKIP() << "io_uring is not supported.";
+    }
+    ASSERT_THROW(CtIoUring(0), CtIoUringError);
+
+    int status = system("rm -f test.txt");
+    ASSERT_NE(status, -1);
+    FILE* file = fopen(CT_FILENAME, "w+");
+    ASSERT_NE(file, nullptr);
+    CtInt32 fd = fileno(file);
+
+    CtIoUring ring(4);
+    CtIoUringRequest requests[8];
+    CtUInt8 in[8][4];
+    for (CtUInt32 idx = 0; idx < 8; idx++) {
+        memset(in[idx], '0' + idx, sizeof(in[idx]));
+        ring.prepareWrite(fd, in[idx], sizeof(in[idx]), idx * sizeof(in[idx]), &requests[idx]);
+    }
+    ring.submit();
+    ring.wait(&requests[7]);
+    while (ring.inFlight() > 0) {
+        ring.poll();
+    }
+    for (CtUInt32 idx = 0; idx < 8; idx++) {
+        ASSERT_EQ(requests[idx].done, CT_TRUE);
+        ASSERT_EQ(requests[idx].result, (CtInt32)sizeof(in[idx]));
+    }
+
+    CtUInt8 out[16];
+    CtIoUringRequest request;
+    ring.prepareRead(fd, out, sizeof(out), 8, &request);
+    ring.wait(&request);
+    ASSERT_EQ(request.result, (CtInt32)sizeof(out));
+    ASSERT_EQ(memcmp(out, "2222333344445555", sizeof(out)), 0);
+    fclose(file);
+}
+
+/**
+ * @brief CtFileIOTest13
+ * 
+ * @details
+ * Test writing and reading with CtRawDataView, with and without io_uring.
+ * 
+ * @ref FR-002-001-013
+ * @ref FR-002-002-017
+ * 
+ */
+TEST(CtFileIO, CtFileIOTest13) {
+    int status = system("rm -f test.txt");
+    ASSERT_NE(status, -1);
+    const CtUInt32 records = 20000;
+    CtString line(3000, 'z');
+    {
+        CtFileOutput fileOut(CT_FILENAME, CtFileOutput::WriteMode::Truncate);
+        fileOut.setDelimiter(CT_DEL, sizeof(CT_DEL));
+        for (CtUInt32 idx = 0; idx < records; idx++) {
+            CtString record = "Record" + ToCtString(idx);
+            fileOut.write(CtRawDataView((const CtUInt8*)record.c_str(), record.size()));
+        }
+        fileOut.writePart(CtRawDataView((const CtUInt8*)line.c_str(), line.size()));
+    }
+    for (CtBool uring : {CT_FALSE, CT_TRUE}) {
+        CtRawDataView view;
+        CtFileInput fileIn(CT_FILENAME);
+        fileIn.setDelimiter(CT_DEL, sizeof(CT_DEL));
+        if (uring && !fileIn.useIoUring()) {
+            continue;
+        }
+
+        for (CtUInt32 idx = 0; idx < records; idx++) {
+            CtString record = "Record" + ToCtString(idx);
+            ASSERT_EQ(fileIn.read(&view), CT_TRUE);
+            ASSERT_EQ(CtString((const CtChar*)view.get(), view.size()), record);
+        }
+        ASSERT_EQ(fileIn.read(&view), CT_TRUE);
+        ASSERT_EQ(CtString((const CtChar*)view.get(), view.size()), line);
+        ASSERT_EQ(fileIn.read(&view), CT_FALSE);
+    }
+}
+
+/**
+ * @brief CtFileIOTest14
+ * 
+ * @details
+ * Test writing CtSharedData in sync and async mode. The async queue holds references only.
+ * 
+ * @ref FR-002-002-018
+ * 
+ */
+TEST(CtFileIO, CtFileIOTest14) {
+    int status = system("rm -f test.txt");
+    ASSERT_NE(status, -1);
+    const CtUInt32 records = 1000;
+    CtSharedData header(CtRawDataView((const CtUInt8*)"Shared", 6));
+    CtSharedData record = header.append(CtSharedData(CtRawDataView((const CtUInt8*)"Record", 6)));
+    {
+        CtFileOutput fileOut(CT_FILENAME, CtFileOutput::WriteMode::Truncate);
+        fileOut.setDelimiter(CT_DEL, sizeof(CT_DEL));
+        fileOut.write(record);
+        fileOut.setAsync();
+        for (CtUInt32 idx = 1; idx < records; idx++) {
+            fileOut.writePart(header);
+            fileOut.write(record);
+        }
+        fileOut.flush();
+        ASSERT_EQ(record.useCount(), 1);
+        ASSERT_EQ(header.useCount(), 1);
+    }
+    {
+        CtRawData data;
+        CtFileInput fileIn(CT_FILENAME);
+        fileIn.setDelimiter(CT_DEL, sizeof(CT_DEL));
+        ASSERT_EQ(fileIn.read(&data), CT_TRUE);
+        ASSERT_EQ(CtString((CtChar*)data.get(), data.size()), "SharedRecord");
+        for (CtUInt32 idx = 1; idx < records; idx++) {
+            ASSERT_EQ(fileIn.read(&data), CT_TRUE);
+            ASSERT_EQ(CtString((CtChar*)data.get(), data.size()), "SharedSharedRecord");
+        }
+        ASSERT_EQ(fileIn.read(&data), CT_FALSE);
+    }
+}
+
+/**
+ * @brief CtFileIOTest15
+ * 
+ * @details
+ * Test that flush syncs the written file after its path is renamed.
+ * 
+ * @ref FR-002-002-014
+ * 
+ */
+TEST(CtFileIO, CtFileIOTest15) {
+    {
+        CtFileOutput fileOut(CT_FILENAME, CtFileOutput::WriteMode::Truncate);
+        CtRawData data(6);
+        data.clone((const CtUInt8*)"Record", 6);
+        fileOut.write(&data);
+        ASSERT_EQ(std::rename(CT_FILENAME, CT_FILENAME ".1"), 0);
+        fileOut.write(&data);
+        ASSERT_NO_THROW(fileOut.flush());
+    }
+    {
+        CtRawData data;
+        CtFileInput fileIn(CT_FILENAME ".1");
+        ASSERT_EQ(fileIn.read(&data), CT_TRUE);
+        ASSERT_EQ(CtString((CtChar*)data.get(), data.size()), "RecordRecord");
+    }
+    std::remove(CT_FILENAME ".1");
+}
@@ -0,0 +1,477 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+/**
+ * @file ctlogger.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include <gtest/gtest.h>
+#include "cpptoolkit.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+/**************************** Helper definitions ****************************/
+#define CT_LOG_FILE         "test.ctlog"
+
+template <typename... Args>
+CtString formatArgs(CtLogFormat<std::type_identity_t<Args>...> p_format, const Args&... p_args) {
+    std::vector<CtUInt8> data(CtLogArgs<Args...>::size(p_args...));
+    CtLogArgs<Args...>::encode(data.data(), p_args...);
+    CtString message;
+    const CtUInt8* end = CtLogFormatter::format(&message, p_format.get(), CtLogArgs<Args...>::types.data(), sizeof...(Args), data.data());
+    EXPECT_EQ(end, data.data() + data.size());
+    return message;
+}
+
+/********************************* Main test ********************************/
+
+/**
+ * @brief CtLoggerTest01
+ * 
+ * @details
+ * Test formatting of binary arguments.
+ * 
+ * @ref FR-004-005-001
+ * @ref FR-004-005-002
+ * 
+ */
+TEST(CtLogger, CtLoggerTest01) {
+    ASSERT_EQ(CtLogFormatter::countArgs("a {} b {:x} c {:.3} {{}}"), 3);
+    ASSERT_EQ(CtLogFormatter::countArgs("a {"), -1);
+    ASSERT_EQ(CtLogFormatter::countArgs("a }"), -1);
+    ASSERT_EQ(CtLogFormatter::countArgs("a {:y}"), -1);
+
+    ASSERT_EQ(formatArgs("plain"), "plain");
+    ASSERT_EQ(formatArgs("{} {} {} {}", (CtInt8)-5, (CtUInt16)65535, -123456, (CtUInt64)1 << 40), "-5 65535 -123456 1099511627776");
+    ASSERT_EQ(formatArgs("{:x} {:.2} {} {}", 255, 2.0 / 3, 1.5f, 0.1), "ff 0.67 1.5 0.1");
+    ASSERT_EQ(formatArgs("{} {} {}", true, 'c', CtString("str")), "true c str");
+    ASSERT_EQ(formatArgs("{} {} {}", "literal", std::string_view("view"), (const char*)nullptr), "literal view (null)");
+    ASSERT_EQ(formatArgs("{{{}}}", 1), "{1}");
+}
+
+/**
+ * @brief CtLoggerTest02
+ * 
+ * @details
+ * Test writing and reading a binary log file.
+ * 
+ * @ref FR-004-005-003
+ * @ref FR-004-005-004
+ * 
+ */
+TEST(CtLogger, CtLoggerTest02) {
+    {
+        CtLogger logger(CtLogger::Level::INFO, "TEST");
+        logger.setBinaryOutput(CT_LOG_FILE);
+        logger.log_debug("hidden {}", 0);
+        for (CtUInt32 idx = 0; idx < 100; idx++) {
+            logger.log_info("message {} price {:.2} symbol {}", idx, idx / 4.0, "ABC");
+        }
+        logger.log_error("error");
+    }
+    CtLogBinaryReader reader(CT_LOG_FILE);
+    ASSERT_EQ(reader.getComponent(), "TEST");
+    CtString line;
+    for (CtUInt32 idx = 0; idx < 100; idx++) {
+        ASSERT_TRUE(reader.read(&line));
+        CtString expected = "[INFO] TEST: message " + std::to_string(idx) + " price " + std::to_string(idx / 4.0).substr(0, std::to_string(idx / 4.0).find('.') + 3) + " symbol ABC";
+        ASSERT_EQ(line.substr(line.find("] ") + 2), expected);
+    }
+    ASSERT_TRUE(reader.read(&line));
+    ASSERT_EQ(line.substr(line.find("] ") + 2), "[ERROR] TEST: error");
+    ASSERT_FALSE(reader.read(&line));
+    std::remove(CT_LOG_FILE);
+}
+
+/**
+ * @brief CtLoggerTest03
+ * 
+ * @details
+ * Test that the logging macros evaluate the arguments only for enabled levels.
+ * 
+ * @ref FR-004-002-007
+ * 
+ */
+TEST(CtLogger, CtLoggerTest03) {
+    CtLogger logger(CtLogger::Level::WARNING, "TEST");
+    CtUInt32 evaluated = 0;
+    auto argument = [&]() {
+        evaluated++;
+        return evaluated;
+    };
+    ASSERT_FALSE(logger.isEnabled(CtLogger::Level::INFO));
+    ASSERT_TRUE(logger.isEnabled(CtLogger::Level::ERROR));
+
+    CtUInt32 expected = (CT_LOG_MIN_LEVEL <= CT_LOG_LEVEL_WARNING) + (CT_LOG_MIN_LEVEL <= CT_LOG_LEVEL_ERROR);
+    testing::internal::CaptureStdout();
+    CT_LOG_DEBUG(logger, "debug {}", argument());
+    CT_LOG_INFO(logger, "info {}", argument());
+    ASSERT_EQ(evaluated, 0u);
+    CT_LOG_WARNING(logger, "warning {}", argument());
+    CT_LOG_ERROR(logger, "error {}", argument());
+    ASSERT_EQ(evaluated, expected);
+    CtString output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(output.find("[WARNING] TEST: warning 1") != CtString::npos, CT_LOG_MIN_LEVEL <= CT_LOG_LEVEL_WARNING);
+    ASSERT_EQ(output.find("[ERROR] TEST: error") != CtString::npos, CT_LOG_MIN_LEVEL <= CT_LOG_LEVEL_ERROR);
+
+    CtLogger debugLogger(CtLogger::Level::DEBUG, "TEST");
+    testing::internal::CaptureStdout();
+    CT_LOG_DEBUG(debugLogger, "debug {}", argument());
+    output = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(evaluated, expected + (CT_LOG_MIN_LEVEL <= CT_LOG_LEVEL_DEBUG));
+    ASSERT_EQ(output.empty(), CT_LOG_MIN_LEVEL > CT_LOG_LEVEL_DEBUG);
+}
+
+/**
+ * @brief CtLoggerTest04
+ * 
+ * @details
+ * Test that every sink gets the lines of its level in synchronous and asynchronous mode.
+ * 
+ * @ref FR-004-006-001
+ * @ref FR-004-006-002
+ * @ref FR-004-006-005
+ * 
+ */
+TEST(CtLogger, CtLoggerTest04) {
+    for (CtLogger::Mode mode : { CtLogger::Mode::Sync, CtLogger::Mode::Async }) {
+        auto all = std::make_shared<CtLogMemorySink>(4096, CtLogger::Level::DEBUG);
+        auto errors = std::make_shared<CtLogMemorySink>(4096, CtLogger::Level::ERROR);
+        auto console = std::make_shared<CtLogConsoleSink>(CtLogger::Level::WARNING);
+        all->setDumpLevel(CtLogger::Level::CRITICAL);
+        testing::internal::CaptureStdout();
+        {
+            CtLogger logger(CtLogger::Level::INFO, "TEST");
+            logger.setMode(mode);
+            logger.addSink(all);
+            logger.addSink(errors);
+            logger.addSink(console);
+            logger.log_debug("debug");
+            logger.log_info("info {}", 1);
+            logger.log_warning("warning {}", 2);
+            logger.log_error("error {}", 3);
+        }
+        CtString output = testing::internal::GetCapturedStdout();
+        CtString lines = all->getLines();
+        ASSERT_EQ(lines.find("debug"), CtString::npos);
+        ASSERT_NE(lines.find("[INFO] TEST: info 1\n"), CtString::npos);
+        ASSERT_NE(lines.find("[WARNING] TEST: warning 2\n"), CtString::npos);
+        ASSERT_NE(lines.find("[ERROR] TEST: error 3\n"), CtString::npos);
+        lines = errors->getLines();
+        ASSERT_EQ(std::count(lines.begin(), lines.end(), '\n'), 1);
+        ASSERT_NE(lines.find("[ERROR] TEST: error 3\n"), CtString::npos);
+        ASSERT_EQ(output.find("info"), CtString::npos);
+        ASSERT_NE(output.find("[WARNING] TEST: warning 2\n"), CtString::npos);
+        ASSERT_NE(output.find("[ERROR] TEST: error 3\n"), CtString::npos);
+    }
+}
+
+/**
+ * @brief CtLoggerTest05
+ * 
+ * @details
+ * Test that the memory sink keeps only the most recent complete lines.
+ * 
+ * @ref FR-004-006-005
+ * 
+ */
+TEST(CtLogger, CtLoggerTest05) {
+    auto ring = std::make_shared<CtLogMemorySink>(100);
+    CtLogger logger(CtLogger::Level::DEBUG, "TEST");
+    logger.addSink(ring);
+    for (CtUInt32 idx = 0; idx < 20; idx++) {
+        logger.log_info("line {}", idx);
+    }
+    CtString lines = ring->getLines();
+    ASSERT_LE(lines.size(), 100u);
+    ASSERT_EQ(lines.back(), '\n');
+    ASSERT_EQ(lines.front(), '[');
+    ASSERT_NE(lines.find("TEST: line 19\n"), CtString::npos);
+    ASSERT_EQ(lines.find("TEST: line 17\n"), CtString::npos);
+}
+
+/**
+ * @brief CtLoggerTest06
+ * 
+ * @details
+ * Test the rotation of the file sink by size.
+ * 
+ * @ref FR-004-006-003
+ * 
+ */
+TEST(CtLogger, CtLoggerTest06) {
+    for (const char* file : { CT_LOG_FILE, CT_LOG_FILE ".1", CT_LOG_FILE ".2", CT_LOG_FILE ".3" }) {
+        std::remove(file);
+    }
+    {
+        auto sink = std::make_shared<CtLogFileSink>(CT_LOG_FILE);
+        sink->setMaxSize(1000);
+        sink->setMaxFiles(2);
+        CtLogger logger(CtLogger::Level::DEBUG, "TEST");
+        logger.setMode(CtLogger::Mode::Async);
+        logger.addSink(sink);
+        for (CtUInt32 idx = 0; idx < 100; idx++) {
+            logger.log_info("line {}", idx);
+        }
+    }
+    std::ifstream current(CT_LOG_FILE);
+    std::ifstream first(CT_LOG_FILE ".1");
+    std::ifstream second(CT_LOG_FILE ".2");
+    std::ifstream third(CT_LOG_FILE ".3");
+    ASSERT_TRUE(current.is_open());
+    ASSERT_TRUE(first.is_open());
+    ASSERT_TRUE(second.is_open());
+    ASSERT_FALSE(third.is_open());
+    CtString line;
+    CtString last;
+    CtUInt32 count = 0;
+    while (std::getline(current, line)) {
+        last = line;
+        count++;
+    }
+    ASSERT_GT(count, 0u);
+    ASSERT_NE(last.find("TEST: line 99"), CtString::npos);
+    ASSERT_LE(std::filesystem::file_size(CT_LOG_FILE ".1"), 1000u);
+    ASSERT_TRUE(std::getline(first, line));
+    ASSERT_TRUE(std::getline(second, line));
+    for (const char* file : { CT_LOG_FILE, CT_LOG_FILE ".1", CT_LOG_FILE ".2" }) {
+        std::remove(file);
+    }
+}
+
+/**
+ * @brief CtLoggerTest07
+ * 
+ * @details
+ * Test cached timestamps against strftime in UTC and local time.
+ * 
+ * @ref FR-004-007-001
+ * @ref FR-004-007-002
+ * @ref FR-004-007-003
+ * 
+ */
+TEST(CtLogger, CtLoggerTest07) {
+    const CtUInt64 ns = 1000000000u;
+    CtLogTimestamp utc(CtLogTimestamp::Precision::Microseconds, CtLogTimestamp::Zone::Utc, CtLogTimestamp::Style::Iso8601);
+    ASSERT_EQ(utc.format(0), "1970-01-01T00:00:00.000000Z");
+    ASSERT_EQ(utc.format(1792422187123456789u), "2026-10-19T15:03:07.123456Z");
+    ASSERT_EQ(utc.format(1792422187999999999u), "2026-10-19T15:03:07.999999Z");
+    ASSERT_EQ(utc.format(951782400u * ns), "2000-02-29T00:00:00.000000Z");
+
+    CtLogTimestamp milli(CtLogTimestamp::Precision::Milliseconds, CtLogTimestamp::Zone::Utc);
+    ASSERT_EQ(milli.format(1792422187123456789u), "2026-10-19 15:03:07.123");
+
+    CtLogTimestamp seconds(CtLogTimestamp::Precision::Seconds, CtLogTimestamp::Zone::Utc);
+    CtLogTimestamp local;
+    char expected[32];
+    // steps of 7 seconds cross seconds, minutes, days and years with one cache
+    for (std::time_t time = 1798761000; time < 1798761000 + 4000 * 7; time += 7) {
+        std::tm tm;
+        gmtime_r(&time, &tm);
+        std::strftime(expected, sizeof(expected), "%Y-%m-%d %H:%M:%S", &tm);
+        ASSERT_EQ(seconds.format((CtUInt64)time * ns), expected);
+        localtime_r(&time, &tm);
+        std::strftime(expected, sizeof(expected), "%Y-%m-%d %H:%M:%S", &tm);
+        ASSERT_EQ(local.format((CtUInt64)time * ns + 500), expected);
+    }
+}
+
+/**
+ * @brief CtLoggerTest08
+ * 
+ * @details
+ * Test the timestamp format of a logger.
+ * 
+ * @ref FR-004-007-004
+ * 
+ */
+TEST(CtLogger, CtLoggerTest08) {
+    auto sink = std::make_shared<CtLogMemorySink>(1024);
+    CtLogger logger(CtLogger::Level::DEBUG, "TEST");
+    logger.addSink(sink);
+    logger.setTimestamp(CtLogTimestamp::Precision::Microseconds, CtLogTimestamp::Zone::Utc, CtLogTimestamp::Style::Iso8601);
+    logger.log_info("message");
+    CtString line = sink->getLines();
+    // [YYYY-MM-DDTHH:MM:SS.ffffffZ] [INFO] TEST: message
+    ASSERT_EQ(line.size(), 29u + 22u);
+    ASSERT_EQ(line[11], 'T');
+    ASSERT_EQ(line[20], '.');
+    ASSERT_EQ(line.substr(27), "Z] [INFO] TEST: message\n");
+}
+
+/**
+ * @brief CtLoggerTest09
+ * 
+ * @details
+ * Test named placeholders and their fields.
+ * 
+ * @ref FR-004-005-005
+ * 
+ */
+TEST(CtLogger, CtLoggerTest09) {
+    ASSERT_EQ(CtLogFormatter::countArgs("{id} {price:.2} {mask:x} {}"), 4);
+    ASSERT_EQ(CtLogFormatter::countArgs("{1d}"), -1);
+    ASSERT_EQ(CtLogFormatter::countArgs("{a-b}"), -1);
+    ASSERT_EQ(formatArgs("order {id} at {price:.2} {mask:x}", 42, 1.005, 255), "order 42 at 1.00 ff");
+
+    std::vector<CtUInt8> data(CtLogArgs<int, double, CtString, int, const char*>::size(42, 0.5, CtString("a \"b\"\n"), 7, "x"));
+    CtLogArgs<int, double, CtString, int, const char*>::encode(data.data(), 42, 0.5, CtString("a \"b\"\n"), 7, "x");
+    const CtLogArgType* types = CtLogArgs<int, double, CtString, int, const char*>::types.data();
+    CtString json;
+    CtString logfmt;
+    const CtUInt8* end = CtLogFormatter::formatFields(&json, "{id} {price} {text} {} {tag}", types, 5, data.data(), CT_TRUE);
+    ASSERT_EQ(end, data.data() + data.size());
+    ASSERT_EQ(json, ",\"id\":42,\"price\":0.5,\"text\":\"a \\\"b\\\"\\n\",\"tag\":\"x\"");
+    CtLogFormatter::formatFields(&logfmt, "{id} {price} {text} {} {tag}", types, 5, data.data(), CT_FALSE);
+    ASSERT_EQ(logfmt, " id=42 price=0.5 text=\"a \\\"b\\\"\\n\" tag=x");
+
+    CtString escaped;
+    CtLogFormatter::appendString(&escaped, std::string_view("\t\x01", 2), CT_TRUE);
+    ASSERT_EQ(escaped, "\"\\t\\u0001\"");
+}
+
+/**
+ * @brief CtLoggerTest10
+ * 
+ * @details
+ * Test JSON and logfmt lines with the log context of threads and worker pool tasks.
+ * 
+ * @ref FR-004-002-008
+ * @ref FR-004-008-001
+ * @ref FR-004-008-002
+ * 
+ */
+TEST(CtLogger, CtLoggerTest10) {
+    for (CtLogger::Mode mode : { CtLogger::Mode::Sync, CtLogger::Mode::Async }) {
+        auto json = std::make_shared<CtLogMemorySink>(4096);
+        auto logfmt = std::make_shared<CtLogMemorySink>(4096);
+        {
+            CtLogger jsonLogger(CtLogger::Level::DEBUG, "TEST");
+            CtLogger logfmtLogger(CtLogger::Level::DEBUG, "TEST");
+            jsonLogger.setMode(mode);
+            logfmtLogger.setMode(mode);
+            jsonLogger.setEncoding(CtLogger::Encoding::Json);
+            logfmtLogger.setEncoding(CtLogger::Encoding::Logfmt);
+            jsonLogger.addSink(json);
+            logfmtLogger.addSink(logfmt);
+
+            CtLogContext context;
+            context.add("request_id", "r-1");
+            {
+                CtLogContext::Scope scope(context);
+                jsonLogger.log_info("order {id} filled", 42);
+                logfmtLogger.log_info("order {id} filled", 42);
+            }
+            jsonLogger.log_warning("done");
+
+            CtLogContext taskContext;
+            taskContext.add("request_id", "r-2");
+            CtTask task;
+            task.setTaskFunc([&jsonLogger]() { jsonLogger.log_error("task"); });
+            CtWorkerPool pool(1);
+            pool.addTask(task, taskContext);
+            pool.join();
+        }
+        std::stringstream jsonLines(json->getLines());
+        CtString line;
+        CtString thread = std::to_string(CtLogContext::threadId());
+        ASSERT_TRUE(std::getline(jsonLines, line));
+        ASSERT_EQ(line.substr(0, 9), "{\"time\":\"");
+        ASSERT_EQ(line.substr(35), "Z\",\"level\":\"INFO\",\"component\":\"TEST\",\"thread\":" + thread +
+                                   ",\"msg\":\"order 42 filled\",\"id\":42,\"request_id\":\"r-1\"}");
+        ASSERT_TRUE(std::getline(jsonLines, line));
+        ASSERT_EQ(line.substr(35), "Z\",\"level\":\"WARNING\",\"component\":\"TEST\",\"thread\":" + thread + ",\"msg\":\"done\"}");
+        ASSERT_TRUE(std::getline(jsonLines, line));
+        ASSERT_EQ(line.find("\"thread\":" + thread + ","), CtString::npos);
+        ASSERT_NE(line.find("\"msg\":\"task\",\"request_id\":\"r-2\"}"), CtString::npos);
+
+        CtString expected = "Z level=INFO component=TEST thread=" + thread + " msg=\"order 42 filled\" id=42 request_id=r-1\n";
+        CtString lines = logfmt->getLines();
+        ASSERT_EQ(lines.substr(0, 5), "time=");
+        ASSERT_EQ(lines.substr(31), expected);
+    }
+}
+
+/**
+ * @brief CtLoggerTest11
+ * 
+ * @details
+ * Test that context keys with quotes, spaces and equal signs keep the lines parsable.
+ * 
+ * @ref FR-004-008-001
+ * 
+ */
+TEST(CtLogger, CtLoggerTest11) {
+    auto json = std::make_shared<CtLogMemorySink>(4096);
+    auto logfmt = std::make_shared<CtLogMemorySink>(4096);
+    {
+        CtLogger jsonLogger(CtLogger::Level::DEBUG, "TEST");
+        CtLogger logfmtLogger(CtLogger::Level::DEBUG, "TEST");
+        jsonLogger.setEncoding(CtLogger::Encoding::Json);
+        logfmtLogger.setEncoding(CtLogger::Encoding::Logfmt);
+        jsonLogger.addSink(json);
+        logfmtLogger.addSink(logfmt);
+
+        CtLogContext context;
+        context.add("say \"hi\"", "x").add("a=b\\c", "y");
+        CtLogContext::Scope scope(context);
+        jsonLogger.log_info("text");
+        logfmtLogger.log_info("text");
+    }
+    CtString jsonLine = json->getLines();
+    ASSERT_NE(jsonLine.find(",\"msg\":\"text\",\"say \\\"hi\\\"\":\"x\",\"a=b\\\\c\":\"y\"}\n"), CtString::npos);
+    CtString logfmtLine = logfmt->getLines();
+    ASSERT_NE(logfmtLine.find(" msg=text say__hi_=x a_b_c=y\n"), CtString::npos);
+}
+
+/**
+ * @brief CtLoggerTest12
+ * 
+ * @details
+ * Test that leaving asynchronous mode writes the queued messages before the logger can be destroyed.
+ * 
+ * @ref FR-004-002-006
+ * 
+ */
+TEST(CtLogger, CtLoggerTest12) {
+    auto memory = std::make_shared<CtLogMemorySink>(4096);
+    {
+        CtLogger logger(CtLogger::Level::DEBUG, "TEST");
+        logger.addSink(memory);
+        logger.setMode(CtLogger::Mode::Async);
+        logger.log_info("queued");
+        logger.setMode(CtLogger::Mode::Sync);
+        ASSERT_NE(memory->getLines().find("queued"), CtString::npos);
+        logger.log_info("direct");
+    }
+    CtString lines = memory->getLines();
+    ASSERT_LT(lines.find("queued"), lines.find("direct"));
+}
@@ -0,0 +1,100 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file ctreactor.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include <gtest/gtest.h>
+#include "cpptoolkit.hpp"
+
+#include <atomic>
+
+/**************************** Helper definitions ****************************/
+#define CT_REACTOR_PORT     26101
+#define WAIT_TIME           2000
+
+static CtBool waitFor(const std::function<CtBool()>& p_condition) {
+    for (CtUInt32 idx = 0; idx < WAIT_TIME && !p_condition(); idx++) {
+        CtThread::sleepFor(1);
+    }
+    return p_condition();
+}
+
+/********************************* Main test ********************************/
+
+/**
+ * @brief CtReactorTest01
+ * 
+ * @details
+ * Test that a throwing callback is reported and the reactor thread keeps dispatching,
+ * inline and on a worker pool.
+ * 
+ * @ref FR-006-002-007
+ * 
+ */
+TEST(CtReactor, CtReactorTest01) {
+    CtWorkerPool pool(2);
+    for (CtWorkerPool* p_pool : { (CtWorkerPool*)nullptr, &pool }) {
+        CtSocketUdp receiver;
+        receiver.setSub(CtNetAddress("127.0.0.1", CT_REACTOR_PORT));
+        CtSocketUdp sender;
+        sender.setPub(CT_REACTOR_PORT, "127.0.0.1");
+
+        std::atomic<CtUInt32> received(0);
+        std::atomic<CtUInt32> errors(0);
+        std::atomic<CtInt32> errorFd(0);
+        CtString errorMessage;
+        CtReactor reactor(CtReactor::Trigger::Level, p_pool);
+        reactor.setErrorCallback([&](CtInt32 p_fd, const CtString& p_message) {
+            errorMessage = p_message;
+            errorFd = p_fd;
+            errors++;
+        });
+        reactor.add(receiver, [&](CtInt32, CtUInt32) {
+            CtRawData message(64);
+            receiver.receive(&message);
+            if (received++ == 0) {
+                throw CtReactorError("Handler failed.");
+            }
+        });
+        reactor.runReactor();
+
+        CtRawData message(8);
+        message.clone((const CtUInt8*)"message", 8);
+        sender.send(message);
+        ASSERT_TRUE(waitFor([&]() { return errors.load() == 1; }));
+        ASSERT_EQ(errorFd.load(), receiver.getFd());
+        ASSERT_EQ(errorMessage, "Handler failed.");
+
+        sender.send(message);
+        sender.send(message);
+        ASSERT_TRUE(waitFor([&]() { return received.load() == 3; }));
+        ASSERT_EQ(errors.load(), 1u);
+        reactor.stopReactor();
+    }
+}
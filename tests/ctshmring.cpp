@@ -0,0 +1,166 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file ctshmring.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include <gtest/gtest.h>
+#include "cpptoolkit.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**************************** Helper definitions ****************************/
+#define CT_RING_CAPACITY    64u
+#define CT_RING_TIMEOUT     50
+
+static CtRawDataView view(const CtString& p_text) {
+    return CtRawDataView((const CtUInt8*)p_text.data(), p_text.size());
+}
+
+static CtString text(const CtRawData& p_data) {
+    return CtString((const CtChar*)p_data.get(), p_data.size());
+}
+
+/********************************* Main test ********************************/
+
+/**
+ * @brief CtShmRingTest01
+ * 
+ * @details
+ * Test messages that wrap around the end of the ring many times, read by a second mapping.
+ * 
+ * @ref FR-006-006-001
+ * @ref FR-006-006-002
+ * 
+ */
+TEST(CtShmRing, CtShmRingTest01) {
+    CtShmRing writer("test", CT_RING_CAPACITY);
+    CtShmRing reader(dup(writer.getFd()));
+    ASSERT_EQ(writer.capacity(), CT_RING_CAPACITY);
+    CtRawData message(CT_RING_CAPACITY);
+    for (CtUInt32 idx = 0; idx < 100; idx++) {
+        CtString sent = "message " + ToCtString(idx) + CtString(idx % 13, 'x');
+        ASSERT_TRUE(writer.write(view(sent)));
+        ASSERT_TRUE(reader.read(&message));
+        ASSERT_EQ(text(message), sent);
+    }
+    ASSERT_FALSE(reader.read(&message));
+}
+
+/**
+ * @brief CtShmRingTest02
+ * 
+ * @details
+ * Test a full ring, the timeouts of both sides and messages that can never fit.
+ * 
+ * @ref FR-006-006-002
+ * @ref FR-006-006-003
+ * 
+ */
+TEST(CtShmRing, CtShmRingTest02) {
+    CtShmRing ring("test", CT_RING_CAPACITY);
+    CtRawData message(CT_RING_CAPACITY);
+    EXPECT_THROW(ring.write(view(CtString(CT_RING_CAPACITY / 2 - 3, 'x'))), CtIpcError);
+
+    CtUInt32 written = 0;
+    while (ring.write(view("12345678901"))) {
+        written++;
+    }
+    ASSERT_EQ(written, CT_RING_CAPACITY / 16);
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(ring.write(view("12345678901"), CT_RING_TIMEOUT));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(CT_RING_TIMEOUT));
+
+    for (CtUInt32 idx = 0; idx < written; idx++) {
+        ASSERT_TRUE(ring.read(&message));
+        ASSERT_EQ(text(message), "12345678901");
+    }
+    start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(ring.read(&message, CT_RING_TIMEOUT));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(CT_RING_TIMEOUT));
+}
+
+/**
+ * @brief CtShmRingTest03
+ * 
+ * @details
+ * Test that a message larger than a fixed buffer is dropped and a growable buffer grows.
+ * 
+ * @ref FR-006-006-002
+ * 
+ */
+TEST(CtShmRing, CtShmRingTest03) {
+    CtShmRing ring("test", CT_RING_CAPACITY);
+    ASSERT_TRUE(ring.write(view("a long message")));
+    ASSERT_TRUE(ring.write(view("short")));
+    ASSERT_TRUE(ring.write(view("a long message")));
+
+    CtRawData small(8);
+    EXPECT_THROW(ring.read(&small), CtIpcError);
+    ASSERT_TRUE(ring.read(&small));
+    ASSERT_EQ(text(small), "short");
+
+    small.setGrowable(CT_TRUE);
+    ASSERT_TRUE(ring.read(&small));
+    ASSERT_EQ(text(small), "a long message");
+}
+
+/**
+ * @brief CtShmRingTest04
+ * 
+ * @details
+ * Test that a corrupted message length is rejected instead of read outside the ring.
+ * 
+ * @ref FR-006-006-002
+ * 
+ */
+TEST(CtShmRing, CtShmRingTest04) {
+    CtShmRing ring("test", CT_RING_CAPACITY);
+    ASSERT_TRUE(ring.write(view("message")));
+
+    struct stat s_stat;
+    ASSERT_EQ(fstat(ring.getFd(), &s_stat), 0);
+    void* memory = mmap(nullptr, s_stat.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, ring.getFd(), 0);
+    ASSERT_NE(memory, MAP_FAILED);
+    CtUInt8* data = (CtUInt8*)memory + s_stat.st_size - ring.capacity();
+    CtRawData message(CT_RING_CAPACITY);
+    message.setGrowable(CT_TRUE);
+    for (CtUInt32 size : { 0x7FFFFFFFu, CT_RING_CAPACITY / 2, 16u }) {
+        memcpy(data, &size, sizeof(size));
+        EXPECT_THROW(ring.read(&message), CtIpcError);
+    }
+    CtUInt32 size = 7;
+    memcpy(data, &size, sizeof(size));
+    ASSERT_TRUE(ring.read(&message));
+    ASSERT_EQ(text(message), "message");
+    munmap(memory, s_stat.st_size);
+}
@@ -0,0 +1,135 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file ctsockettcp.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include <gtest/gtest.h>
+#include "cpptoolkit.hpp"
+
+/**************************** Helper definitions ****************************/
+#define WAIT_TIME           2000
+
+/**
+ * @brief A connected pair of loopback sockets.
+ */
+struct CtTcpPair {
+    CtSocketTcp server;
+    CtSocketTcp client;
+    CtSocketTcp connection;
+
+    CtTcpPair(CtNetFamily p_serverFamily, CtNetFamily p_clientFamily, const CtString& p_address) : server(p_serverFamily), client(p_clientFamily) {
+        server.listen("lo", 0);
+        EXPECT_TRUE(client.connect(server.getPort(), p_address));
+        EXPECT_TRUE(server.accept(&connection));
+    }
+};
+
+static CtString text(const CtRawData& p_data) {
+    return CtString((const CtChar*)p_data.get(), p_data.size());
+}
+
+/********************************* Main test ********************************/
+
+/**
+ * @brief CtSocketTcpTest01
+ * 
+ * @details
+ * Test gathered sends and scattered receives over IPv4, IPv6 and dual-stack loopback connections.
+ * 
+ * @ref FR-006-004-003
+ * 
+ */
+TEST(CtSocketTcp, CtSocketTcpTest01) {
+    CtTcpPair pairs[] = {
+        { CtNetFamily::Ipv4, CtNetFamily::Ipv4, "127.0.0.1" },
+        { CtNetFamily::Ipv6, CtNetFamily::Ipv6, "::1" },
+        { CtNetFamily::DualStack, CtNetFamily::Ipv4, "127.0.0.1" }
+    };
+    for (CtTcpPair& pair : pairs) {
+        CtString header = "header";
+        CtString body = "the body of the message";
+        CtRawDataView parts[2] = {
+            CtRawDataView((const CtUInt8*)header.data(), header.size()),
+            CtRawDataView((const CtUInt8*)body.data(), body.size())
+        };
+        ASSERT_EQ(pair.client.sendGather(parts, 2), header.size() + body.size());
+
+        CtRawData received[2] = { CtRawData(header.size()), CtRawData(body.size()) };
+        ASSERT_EQ(pair.connection.receiveScatter(received, 2), header.size() + body.size());
+        ASSERT_EQ(text(received[0]), header);
+        ASSERT_EQ(text(received[1]), body);
+
+        pair.client.shutdown();
+        CtRawData rest(8);
+        ASSERT_EQ(pair.connection.receive(&rest), 0u);
+        ASSERT_TRUE(pair.connection.isClosed());
+    }
+}
+
+/**
+ * @brief CtSocketTcpTest02
+ * 
+ * @details
+ * Test that the completions of zero-copy sends are counted over IPv4 and IPv6.
+ * 
+ * @ref FR-006-004-005
+ * 
+ */
+TEST(CtSocketTcp, CtSocketTcpTest02) {
+    CtTcpPair pairs[] = {
+        { CtNetFamily::Ipv4, CtNetFamily::Ipv4, "127.0.0.1" },
+        { CtNetFamily::Ipv6, CtNetFamily::Ipv6, "::1" },
+        { CtNetFamily::DualStack, CtNetFamily::DualStack, "::1" }
+    };
+    for (CtTcpPair& pair : pairs) {
+        pair.client.setZeroCopy(CT_TRUE);
+        CtRawData buffer(4096);
+        buffer.resize(4096);
+        memset(buffer.get(), 'z', buffer.size());
+        CtUInt32 sent = 0;
+        for (CtUInt32 idx = 0; idx < 4; idx++) {
+            sent += pair.client.sendZeroCopy(buffer.view());
+        }
+        ASSERT_EQ(sent, 4u * 4096u);
+
+        CtRawData received(4096);
+        CtUInt32 total = 0;
+        while (total < sent) {
+            CtUInt32 s_bytes = pair.connection.receive(&received);
+            ASSERT_GT(s_bytes, 0u);
+            total += s_bytes;
+        }
+
+        CtUInt32 waited = 0;
+        while (pair.client.getZeroCopyPending() > 0 && waited++ < WAIT_TIME) {
+            CtThread::sleepFor(1);
+        }
+        ASSERT_EQ(pair.client.getZeroCopyPending(), 0u);
+    }
+}
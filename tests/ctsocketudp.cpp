@@ -0,0 +1,130 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file ctsocketudp.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include <gtest/gtest.h>
+#include "cpptoolkit.hpp"
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+/**************************** Helper definitions ****************************/
+#define CT_UDP_PORT     26103
+#define CT_UDP_TOS      0xb8
+#define WAIT_TIME       2000
+
+static CtBool waitFor(const std::function<CtBool()>& p_condition) {
+    for (CtUInt32 idx = 0; idx < WAIT_TIME && !p_condition(); idx++) {
+        CtThread::sleepFor(1);
+    }
+    return p_condition();
+}
+
+static CtInt32 getOption(CtSocketUdp& p_socket, CtInt32 p_level, CtInt32 p_option) {
+    CtInt32 s_value = -1;
+    socklen_t s_length = sizeof(s_value);
+    EXPECT_EQ(getsockopt(p_socket.getFd(), p_level, p_option, &s_value, &s_length), 0);
+    return s_value;
+}
+
+/********************************* Main test ********************************/
+
+/**
+ * @brief CtSocketUdpTest01
+ * 
+ * @details
+ * Test that the kernel receive timestamp and the drop counter are reported by receive()
+ * and receiveBatch() over IPv4 and IPv6 loopback.
+ * 
+ * @ref FR-006-001-022
+ * 
+ */
+TEST(CtSocketUdp, CtSocketUdpTest01) {
+    for (CtNetFamily p_family : { CtNetFamily::Ipv4, CtNetFamily::Ipv6 }) {
+        const CtString s_address = (p_family == CtNetFamily::Ipv4) ? "127.0.0.1" : "::1";
+        CtSocketUdp receiver(p_family);
+        receiver.setTimestamps(CT_TRUE);
+        receiver.setDropCounter(CT_TRUE);
+        receiver.setSub(CtNetAddress(s_address, CT_UDP_PORT));
+        CtSocketUdp sender(p_family);
+        sender.setPub(CtNetAddress(s_address, CT_UDP_PORT));
+
+        CtRawData message(8);
+        message.clone((const CtUInt8*)"message", 8);
+        sender.send(message);
+        ASSERT_TRUE(waitFor([&]() { return receiver.pollRead(); }));
+
+        CtRawData received(64);
+        CtUdpRxInfo info;
+        info.timestamp = 0;
+        info.drops = 1;
+        ASSERT_EQ(receiver.receive(&received, nullptr, &info), 8u);
+        EXPECT_NE(info.timestamp, 0u);
+        EXPECT_EQ(info.drops, 0u);
+        EXPECT_EQ(receiver.getDrops(), 0u);
+
+        sender.send(message);
+        sender.send(message);
+        CtRawData batch[4] = { CtRawData(64), CtRawData(64), CtRawData(64), CtRawData(64) };
+        CtUdpRxInfo infos[4] = {};
+        CtUInt32 count = 0;
+        ASSERT_TRUE(waitFor([&]() { return (count += receiver.receiveBatch(batch + count, 4 - count, nullptr, infos + count)) == 2; }));
+        for (CtUInt32 idx = 0; idx < count; idx++) {
+            EXPECT_EQ(batch[idx].size(), 8u);
+            EXPECT_GE(infos[idx].timestamp, info.timestamp);
+            EXPECT_EQ(infos[idx].drops, 0u);
+        }
+    }
+}
+
+/**
+ * @brief CtSocketUdpTest02
+ * 
+ * @details
+ * Test that the type of service is set with the option of the socket family, and with
+ * both options on a dual-stack socket.
+ * 
+ * @ref FR-006-001-021
+ * 
+ */
+TEST(CtSocketUdp, CtSocketUdpTest02) {
+    CtSocketUdp ipv4(CtNetFamily::Ipv4);
+    ipv4.setTos(CT_UDP_TOS);
+    EXPECT_EQ(getOption(ipv4, IPPROTO_IP, IP_TOS), CT_UDP_TOS);
+
+    CtSocketUdp ipv6(CtNetFamily::Ipv6);
+    ipv6.setTos(CT_UDP_TOS);
+    EXPECT_EQ(getOption(ipv6, IPPROTO_IPV6, IPV6_TCLASS), CT_UDP_TOS);
+
+    CtSocketUdp dualStack(CtNetFamily::DualStack);
+    dualStack.setTos(CT_UDP_TOS);
+    EXPECT_EQ(getOption(dualStack, IPPROTO_IPV6, IPV6_TCLASS), CT_UDP_TOS);
+    EXPECT_EQ(getOption(dualStack, IPPROTO_IP, IP_TOS), CT_UDP_TOS);
+}
@@ -0,0 +1,153 @@
+/*
+MIT License
+
+Copyright (c) 2024 Mouzenidis Panagiotis
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file ctsocketudpsharded.cpp
+ * @brief 
+ * @date 19-10-2026
+ * 
+ */
+
+#include <gtest/gtest.h>
+#include "cpptoolkit.hpp"
+
+#include <atomic>
+
+/**************************** Helper definitions ****************************/
+#define CT_SHARDED_PORT     26102
+#define CT_SHARDED_SHARDS   2u
+#define CT_SHARDED_SENDERS  8u
+#define WAIT_TIME           2000
+
+static CtBool waitFor(const std::function<CtBool()>& p_condition) {
+    for (CtUInt32 idx = 0; idx < WAIT_TIME && !p_condition(); idx++) {
+        CtThread::sleepFor(1);
+    }
+    return p_condition();
+}
+
+static CtUInt64 totalReceived(CtSocketUdpSharded& p_receiver) {
+    CtUInt64 s_total = 0;
+    for (CtUInt32 idx = 0; idx < p_receiver.shards(); idx++) {
+        s_total += p_receiver.getReceived(idx);
+    }
+    return s_total;
+}
+
+static CtUInt64 totalErrors(CtSocketUdpSharded& p_receiver) {
+    CtUInt64 s_total = 0;
+    for (CtUInt32 idx = 0; idx < p_receiver.shards(); idx++) {
+        s_total += p_receiver.getErrors(idx);
+    }
+    return s_total;
+}
+
+/********************************* Main test ********************************/
+
+/**
+ * @brief CtSocketUdpShardedTest01
+ * 
+ * @details
+ * Test that datagrams of several senders are received by the shards and counted,
+ * with and without pinning the shard threads.
+ * 
+ * @ref FR-006-003-001
+ * @ref FR-006-003-002
+ * @ref FR-006-003-004
+ * @ref FR-006-003-005
+ * 
+ */
+TEST(CtSocketUdpSharded, CtSocketUdpShardedTest01) {
+    for (CtBool p_pin : { CT_FALSE, CT_TRUE }) {
+        CtSocketUdpSharded receiver(CT_SHARDED_SHARDS);
+        ASSERT_EQ(receiver.shards(), CT_SHARDED_SHARDS);
+        receiver.setSub("lo", CT_SHARDED_PORT);
+
+        std::atomic<CtUInt32> delivered(0);
+        std::atomic<CtUInt32> badShard(0);
+        receiver.runShards([&](CtUInt32 p_shard, CtRawData* p_messages, CtUInt32 p_count) {
+            for (CtUInt32 idx = 0; idx < p_count; idx++) {
+                if (p_shard >= CT_SHARDED_SHARDS || p_messages[idx].size() != 8) {
+                    badShard++;
+                }
+            }
+            delivered += p_count;
+        }, p_pin);
+
+        CtRawData message(8);
+        message.clone((const CtUInt8*)"message", 8);
+        for (CtUInt32 idx = 0; idx < CT_SHARDED_SENDERS; idx++) {
+            CtSocketUdp sender;
+            sender.setPub(CT_SHARDED_PORT, "127.0.0.1");
+            sender.send(message);
+        }
+        ASSERT_TRUE(waitFor([&]() { return delivered.load() == CT_SHARDED_SENDERS; }));
+        ASSERT_EQ(totalReceived(receiver), CT_SHARDED_SENDERS);
+        ASSERT_EQ(totalErrors(receiver), 0u);
+        ASSERT_EQ(badShard.load(), 0u);
+        receiver.stopShards();
+
+        EXPECT_THROW(receiver.getReceived(CT_SHARDED_SHARDS), CtOutOfRangeError);
+        EXPECT_THROW(receiver.getErrors(CT_SHARDED_SHARDS), CtOutOfRangeError);
+    }
+}
+
+/**
+ * @brief CtSocketUdpShardedTest02
+ * 
+ * @details
+ * Test that an exception of the callback is counted and the shard keeps receiving.
+ * 
+ * @ref FR-006-003-006
+ * 
+ */
+TEST(CtSocketUdpSharded, CtSocketUdpShardedTest02) {
+    CtSocketUdpSharded receiver(CT_SHARDED_SHARDS);
+    receiver.setSub("lo", CT_SHARDED_PORT);
+
+    std::atomic<CtUInt32> delivered(0);
+    receiver.runShards([&](CtUInt32, CtRawData*, CtUInt32 p_count) {
+        if ((delivered += p_count) == p_count) {
+            throw CtSocketReadError("Callback failed.");
+        }
+    });
+    EXPECT_THROW(receiver.runShards([](CtUInt32, CtRawData*, CtUInt32) {}), CtThreadError);
+
+    CtRawData message(8);
+    message.clone((const CtUInt8*)"message", 8);
+    CtSocketUdp sender;
+    sender.setPub(CT_SHARDED_PORT, "127.0.0.1");
+    sender.send(message);
+    ASSERT_TRUE(waitFor([&]() { return totalErrors(receiver) == 1; }));
+
+    for (CtUInt32 idx = 0; idx < CT_SHARDED_SENDERS; idx++) {
+        CtSocketUdp other;
+        other.setPub(CT_SHARDED_PORT, "127.0.0.1");
+        other.send(message);
+    }
+    ASSERT_TRUE(waitFor([&]() { return delivered.load() == CT_SHARDED_SENDERS + 1; }));
+    ASSERT_EQ(totalReceived(receiver), CT_SHARDED_SENDERS + 1);
+    ASSERT_EQ(totalErrors(receiver), 1u);
+    receiver.stopShards();
+}
@@ -32,6 +32,8 @@ SOFTWARE.
 #include <gtest/gtest.h>
 #include "cpptoolkit.hpp"
 
+#include <net/if.h>
+
 /**************************** Helper definitions ****************************/
 
 /********************************* Main test ********************************/
@@ -307,3 +309,451 @@ TEST(CtTypes, CtRawDataTest14) {
         data.clone(buffer, 2);
     }, CtOutOfRangeError);
 }
+
+/**
+ * @brief CtRingBufferTest01
+ * 
+ * @details
+ * Test the basic functionality of CtRingBuffer class.
+ * 
+ * @ref FR-001-004-001
+ * @ref FR-001-004-002
+ * @ref FR-001-004-003
+ * @ref FR-001-004-004
+ * @ref FR-001-004-005
+ * 
+ */
+TEST(CtTypes, CtRingBufferTest01) {
+    CtRingBuffer<CtUInt32> ring(5);
+    ASSERT_EQ(ring.capacity(), 8);
+    ASSERT_EQ(ring.empty(), CT_TRUE);
+
+    for (CtUInt32 idx = 0; idx < ring.capacity(); idx++) {
+        ASSERT_EQ(ring.tryPush(idx), CT_TRUE);
+    }
+    ASSERT_EQ(ring.size(), 8);
+    ASSERT_EQ(ring.tryPush(100), CT_FALSE);
+
+    CtUInt32 value;
+    for (CtUInt32 idx = 0; idx < ring.capacity(); idx++) {
+        ASSERT_EQ(ring.tryPop(value), CT_TRUE);
+        ASSERT_EQ(value, idx);
+    }
+    ASSERT_EQ(ring.tryPop(value), CT_FALSE);
+    ASSERT_EQ(ring.empty(), CT_TRUE);
+}
+
+/**
+ * @brief CtRingBufferTest02
+ * 
+ * @details
+ * Test that no item is lost or duplicated when multiple producers push concurrently.
+ * 
+ * @ref FR-001-004-001
+ * @ref FR-001-004-003
+ * @ref FR-001-004-004
+ * 
+ */
+TEST(CtTypes, CtRingBufferTest02) {
+    const CtUInt32 producers = 4;
+    const CtUInt32 items = 10000;
+    CtRingBuffer<CtUInt64> ring(64);
+    CtVector<std::thread> threads;
+
+    for (CtUInt32 p = 0; p < producers; p++) {
+        threads.emplace_back([&ring, p, items]{
+            for (CtUInt64 idx = 1; idx <= items; idx++) {
+                while (!ring.tryPush(idx)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    CtUInt64 sum = 0;
+    CtUInt64 value;
+    for (CtUInt32 cnt = 0; cnt < producers * items;) {
+        if (ring.tryPop(value)) {
+            sum += value;
+            cnt++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(sum, producers * ((CtUInt64)items * (items + 1) / 2));
+    ASSERT_EQ(ring.empty(), CT_TRUE);
+}
+
+/**
+ * @brief CtRawDataTest15
+ * 
+ * @details
+ * Test growable mode, reserve() and resize() of CtRawData.
+ * 
+ * @ref FR-001-003-019
+ * @ref FR-001-003-021
+ * @ref FR-001-003-022
+ * @ref FR-001-003-023
+ * 
+ */
+TEST(CtTypes, CtRawDataTest15) {
+    CtRawData data(2);
+    ASSERT_EQ(data.isGrowable(), CT_FALSE);
+    data.setNextByte('a');
+    data.setNextByte('b');
+    EXPECT_THROW(data.setNextByte('c'), CtOutOfRangeError);
+    EXPECT_THROW(data.resize(3), CtOutOfRangeError);
+
+    data.setGrowable(CT_TRUE);
+    data.setNextByte('c');
+    ASSERT_EQ(data.maxSize(), 4);
+    data.setNextBytes((CtUInt8*)"defgh", 5);
+    ASSERT_EQ(data.maxSize(), 8);
+    ASSERT_EQ(memcmp(data.get(), "abcdefgh", 8), 0);
+
+    CtRawData copy(data);
+    ASSERT_EQ(copy.isGrowable(), CT_TRUE);
+    copy.clone((CtUInt8*)"0123456789", 10);
+    ASSERT_EQ(copy.maxSize(), 16);
+
+    data.reserve(100);
+    ASSERT_EQ(data.maxSize(), 100);
+    ASSERT_EQ(data.size(), 8);
+    ASSERT_EQ(memcmp(data.get(), "abcdefgh", 8), 0);
+    data.resize(3);
+    ASSERT_EQ(data.size(), 3);
+    data.resize(200);
+    ASSERT_EQ(data.maxSize(), 200);
+}
+
+/**
+ * @brief CtRawDataTest16
+ * 
+ * @details
+ * Test move construction, move assignment and const accessors of CtRawData.
+ * 
+ * @ref FR-001-003-024
+ * @ref FR-001-003-025
+ * 
+ */
+TEST(CtTypes, CtRawDataTest16) {
+    CtRawData data(10);
+    data.clone((const CtUInt8*)"abc", 3);
+    const CtUInt8* buffer = data.get();
+
+    CtRawData moved(std::move(data));
+    ASSERT_EQ(moved.get(), buffer);
+    ASSERT_EQ(moved.size(), 3);
+    ASSERT_EQ(moved.maxSize(), 10);
+    ASSERT_EQ(data.size(), 0);
+    ASSERT_EQ(data.maxSize(), 0);
+    EXPECT_THROW(data.setNextByte('a'), CtOutOfRangeError);
+
+    CtRawData assigned(1);
+    assigned = std::move(moved);
+    ASSERT_EQ(assigned.get(), buffer);
+    ASSERT_EQ(moved.maxSize(), 0);
+
+    const CtRawData& constData = assigned;
+    CtRawData copy(constData);
+    ASSERT_EQ(copy.size(), constData.size());
+    ASSERT_EQ(memcmp(copy.get(), constData.get(), constData.size()), 0);
+
+    CtVector<CtRawData> vec;
+    vec.push_back(std::move(copy));
+    vec.push_back(CtRawData(5));
+    ASSERT_EQ(vec[0].size(), 3);
+}
+
+/**
+ * @brief CtRawDataTest17
+ * 
+ * @details
+ * Test CtRawDataView.
+ * 
+ * @ref FR-001-003-019
+ * @ref FR-001-003-025
+ * @ref FR-001-003-026
+ * @ref FR-001-003-027
+ * 
+ */
+TEST(CtTypes, CtRawDataTest17) {
+    CtRawData data;
+    data.clone((const CtUInt8*)"header:payload", 14);
+
+    CtRawDataView view = data.view();
+    ASSERT_EQ(view.get(), data.get());
+    ASSERT_EQ(view.size(), 14);
+    ASSERT_EQ(CtRawDataView(data).size(), 14);
+    ASSERT_EQ(CtRawDataView().empty(), CT_TRUE);
+
+    CtRawDataView payload = view.subview(7);
+    ASSERT_EQ(payload.get(), data.get() + 7);
+    ASSERT_EQ(payload.size(), 7);
+    ASSERT_EQ(view.subview(0, 6).size(), 6);
+    ASSERT_EQ(view.subview(14).empty(), CT_TRUE);
+    EXPECT_THROW(view.subview(15), CtOutOfRangeError);
+    EXPECT_THROW(view.subview(7, 8), CtOutOfRangeError);
+
+    std::span<const CtUInt8> bytes = payload.span();
+    ASSERT_EQ(bytes.data(), payload.get());
+    ASSERT_EQ(bytes.size(), 7);
+    CtRawDataView fromSpan(bytes.subspan(1, 2));
+    ASSERT_EQ(memcmp(fromSpan.get(), "ay", 2), 0);
+}
+
+/**
+ * @brief CtRawDataPoolTest01
+ * 
+ * @details
+ * Test that CtRawData objects reuse the buffers of a CtRawDataPool.
+ * 
+ * @ref FR-001-003-020
+ * @ref FR-001-005-001
+ * @ref FR-001-005-003
+ * @ref FR-001-005-004
+ * @ref FR-001-005-005
+ * 
+ */
+TEST(CtTypes, CtRawDataPoolTest01) {
+    CtRawDataPool pool;
+    {
+        CtRawData data(1500, &pool);
+        ASSERT_EQ(data.maxSize(), 1500);
+        data.clone((CtUInt8*)"abc", 3);
+        CtRawData copy(data);
+        ASSERT_EQ(copy.size(), 3);
+    }
+    ASSERT_EQ(pool.getAllocations(), 2);
+
+    for (CtUInt32 idx = 0; idx < 1000; idx++) {
+        CtRawData data(1025 + idx, &pool);
+        CtRawData copy(data);
+    }
+    ASSERT_EQ(pool.getAllocations(), 2);
+
+    {
+        CtRawData data(10, &pool);
+        data.setGrowable(CT_TRUE);
+        for (CtUInt32 idx = 0; idx < 1000; idx++) {
+            data.setNextByte((CtUInt8)idx);
+        }
+        ASSERT_EQ(data.size(), 1000);
+        ASSERT_EQ(data.get()[999], (CtUInt8)999);
+    }
+    CtUInt64 allocations = pool.getAllocations();
+    {
+        CtRawData data(10, &pool);
+        data.setGrowable(CT_TRUE);
+        data.reserve(1000);
+    }
+    ASSERT_EQ(pool.getAllocations(), allocations);
+}
+
+/**
+ * @brief CtRawDataPoolTest02
+ * 
+ * @details
+ * Test the cache limit of CtRawDataPool, buffers bigger than the largest size class and the global pool.
+ * 
+ * @ref FR-001-005-002
+ * @ref FR-001-005-003
+ * @ref FR-001-005-006
+ * 
+ */
+TEST(CtTypes, CtRawDataPoolTest02) {
+    CtRawDataPool pool(2);
+    CtUInt32 capacity[4];
+    CtUInt8* buffers[4];
+    for (CtUInt32 idx = 0; idx < 4; idx++) {
+        buffers[idx] = pool.acquire(100, capacity[idx]);
+        ASSERT_EQ(capacity[idx], 128);
+    }
+    for (CtUInt32 idx = 0; idx < 4; idx++) {
+        pool.release(buffers[idx], capacity[idx]);
+    }
+    for (CtUInt32 idx = 0; idx < 4; idx++) {
+        buffers[idx] = pool.acquire(128, capacity[idx]);
+    }
+    ASSERT_EQ(pool.getAllocations(), 6);
+    for (CtUInt32 idx = 0; idx < 4; idx++) {
+        pool.release(buffers[idx], capacity[idx]);
+    }
+
+    CtUInt8* large = pool.acquire((1u << CT_POOL_MAX_SHIFT) + 1, capacity[0]);
+    ASSERT_EQ(capacity[0], (1u << CT_POOL_MAX_SHIFT) + 1);
+    pool.release(large, capacity[0]);
+
+    ASSERT_EQ(&CtRawDataPool::global(), &CtRawDataPool::global());
+}
+
+/**
+ * @brief CtSharedDataTest01
+ * 
+ * @details
+ * Test that copies of CtSharedData share the same bytes, also across threads.
+ * 
+ * @ref FR-001-006-001
+ * @ref FR-001-006-002
+ * @ref FR-001-006-003
+ * @ref FR-001-006-004
+ * @ref FR-001-006-005
+ * 
+ */
+TEST(CtTypes, CtSharedDataTest01) {
+    CtRawDataPool pool;
+    ASSERT_EQ(CtSharedData().empty(), CT_TRUE);
+    ASSERT_EQ(CtSharedData().segments(), 0);
+    ASSERT_EQ(CtSharedData().useCount(), 0);
+    {
+        CtRawData data(100, &pool);
+        data.clone((const CtUInt8*)"shared", 6);
+        const CtUInt8* buffer = data.get();
+
+        CtSharedData shared(std::move(data));
+        ASSERT_EQ(data.maxSize(), 0);
+        ASSERT_EQ(shared.size(), 6);
+        ASSERT_EQ(shared.segments(), 1);
+        ASSERT_EQ(shared.segment(0).get(), buffer);
+        EXPECT_THROW(shared.segment(1), CtOutOfRangeError);
+
+        CtSharedData copy = shared;
+        ASSERT_EQ(shared.useCount(), 2);
+        ASSERT_EQ(copy.segment(0).get(), buffer);
+
+        std::vector<std::thread> threads;
+        for (CtUInt32 idx = 0; idx < 4; idx++) {
+            threads.emplace_back([copy, buffer]() {
+                for (CtUInt32 it = 0; it < 1000; it++) {
+                    CtSharedData local = copy;
+                    ASSERT_EQ(local.segment(0).get(), buffer);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        ASSERT_EQ(shared.useCount(), 2);
+
+        CtSharedData moved = std::move(copy);
+        ASSERT_EQ(copy.empty(), CT_TRUE);
+        ASSERT_EQ(shared.useCount(), 2);
+    }
+    ASSERT_EQ(pool.getAllocations(), 1);
+    CtRawData data(100, &pool);
+    ASSERT_EQ(pool.getAllocations(), 1);
+
+    CtSharedData copied(CtRawDataView((const CtUInt8*)"abc", 3));
+    ASSERT_EQ(copied.size(), 3);
+    ASSERT_EQ(memcmp(copied.segment(0).get(), "abc", 3), 0);
+}
+
+/**
+ * @brief CtSharedDataTest02
+ * 
+ * @details
+ * Test chaining of CtSharedData segments.
+ * 
+ * @ref FR-001-006-005
+ * @ref FR-001-006-006
+ * @ref FR-001-006-007
+ * 
+ */
+TEST(CtTypes, CtSharedDataTest02) {
+    CtSharedData header(CtRawDataView((const CtUInt8*)"head:", 5));
+    CtSharedData body(CtRawDataView((const CtUInt8*)"body", 4));
+    CtSharedData tail(CtRawDataView((const CtUInt8*)":tail", 5));
+
+    CtSharedData message = header.append(body).append(tail);
+    ASSERT_EQ(message.size(), 14);
+    ASSERT_EQ(message.segments(), 3);
+    ASSERT_EQ(header.segments(), 1);
+    ASSERT_EQ(message.segment(1).get(), body.segment(0).get());
+    ASSERT_EQ(CtSharedData().append(body).segment(0).get(), body.segment(0).get());
+    ASSERT_EQ(body.append(CtSharedData()).size(), 4);
+
+    CtRawData data(14);
+    message.copyTo(&data);
+    ASSERT_EQ(memcmp(data.get(), "head:body:tail", 14), 0);
+    CtRawData small(10);
+    EXPECT_THROW(message.copyTo(&small), CtOutOfRangeError);
+
+    header = CtSharedData();
+    body = CtSharedData();
+    ASSERT_EQ(memcmp(message.segment(0).get(), "head:", 5), 0);
+}
+
+/**
+ * @brief CtNetAddressTest01
+ * 
+ * @details
+ * Test parsing, formatting and comparison of IPv4 and IPv6 addresses.
+ * 
+ * @ref FR-001-003-028
+ * 
+ */
+TEST(CtTypes, CtNetAddressTest01) {
+    CtNetAddress empty;
+    ASSERT_EQ(empty.getFamily(), AF_UNSPEC);
+    ASSERT_EQ(empty.getAddress(), "");
+
+    CtNetAddress v4("192.168.1.20", 5000);
+    ASSERT_EQ(v4.getFamily(), AF_INET);
+    ASSERT_EQ(v4.getAddress(), "192.168.1.20");
+    ASSERT_EQ(v4.getPort(), 5000);
+    ASSERT_EQ(v4.getSockLength(), sizeof(sockaddr_in));
+    ASSERT_EQ(ntohs(((const sockaddr_in*)v4.getSockAddr())->sin_port), 5000);
+
+    CtNetAddress v6("fe80::1:2", 6000);
+    ASSERT_EQ(v6.getFamily(), AF_INET6);
+    ASSERT_EQ(v6.getAddress(), "fe80::1:2");
+    ASSERT_EQ(v6.getPort(), 6000);
+    ASSERT_EQ(v6.getSockLength(), sizeof(sockaddr_in6));
+    v6.setPort(6001);
+    ASSERT_EQ(v6.getPort(), 6001);
+
+    ASSERT_EQ(v4 == CtNetAddress("192.168.1.20", 5000), CT_TRUE);
+    ASSERT_EQ(v4 == CtNetAddress("192.168.1.20", 5001), CT_FALSE);
+    ASSERT_EQ(v4 == CtNetAddress("192.168.1.21", 5000), CT_FALSE);
+    ASSERT_EQ(v4 == v6, CT_FALSE);
+
+    EXPECT_THROW(CtNetAddress("192.168.1.256", 1), CtTypeParseError);
+    EXPECT_THROW(CtNetAddress("localhost", 1), CtTypeParseError);
+    EXPECT_THROW(CtNetAddress("fe80::1%no-such-interface", 1), CtTypeParseError);
+}
+
+/**
+ * @brief CtNetAddressTest02
+ * 
+ * @details
+ * Test the conversion of IPv4 addresses for dual-stack sockets.
+ * 
+ * @ref FR-001-003-029
+ * 
+ */
+TEST(CtTypes, CtNetAddressTest02) {
+    CtNetAddress mapped = CtNetAddress("10.0.0.1", 7000).toIpv6();
+    ASSERT_EQ(mapped.getFamily(), AF_INET6);
+    ASSERT_EQ(mapped.getAddress(), "::ffff:10.0.0.1");
+    ASSERT_EQ(mapped.getPort(), 7000);
+    ASSERT_EQ(mapped == CtNetAddress("::ffff:10.0.0.1", 7000), CT_TRUE);
+
+    CtNetAddress v6("::1", 7001);
+    ASSERT_EQ(v6.toIpv6() == v6, CT_TRUE);
+
+    CtNetAddress scoped("fe80::1%lo", 7002);
+    CtNetAddress scopedV6 = scoped.toIpv6();
+    ASSERT_EQ(scopedV6 == scoped, CT_TRUE);
+    ASSERT_EQ(((const sockaddr_in6*)scopedV6.getSockAddr())->sin6_scope_id, if_nametoindex("lo"));
+    ASSERT_EQ(scoped == CtNetAddress("fe80::1%lo", 7002), CT_TRUE);
+    ASSERT_EQ(scoped == CtNetAddress("fe80::1", 7002), CT_FALSE);
+    ASSERT_EQ(CtNetAddress("fe80::1", 7002) == scopedV6, CT_FALSE);
+
+    mapped.setPort(7003);
+    ASSERT_EQ(mapped.getPort(), 7003);
+    ASSERT_EQ(mapped.getAddress(), "::ffff:10.0.0.1");
+    ASSERT_EQ(mapped == CtNetAddress("10.0.0.1", 7003).toIpv6(), CT_TRUE);
+}